@@ -61,13 +61,21 @@ function(hpx_perform_cxx_feature_tests)
     DEFINITIONS HPX_HAVE_CXX17_MEMORY_RESOURCE
   )
 
-  # C++20 feature tests
-  if(HPX_WITH_CXX_STANDARD GREATER_EQUAL 20)
-    hpx_check_for_cxx20_coroutines(DEFINITIONS HPX_HAVE_CXX20_COROUTINES)
-
+  # std::experimental::simd is available in C++17 mode as well (GCC 11 and
+  # newer), use it as the datapar backend unless Vc was requested explicitly
+  if(HPX_WITH_DATAPAR_EXPERIMENTAL_SIMD AND NOT HPX_WITH_DATAPAR_VC)
     hpx_check_for_cxx20_experimental_simd(
       DEFINITIONS HPX_HAVE_CXX20_EXPERIMENTAL_SIMD HPX_HAVE_DATAPAR
     )
+  else()
+    # drop the result of an earlier configuration, this also makes sure the
+    # test is run again if the backend is re-enabled
+    unset(HPX_WITH_CXX20_EXPERIMENTAL_SIMD CACHE)
+  endif()
+
+  # C++20 feature tests
+  if(HPX_WITH_CXX_STANDARD GREATER_EQUAL 20)
+    hpx_check_for_cxx20_coroutines(DEFINITIONS HPX_HAVE_CXX20_COROUTINES)
 
     hpx_check_for_cxx20_lambda_capture(
       DEFINITIONS HPX_HAVE_CXX20_LAMBDA_CAPTURE
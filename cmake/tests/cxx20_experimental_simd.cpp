@@ -4,7 +4,8 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
-// test for availability of std experimental simd (C++20)
+// test for availability of std experimental simd (Parallelism TS v2, C++17
+// and newer)
 
 // Enable this test only for GCC Compilers as simd header is not
 // completely implemented for other compilers.
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_impl.hpp>
 
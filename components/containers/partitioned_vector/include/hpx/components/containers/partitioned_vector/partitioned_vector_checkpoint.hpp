@@ -0,0 +1,137 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/delta_tracker.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    /// Create an incremental checkpoint of the given partitioned_vector. The
+    /// checkpoint contains, for each partition, the blocks which have changed
+    /// since the previous incremental checkpoint of the partition was created
+    /// or applied. The first incremental checkpoint of a partition contains
+    /// all of its blocks.
+    ///
+    /// \param v          The partitioned_vector to checkpoint
+    /// \param block_size The size of the blocks (in bytes) the partitions
+    ///                   are split into. Changing the block size starts a
+    ///                   new sequence of checkpoints containing all blocks.
+    ///
+    /// \returns This returns the checkpoint as an hpx::future
+    ///
+    /// \note The checkpoints have to be restored in the sequence they were
+    ///       created in, see \a restore_checkpoint_delta.
+    template <typename T, typename Data>
+    hpx::future<checkpoint> save_checkpoint_delta(
+        hpx::partitioned_vector<T, Data> const& v,
+        std::size_t block_size = delta_tracker::default_block_size)
+    {
+        using partition_type = hpx::partitioned_vector_partition<T, Data>;
+
+        std::vector<hpx::future<checkpoint_delta>> deltas;
+        for (auto it = v.segment_begin(); it != v.segment_end(); ++it)
+        {
+            deltas.push_back(
+                partition_type(it->get_id()).get_checkpoint_delta(block_size));
+        }
+
+        return hpx::dataflow(
+            [](std::vector<hpx::future<checkpoint_delta>>&& deltas) {
+                std::vector<checkpoint_delta> manifest;
+                manifest.reserve(deltas.size());
+                for (auto& f : deltas)
+                {
+                    manifest.push_back(f.get());
+                }
+                return save_checkpoint(hpx::launch::sync, manifest);
+            },
+            HPX_MOVE(deltas));
+    }
+
+    /// Apply an incremental checkpoint created by \a save_checkpoint_delta to
+    /// the given partitioned_vector. The partitioned_vector has to have the
+    /// same layout as the one the checkpoint was created from and has to hold
+    /// the data of the preceding checkpoint of the same sequence (unless the
+    /// checkpoint is the first of its sequence).
+    ///
+    /// \param c    The checkpoint to restore
+    /// \param v    The partitioned_vector to apply the checkpoint to
+    ///
+    template <typename T, typename Data>
+    void restore_checkpoint_delta(
+        checkpoint const& c, hpx::partitioned_vector<T, Data>& v)
+    {
+        using partition_type = hpx::partitioned_vector_partition<T, Data>;
+
+        std::vector<checkpoint_delta> manifest;
+        restore_checkpoint(c, manifest);
+
+        std::vector<hpx::id_type> partitions;
+        for (auto it = v.segment_begin(); it != v.segment_end(); ++it)
+        {
+            partitions.push_back(it->get_id());
+        }
+
+        if (manifest.size() != partitions.size())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::util::restore_checkpoint_delta",
+                hpx::util::format("the number of partitions ({}) does not "
+                                  "match the checkpoint ({})",
+                    partitions.size(), manifest.size()));
+        }
+
+        std::vector<hpx::future<void>> results;
+        results.reserve(partitions.size());
+        for (std::size_t i = 0; i != partitions.size(); ++i)
+        {
+            partition_type partition(partitions[i]);
+            results.push_back(
+                partition.apply_checkpoint_delta(HPX_MOVE(manifest[i])));
+        }
+
+        hpx::wait_all(results);
+        for (auto& f : results)
+        {
+            f.get();    // rethrow exceptions
+        }
+    }
+
+    /// Apply a sequence of incremental checkpoints created by
+    /// \a save_checkpoint_delta to the given partitioned_vector, starting with
+    /// the first checkpoint of the sequence.
+    ///
+    /// \param chain The checkpoints to restore, in the order they were
+    ///              created in
+    /// \param v     The partitioned_vector to apply the checkpoints to
+    ///
+    template <typename T, typename Data>
+    void restore_checkpoint_delta(std::vector<checkpoint> const& chain,
+        hpx::partitioned_vector<T, Data>& v)
+    {
+        for (checkpoint const& c : chain)
+        {
+            restore_checkpoint_delta(c, v);
+        }
+    }
+}}    // namespace hpx::util
@@ -20,12 +20,15 @@
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
+#include <hpx/checkpoint_base/delta_tracker.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/server/locking_hook.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/synchronization/mutex.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 
@@ -33,6 +36,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -56,6 +60,13 @@ namespace hpx { namespace server {
         typedef typename data_type::iterator iterator_type;
         typedef typename data_type::const_iterator const_iterator_type;
 
+        /// The type used to transfer contiguous ranges of elements. Ranges of
+        /// trivially copyable elements are sent as a serialize_buffer, which
+        /// is transmitted using zero-copy serialization.
+        typedef std::conditional_t<std::is_trivially_copyable<T>::value,
+            hpx::serialization::serialize_buffer<T>, std::vector<T>>
+            range_type;
+
         typedef components::locking_hook<
             components::component_base<partitioned_vector<T, Data>>>
             base_type;
@@ -72,6 +83,15 @@ namespace hpx { namespace server {
 
         explicit partitioned_vector(size_type partition_size);
 
+        /// Constructor which create partitioned_vector_partition using the
+        /// given allocator.
+        ///
+        /// param partition_size The size of vector
+        /// param alloc The allocator used for the elements of the partition
+        ///
+        partitioned_vector(
+            size_type partition_size, allocator_type const& alloc);
+
         /// Constructor which create and initialize partitioned_vector_partition
         /// with all elements as \a val.
         ///
@@ -84,11 +104,11 @@ namespace hpx { namespace server {
             allocator_type const& alloc);
 
         // support components::copy
-        partitioned_vector(partitioned_vector const& rhs) = default;
-        partitioned_vector(partitioned_vector&& rhs) = default;
+        partitioned_vector(partitioned_vector const& rhs);
+        partitioned_vector(partitioned_vector&& rhs);
 
-        partitioned_vector& operator=(partitioned_vector const& rhs) = default;
-        partitioned_vector& operator=(partitioned_vector&& rhs) = default;
+        partitioned_vector& operator=(partitioned_vector const& rhs);
+        partitioned_vector& operator=(partitioned_vector&& rhs);
 
         ///////////////////////////////////////////////////////////////////////
         data_type& get_data();
@@ -177,6 +197,17 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<size_type> const& pos) const;
 
+        /// Return the \a count elements starting at position \a first in the
+        /// partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param count Number of elements to return
+        ///
+        /// \return Return the values of the elements in the given range.
+        ///
+        range_type get_range(size_type first, size_type count) const;
+
         /// Access the value of first element in the partitioned_vector_partition.
         ///
         /// Calling the function on empty container cause undefined behavior.
@@ -243,11 +274,54 @@ namespace hpx { namespace server {
         void set_values(
             std::vector<size_type> const& pos, std::vector<T> const& val);
 
+        /// Copy the values of \a val to the elements starting at position
+        /// \a first in the partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        void set_range(size_type first, range_type const& val);
+
+        /// Copy the \a count elements starting at position \a first to the
+        /// partitioned_vector_partition \a dest, starting at position
+        /// \a dest_first there. The elements are sent directly to \a dest.
+        ///
+        /// \param first      Position of the first element to copy
+        /// \param count      Number of elements to copy
+        /// \param dest       The partition to copy the elements to
+        /// \param dest_first Position of the first element in \a dest
+        ///
+        hpx::future<void> copy_range(size_type first, size_type count,
+            hpx::id_type const& dest, size_type dest_first) const;
+
         /// Remove all elements from the vector leaving the
         /// partitioned_vector_partition with size 0.
         ///
         void clear();
 
+        ///////////////////////////////////////////////////////////////////////
+        // Incremental checkpoints
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return the blocks of the partitioned_vector_partition which have
+        /// changed since the previous call to this function or to
+        /// \a apply_checkpoint_delta.
+        ///
+        /// \param block_size  The size of the blocks (in bytes) the data is
+        ///                    split into
+        ///
+        hpx::util::checkpoint_delta get_checkpoint_delta(
+            std::size_t block_size);
+
+        /// Apply a delta created by \a get_checkpoint_delta. The partition has
+        /// to hold the data the delta is based on, unless the delta contains
+        /// all blocks.
+        ///
+        /// \param delta The delta to apply
+        ///
+        void apply_checkpoint_delta(hpx::util::checkpoint_delta const& delta);
+
         /// Macros to define HPX component actions for all exported functions.
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, size)
 
@@ -261,6 +335,7 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_range)
 
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, front)
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, back)
@@ -270,10 +345,21 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_range)
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, copy_range)
 
         // HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_data)
+
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, get_checkpoint_delta)
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, apply_checkpoint_delta)
+
+    private:
+        // protects delta_tracker_, the checkpoint actions may run
+        // concurrently with each other
+        mutable hpx::lcos::local::mutex delta_mtx_;
+        hpx::util::delta_tracker delta_tracker_;
     };
 }}    // namespace hpx::server
 
@@ -295,6 +381,12 @@ namespace hpx { namespace server {
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                   \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_range_action,                    \
+        HPX_PP_CAT(__vector_get_range_action_, name))                          \
+    HPX_REGISTER_ACTION_DECLARATION(type::set_range_action,                    \
+        HPX_PP_CAT(__vector_set_range_action_, name))                          \
+    HPX_REGISTER_ACTION_DECLARATION(type::copy_range_action,                   \
+        HPX_PP_CAT(__vector_copy_range_action_, name))                         \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
@@ -303,6 +395,10 @@ namespace hpx { namespace server {
         HPX_PP_CAT(__vector_get_copied_data_action_, name))                    \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::set_data_action, HPX_PP_CAT(__vector_set_data_action_, name))    \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_checkpoint_delta_action,         \
+        HPX_PP_CAT(__vector_get_checkpoint_delta_action_, name))               \
+    HPX_REGISTER_ACTION_DECLARATION(type::apply_checkpoint_delta_action,       \
+        HPX_PP_CAT(__vector_apply_checkpoint_delta_action_, name))             \
     /**/
 
 #define HPX_REGISTER_VECTOR_DECLARATION_1(type)                                \
@@ -457,6 +553,30 @@ namespace hpx {
         future<std::vector<T>> get_values(
             std::vector<std::size_t> const& pos) const;
 
+        /// Returns the \a count elements starting at position \a first in
+        /// the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param count Number of elements to return
+        ///
+        /// \return Returns the values of the elements in the given range
+        ///
+        typename server_type::range_type get_range(
+            launch::sync_policy, std::size_t first, std::size_t count) const;
+
+        /// Returns the \a count elements starting at position \a first in
+        /// the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param count Number of elements to return
+        ///
+        /// \return This returns the values as the hpx::future
+        ///
+        future<typename server_type::range_type> get_range(
+            std::size_t first, std::size_t count) const;
+
         // future<T> front_async() const
         // {
         //     HPX_ASSERT(this->get_id());
@@ -539,6 +659,43 @@ namespace hpx {
         future<void> set_values(
             std::vector<std::size_t> const& pos, std::vector<T> const& val);
 
+        /// Copy the values of \a val to the elements starting at position
+        /// \a first in the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        void set_range(launch::sync_policy, std::size_t first,
+            typename server_type::range_type&& val);
+
+        /// Copy the values of \a val to the elements starting at position
+        /// \a first in the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> set_range(
+            std::size_t first, typename server_type::range_type&& val);
+
+        /// Copy the \a count elements starting at position \a first to the
+        /// partitioned_vector_partition \a dest, starting at position
+        /// \a dest_first there. The elements are sent from this partition
+        /// directly to \a dest.
+        ///
+        /// \param first      Position of the first element to copy
+        /// \param count      Number of elements to copy
+        /// \param dest       The partition to copy the elements to
+        /// \param dest_first Position of the first element in \a dest
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> copy_range(std::size_t first, std::size_t count,
+            hpx::id_type const& dest, std::size_t dest_first) const;
+
         //         void clear()
         //         {
         //             HPX_ASSERT(this->get_id());
@@ -575,6 +732,26 @@ namespace hpx {
         ///
         hpx::future<void> set_data(
             typename server_type::data_type&& other) const;
+
+        /// Returns the blocks of the data owned by the
+        /// partitioned_vector_partition component which have changed since
+        /// the previous call to this function or to apply_checkpoint_delta.
+        ///
+        /// \param block_size  The size of the blocks (in bytes) the data is
+        ///                    split into
+        ///
+        /// \return This returns the delta as an hpx::future
+        ///
+        hpx::future<hpx::util::checkpoint_delta> get_checkpoint_delta(
+            std::size_t block_size) const;
+
+        /// Applies a delta created by get_checkpoint_delta to the data owned
+        /// by the partitioned_vector_partition component.
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        hpx::future<void> apply_checkpoint_delta(
+            hpx::util::checkpoint_delta&& delta) const;
     };
 }    // namespace hpx
 
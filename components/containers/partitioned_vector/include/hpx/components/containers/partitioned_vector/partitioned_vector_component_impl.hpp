@@ -10,23 +10,32 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/delta_tracker.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/synchronization/mutex.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -46,6 +55,14 @@ namespace hpx { namespace server {
     {
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+    partitioned_vector<T, Data>::partitioned_vector(
+        size_type partition_size, allocator_type const& alloc)
+      : partitioned_vector_partition_(partition_size, alloc)
+    {
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(
@@ -62,6 +79,59 @@ namespace hpx { namespace server {
     {
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+    partitioned_vector<T, Data>::partitioned_vector(
+        partitioned_vector const& rhs)
+      : base_type(rhs)
+      , partitioned_vector_partition_(rhs.partitioned_vector_partition_)
+    {
+        std::lock_guard<hpx::lcos::local::mutex> l(rhs.delta_mtx_);
+        delta_tracker_ = rhs.delta_tracker_;
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+    partitioned_vector<T, Data>::partitioned_vector(partitioned_vector&& rhs)
+      : base_type(HPX_MOVE(rhs))
+      , partitioned_vector_partition_(
+            HPX_MOVE(rhs.partitioned_vector_partition_))
+    {
+        std::lock_guard<hpx::lcos::local::mutex> l(rhs.delta_mtx_);
+        delta_tracker_ = HPX_MOVE(rhs.delta_tracker_);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT partitioned_vector<T, Data>&
+    partitioned_vector<T, Data>::operator=(partitioned_vector const& rhs)
+    {
+        if (this != &rhs)
+        {
+            this->base_type::operator=(rhs);
+            partitioned_vector_partition_ = rhs.partitioned_vector_partition_;
+
+            std::scoped_lock l(delta_mtx_, rhs.delta_mtx_);
+            delta_tracker_ = rhs.delta_tracker_;
+        }
+        return *this;
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT partitioned_vector<T, Data>&
+    partitioned_vector<T, Data>::operator=(partitioned_vector&& rhs)
+    {
+        if (this != &rhs)
+        {
+            this->base_type::operator=(HPX_MOVE(rhs));
+            partitioned_vector_partition_ =
+                HPX_MOVE(rhs.partitioned_vector_partition_);
+
+            std::scoped_lock l(delta_mtx_, rhs.delta_mtx_);
+            delta_tracker_ = HPX_MOVE(rhs.delta_tracker_);
+        }
+        return *this;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
@@ -209,6 +279,27 @@ namespace hpx { namespace server {
         return result;
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        typename partitioned_vector<T, Data>::range_type
+        partitioned_vector<T, Data>::get_range(
+            size_type first, size_type count) const
+    {
+        if (first > partitioned_vector_partition_.size() ||
+            count > partitioned_vector_partition_.size() - first)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "partitioned_vector::get_range",
+                hpx::util::format(
+                    "invalid range [{}, {}) for a partition of size {}", first,
+                    first + count, partitioned_vector_partition_.size()));
+        }
+
+        range_type result(count);
+        std::copy_n(partitioned_vector_partition_.begin() + first, count,
+            result.data());
+        return result;
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
@@ -264,12 +355,146 @@ namespace hpx { namespace server {
             partitioned_vector_partition_[pos[i]] = val[i];
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::set_range(
+        size_type first, range_type const& val)
+    {
+        if (first > partitioned_vector_partition_.size() ||
+            val.size() > partitioned_vector_partition_.size() - first)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "partitioned_vector::set_range",
+                hpx::util::format(
+                    "invalid range [{}, {}) for a partition of size {}", first,
+                    first + val.size(), partitioned_vector_partition_.size()));
+        }
+
+        std::copy_n(val.data(), val.size(),
+            partitioned_vector_partition_.begin() + first);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector<T, Data>::copy_range(size_type first, size_type count,
+        hpx::id_type const& dest, size_type dest_first) const
+    {
+        return hpx::async<set_range_action>(
+            dest, dest_first, get_range(first, count));
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::clear()
     {
         partitioned_vector_partition_.clear();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // The elements of partitions storing trivially copyable types in a
+        // std::vector are tracked directly, all other partitions are tracked
+        // through their serialized representation.
+        template <typename T, typename Data>
+        struct is_contiguous_partition : std::false_type
+        {
+        };
+
+        template <typename T, typename Allocator>
+        struct is_contiguous_partition<T, std::vector<T, Allocator>>
+          : std::is_trivially_copyable<T>
+        {
+        };
+    }    // namespace detail
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::util::checkpoint_delta
+    partitioned_vector<T, Data>::get_checkpoint_delta(std::size_t block_size)
+    {
+        if (block_size == 0)
+        {
+            block_size = hpx::util::delta_tracker::default_block_size;
+        }
+
+        if constexpr (detail::is_contiguous_partition<T, Data>::value)
+        {
+            std::lock_guard<hpx::lcos::local::mutex> l(delta_mtx_);
+            if (block_size != delta_tracker_.block_size())
+            {
+                delta_tracker_ = hpx::util::delta_tracker(block_size);
+            }
+            return delta_tracker_.save(partitioned_vector_partition_);
+        }
+        else
+        {
+            std::vector<char> data;
+            hpx::util::save_checkpoint_data(
+                data, partitioned_vector_partition_);
+
+            std::lock_guard<hpx::lcos::local::mutex> l(delta_mtx_);
+            if (block_size != delta_tracker_.block_size())
+            {
+                delta_tracker_ = hpx::util::delta_tracker(block_size);
+            }
+            return delta_tracker_.save(data.data(), data.size());
+        }
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::apply_checkpoint_delta(
+        hpx::util::checkpoint_delta const& delta)
+    {
+        // the layout of the partitioned_vector does not allow to change the
+        // size of its partitions
+        if constexpr (detail::is_contiguous_partition<T, Data>::value)
+        {
+            if (delta.size != partitioned_vector_partition_.size() * sizeof(T))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partitioned_vector::apply_checkpoint_delta",
+                    hpx::util::format(
+                        "the size of the partition ({} bytes) does not match "
+                        "the size of the checkpointed data ({} bytes)",
+                        partitioned_vector_partition_.size() * sizeof(T),
+                        delta.size));
+            }
+            std::lock_guard<hpx::lcos::local::mutex> l(delta_mtx_);
+            delta_tracker_.restore(delta, partitioned_vector_partition_);
+        }
+        else
+        {
+            // recreate the serialized representation the delta is based on
+            std::vector<char> data;
+            if (delta.is_full())
+            {
+                data.resize(static_cast<std::size_t>(delta.size));
+            }
+            else
+            {
+                hpx::util::save_checkpoint_data(
+                    data, partitioned_vector_partition_);
+            }
+            {
+                std::lock_guard<hpx::lcos::local::mutex> l(delta_mtx_);
+                delta_tracker_.restore(delta, data.data(), data.size());
+            }
+
+            data_type restored;
+            hpx::util::restore_checkpoint_data(data, restored);
+            if (restored.size() != partitioned_vector_partition_.size())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partitioned_vector::apply_checkpoint_delta",
+                    hpx::util::format(
+                        "the size of the partition ({}) does not match the "
+                        "size of the checkpointed data ({})",
+                        partitioned_vector_partition_.size(),
+                        restored.size()));
+            }
+            partitioned_vector_partition_ = HPX_MOVE(restored);
+        }
+    }
 }}    // namespace hpx::server
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -290,6 +515,12 @@ namespace hpx { namespace server {
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION(type::get_range_action,                                \
+        HPX_PP_CAT(__vector_get_range_action_, name))                          \
+    HPX_REGISTER_ACTION(type::set_range_action,                                \
+        HPX_PP_CAT(__vector_set_range_action_, name))                          \
+    HPX_REGISTER_ACTION(type::copy_range_action,                               \
+        HPX_PP_CAT(__vector_copy_range_action_, name))                         \
     HPX_REGISTER_ACTION(                                                       \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION(                                                       \
@@ -298,6 +529,10 @@ namespace hpx { namespace server {
         HPX_PP_CAT(__vector_get_copied_data_action_, name))                    \
     HPX_REGISTER_ACTION(                                                       \
         type::set_data_action, HPX_PP_CAT(__vector_set_data_action_, name))    \
+    HPX_REGISTER_ACTION(type::get_checkpoint_delta_action,                     \
+        HPX_PP_CAT(__vector_get_checkpoint_delta_action_, name))               \
+    HPX_REGISTER_ACTION(type::apply_checkpoint_delta_action,                   \
+        HPX_PP_CAT(__vector_apply_checkpoint_delta_action_, name))             \
     typedef ::hpx::components::component<type> HPX_PP_CAT(__vector_, name);    \
     HPX_REGISTER_COMPONENT(HPX_PP_CAT(__vector_, name))                        \
     /**/
@@ -435,6 +670,33 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        typename partitioned_vector_partition<T, Data>::server_type::range_type
+        partitioned_vector_partition<T, Data>::get_range(
+            launch::sync_policy, std::size_t first, std::size_t count) const
+    {
+        return get_range(first, count).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<
+        typename partitioned_vector_partition<T, Data>::server_type::range_type>
+    partitioned_vector_partition<T, Data>::get_range(
+        std::size_t first, std::size_t count) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_range_action>(
+            this->get_id(), first, count);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(count);
+        return hpx::make_ready_future(typename server_type::range_type{});
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector_partition<T, Data>::set_value(
@@ -509,6 +771,51 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::set_range(launch::sync_policy,
+        std::size_t first, typename server_type::range_type&& val)
+    {
+        set_range(first, HPX_MOVE(val)).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::set_range(
+        std::size_t first, typename server_type::range_type&& val)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::set_range_action>(
+            this->get_id(), first, HPX_MOVE(val));
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(val);
+        return hpx::make_ready_future();
+#endif
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::copy_range(std::size_t first,
+        std::size_t count, hpx::id_type const& dest,
+        std::size_t dest_first) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::copy_range_action>(
+            this->get_id(), first, count, dest, dest_first);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(count);
+        HPX_UNUSED(dest);
+        HPX_UNUSED(dest_first);
+        return hpx::make_ready_future();
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector_partition<T, Data>::server_type::data_type
@@ -555,6 +862,39 @@ namespace hpx {
         HPX_ASSERT(false);
         HPX_UNUSED(other);
         return hpx::make_ready_future();
+#endif
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        hpx::future<hpx::util::checkpoint_delta>
+        partitioned_vector_partition<T, Data>::get_checkpoint_delta(
+            std::size_t block_size) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_checkpoint_delta_action>(
+            this->get_id(), block_size);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(block_size);
+        return hpx::make_ready_future(hpx::util::checkpoint_delta{});
+#endif
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::apply_checkpoint_delta(
+        hpx::util::checkpoint_delta&& delta) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::apply_checkpoint_delta_action>(
+            this->get_id(), HPX_MOVE(delta));
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(delta);
+        return hpx::make_ready_future();
 #endif
     }
 }    // namespace hpx
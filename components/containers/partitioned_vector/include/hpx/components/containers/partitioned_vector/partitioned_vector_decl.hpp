@@ -182,6 +182,8 @@ namespace hpx {
             partitioned_vector_partition_server;
         typedef hpx::partitioned_vector_partition<T, Data>
             partitioned_vector_partition_client;
+        typedef typename partitioned_vector_partition_server::range_type
+            range_type;
 
         struct partition_data
           : server::partitioned_vector_config_data::partition_data
@@ -714,6 +716,82 @@ namespace hpx {
             return get_values(pos_vec).get();
         }
 
+        /// Asynchronously returns the \a count elements starting at the
+        /// global position \a first in the vector container. The elements
+        /// of each remote partition are transferred as one contiguous block.
+        ///
+        /// \param first Global position of the first element in the vector
+        /// \param count Number of elements to return
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the given range.
+        ///
+        future<std::vector<T>> get_range(
+            size_type first, size_type count) const
+        {
+            HPX_ASSERT(first <= size_ && count <= size_ - first);
+
+            auto result = std::make_shared<std::vector<T>>(count);
+
+            // vector holding futures of the values for all remote blocks
+            std::vector<future<void>> part_futures;
+
+            size_type offset = 0;
+            while (offset != count)
+            {
+                size_type part = get_partition(first + offset);
+                size_type local_first = get_local_index(first + offset);
+
+                partition_data const& part_data = partitions_[part];
+                size_type n = (std::min)(
+                    count - offset, part_data.size_ - local_first);
+
+                if (part_data.local_data_)
+                {
+                    std::copy_n(part_data.local_data_->cbegin() + local_first,
+                        n, result->begin() + offset);
+                }
+                else
+                {
+                    part_futures.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .get_range(local_first, n)
+                            .then([result, offset](future<range_type>&& f) {
+                                range_type values = f.get();
+                                std::copy_n(values.data(), values.size(),
+                                    result->begin() + offset);
+                            }));
+                }
+
+                offset += n;
+            }
+
+            return dataflow(
+                [result](std::vector<future<void>>&& part_futures)
+                    -> std::vector<T> {
+                    // rethrow exceptions, if any
+                    for (future<void>& f : part_futures)
+                        f.get();
+                    return HPX_MOVE(*result);
+                },
+                HPX_MOVE(part_futures));
+        }
+
+        /// Returns the \a count elements starting at the global position
+        /// \a first in the vector container.
+        ///
+        /// \param first Global position of the first element in the vector
+        /// \param count Number of elements to return
+        ///
+        /// \return Returns the values of the elements in the given range.
+        ///
+        std::vector<T> get_range(
+            launch::sync_policy, size_type first, size_type count) const
+        {
+            return get_range(first, count).get();
+        }
+
         // //FRONT (never throws exception)
         // /** @brief Access the value of first element in the vector.
         //  *
@@ -1045,6 +1123,142 @@ namespace hpx {
             return set_values(pos, val).get();
         }
 
+        /// Asynchronously copy the values of \a val to the elements starting
+        /// at the global position \a first. The elements for each remote
+        /// partition are transferred as one contiguous block.
+        ///
+        /// \param first Global position of the first element in the vector
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_range(size_type first, std::vector<T> const& val)
+        {
+            HPX_ASSERT(first <= size_ && val.size() <= size_ - first);
+
+            // vector holding futures of the state for all remote blocks
+            std::vector<future<void>> part_futures;
+
+            size_type offset = 0;
+            while (offset != val.size())
+            {
+                size_type part = get_partition(first + offset);
+                size_type local_first = get_local_index(first + offset);
+
+                partition_data const& part_data = partitions_[part];
+                size_type n = (std::min)(
+                    val.size() - offset, part_data.size_ - local_first);
+
+                if (part_data.local_data_)
+                {
+                    std::copy_n(val.begin() + offset, n,
+                        part_data.local_data_->begin() + local_first);
+                }
+                else
+                {
+                    range_type values(n);
+                    std::copy_n(val.begin() + offset, n, values.data());
+                    part_futures.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .set_range(local_first, HPX_MOVE(values)));
+                }
+
+                offset += n;
+            }
+
+            return dataflow(
+                [](std::vector<future<void>>&& part_futures) -> void {
+                    // rethrow exceptions, if any
+                    for (future<void>& f : part_futures)
+                        f.get();
+                },
+                HPX_MOVE(part_futures));
+        }
+
+        /// Copy the values of \a val to the elements starting at the global
+        /// position \a first.
+        ///
+        /// \param first Global position of the first element in the vector
+        /// \param val   The values to be copied
+        ///
+        void set_range(
+            launch::sync_policy, size_type first, std::vector<T> const& val)
+        {
+            set_range(first, val).get();
+        }
+
+        /// Asynchronously copy the elements in the range [first, last) of
+        /// this vector to the vector \a dest, starting at the global position
+        /// \a dest_first. Each block of elements is sent from the partition
+        /// holding it directly to the destination partition, the elements
+        /// are never routed through the calling locality.
+        ///
+        /// \param first      Global position of the first element to copy
+        /// \param last       Global position after the last element to copy
+        /// \param dest       The vector to copy the elements to
+        /// \param dest_first Global position of the first element in \a dest
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        /// \note The source and destination ranges must not overlap.
+        ///
+        future<void> copy_range(size_type first, size_type last,
+            partitioned_vector& dest, size_type dest_first) const
+        {
+            HPX_ASSERT(first <= last && last <= size_);
+            HPX_ASSERT(dest_first <= dest.size_ &&
+                last - first <= dest.size_ - dest_first);
+
+            // vector holding futures of the state for all blocks
+            std::vector<future<void>> part_futures;
+
+            while (first != last)
+            {
+                size_type part = get_partition(first);
+                size_type local_first = get_local_index(first);
+                size_type dest_part = dest.get_partition(dest_first);
+                size_type dest_local_first = dest.get_local_index(dest_first);
+
+                partition_data const& part_data = partitions_[part];
+                partition_data const& dest_data = dest.partitions_[dest_part];
+
+                // each block is contained in one source and one destination
+                // partition
+                size_type n = (std::min)({last - first,
+                    part_data.size_ - local_first,
+                    dest_data.size_ - dest_local_first});
+
+                if (part_data.local_data_)
+                {
+                    part_futures.push_back(part_data.local_data_->copy_range(
+                        local_first, n, dest_data.partition_,
+                        dest_local_first));
+                }
+                else
+                {
+                    part_futures.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .copy_range(local_first, n, dest_data.partition_,
+                                dest_local_first));
+                }
+
+                first += n;
+                dest_first += n;
+            }
+
+            return dataflow(
+                [](std::vector<future<void>>&& part_futures) -> void {
+                    // rethrow exceptions, if any
+                    for (future<void>& f : part_futures)
+                        f.get();
+                },
+                HPX_MOVE(part_futures));
+        }
+
         // //CLEAR
         // //TODO if number of partitions is kept constant every time then
         // // clear should modified (clear each partitioned_vector_partition
@@ -1304,4 +1518,40 @@ namespace hpx {
             return segment_cend(naming::get_locality_id_from_id(id));
         }
     };
+
+    /// Asynchronously copy the elements in the range [first, last) of a
+    /// partitioned_vector to another partitioned_vector, starting at \a dest.
+    /// The elements are copied segment to segment, each block of elements is
+    /// sent from the partition holding it directly to the destination
+    /// partition.
+    ///
+    /// \return This returns the hpx::future of type void which gets ready
+    ///         once the operation is finished.
+    ///
+    template <typename T, typename Data>
+    future<void> copy_range_async(
+        segmented::const_vector_iterator<T, Data> first,
+        segmented::const_vector_iterator<T, Data> last,
+        segmented::vector_iterator<T, Data> dest)
+    {
+        HPX_ASSERT(first.get_data() == last.get_data());
+        if (first == last)
+            return make_ready_future();
+
+        HPX_ASSERT(dest.get_data());
+        return first.get_data()->copy_range(first.get_global_index(),
+            last.get_global_index(), *dest.get_data(),
+            dest.get_global_index());
+    }
+
+    template <typename T, typename Data>
+    future<void> copy_range_async(segmented::vector_iterator<T, Data> first,
+        segmented::vector_iterator<T, Data> last,
+        segmented::vector_iterator<T, Data> dest)
+    {
+        using const_iterator = segmented::const_vector_iterator<T, Data>;
+        return copy_range_async(
+            const_iterator(first.get_data(), first.get_global_index()),
+            const_iterator(last.get_data(), last.get_global_index()), dest);
+    }
 }    // namespace hpx
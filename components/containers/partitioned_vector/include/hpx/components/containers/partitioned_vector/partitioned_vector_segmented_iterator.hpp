@@ -81,6 +81,17 @@ namespace hpx { namespace segmented {
                 local_index, data_);
         }
 
+        // Return the executor the memory of this partition is bound to. This
+        // is available only if the partition's allocator exposes its
+        // execution policy (e.g. hpx::compute::host::block_allocator).
+        template <typename Data_ = Data>
+        auto get_executor() const -> std::decay_t<decltype(
+            std::declval<Data_ const&>().get_allocator().policy().executor())>
+        {
+            HPX_ASSERT(data_);
+            return data_->get_data().get_allocator().policy().executor();
+        }
+
     private:
         std::shared_ptr<server::partitioned_vector<T, Data>> data_;
     };
@@ -131,6 +142,17 @@ namespace hpx { namespace segmented {
                 local_index, data_);
         }
 
+        // Return the executor the memory of this partition is bound to. This
+        // is available only if the partition's allocator exposes its
+        // execution policy (e.g. hpx::compute::host::block_allocator).
+        template <typename Data_ = Data>
+        auto get_executor() const -> std::decay_t<decltype(
+            std::declval<Data_ const&>().get_allocator().policy().executor())>
+        {
+            HPX_ASSERT(data_);
+            return data_->get_data().get_allocator().policy().executor();
+        }
+
     private:
         std::shared_ptr<server::partitioned_vector<T, Data>> data_;
     };
@@ -0,0 +1,97 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/checkpoint.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// partitioned_vector<double> and partitioned_vector<std::string> are
+// predefined in the partitioned_vector module
+
+using hpx::util::checkpoint;
+using hpx::util::restore_checkpoint_delta;
+using hpx::util::save_checkpoint_delta;
+
+template <typename T>
+void test_equal(hpx::partitioned_vector<T> const& lhs,
+    hpx::partitioned_vector<T> const& rhs)
+{
+    HPX_TEST_EQ(lhs.size(), rhs.size());
+    for (std::size_t i = 0; i != lhs.size(); ++i)
+    {
+        HPX_TEST_EQ(lhs.get_value(hpx::launch::sync, i),
+            rhs.get_value(hpx::launch::sync, i));
+    }
+}
+
+template <typename T, typename F>
+void test_checkpoint_delta(std::size_t size, std::size_t block_size, F make)
+{
+    auto layout = hpx::container_layout(4, hpx::find_all_localities());
+
+    hpx::partitioned_vector<T> v(size, layout);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v.set_value(hpx::launch::sync, i, make(i));
+    }
+
+    // the first checkpoint contains all elements
+    std::vector<checkpoint> chain;
+    chain.push_back(save_checkpoint_delta(v, block_size).get());
+
+    // modify the first and the last element only
+    v.set_value(hpx::launch::sync, 0, make(size));
+    v.set_value(hpx::launch::sync, size - 1, make(size + 1));
+    chain.push_back(save_checkpoint_delta(v, block_size).get());
+    HPX_TEST(chain[1].size() < chain[0].size());
+
+    // nothing has changed
+    chain.push_back(save_checkpoint_delta(v, block_size).get());
+    HPX_TEST(chain[2].size() <= chain[1].size());
+
+    // restore the whole sequence into a vector with the same layout
+    hpx::partitioned_vector<T> restored(size, layout);
+    restore_checkpoint_delta(chain, restored);
+    test_equal(v, restored);
+
+    // the restored vector continues the sequence
+    v.set_value(hpx::launch::sync, size / 2, make(size + 2));
+    checkpoint next = save_checkpoint_delta(v, block_size).get();
+    restore_checkpoint_delta(next, restored);
+    test_equal(v, restored);
+
+    // checkpoints have to be restored in sequence
+    hpx::partitioned_vector<T> other(size, layout);
+    HPX_TEST_THROW(restore_checkpoint_delta(chain[1], other), hpx::exception);
+
+    // the layout of the vector has to match the checkpoint
+    hpx::partitioned_vector<T> different(
+        size, hpx::container_layout(2, hpx::find_all_localities()));
+    HPX_TEST_THROW(
+        restore_checkpoint_delta(chain[0], different), hpx::exception);
+}
+
+int main()
+{
+    test_checkpoint_delta<double>(
+        10000, 1024, [](std::size_t i) { return static_cast<double>(i); });
+
+    test_checkpoint_delta<std::string>(
+        1000, 256, [](std::size_t i) { return std::to_string(i); });
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,140 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// partitioned_vector<double> and partitioned_vector<std::string> are
+// predefined in the partitioned_vector module
+
+template <typename T, typename F>
+void test_range(std::size_t size, F make)
+{
+    auto layout = hpx::container_layout(4, hpx::find_all_localities());
+
+    hpx::partitioned_vector<T> v(size, layout);
+
+    // fill the whole vector at once
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values.push_back(make(i));
+    }
+    v.set_range(hpx::launch::sync, 0, values);
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), values[i]);
+    }
+
+    // read a range spanning several partitions
+    std::size_t const first = size / 8;
+    std::size_t const count = size / 2;
+    std::vector<T> range = v.get_range(hpx::launch::sync, first, count);
+    HPX_TEST_EQ(range.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(range[i], values[first + i]);
+    }
+
+    // empty ranges are allowed
+    HPX_TEST(v.get_range(hpx::launch::sync, size, 0).empty());
+
+    // copy a range into another vector using a different layout, the
+    // destination blocks do not line up with the source blocks
+    hpx::partitioned_vector<T> dest(
+        size, hpx::container_layout(3, hpx::find_all_localities()));
+    v.copy_range(first, first + count, dest, size / 4).get();
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(dest.get_value(hpx::launch::sync, size / 4 + i),
+            values[first + i]);
+    }
+
+    // copy the whole vector using iterators
+    hpx::partitioned_vector<T> copy(size, layout);
+    hpx::copy_range_async(v.begin(), v.end(), copy.begin()).get();
+    HPX_TEST(copy.get_range(hpx::launch::sync, 0, size) == values);
+
+    // accessing elements beyond the end of a partition is an error
+    hpx::partitioned_vector_partition<T, std::vector<T>> partition(
+        v.segment_begin()->get_id());
+    HPX_TEST_THROW(
+        partition.get_range(hpx::launch::sync, 0, size + 1), hpx::exception);
+}
+
+// copy between two vectors which are both placed on remote localities only,
+// such that each block is copied from one remote partition to another
+template <typename T, typename F>
+void test_remote_copy_range(std::size_t size, F make)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    if (localities.empty())
+        return;
+
+    hpx::partitioned_vector<T> v(size, hpx::container_layout(4, localities));
+
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values.push_back(make(i));
+    }
+    v.set_range(hpx::launch::sync, 0, values);
+    HPX_TEST(v.get_range(hpx::launch::sync, 0, size) == values);
+
+    // the destination partitions are shifted against the source partitions,
+    // each destination block straddles the boundary of two source partitions
+    hpx::partitioned_vector<T> dest(
+        size, hpx::container_layout(5, localities));
+
+    std::size_t const first = size / 16;
+    std::size_t const count = size - size / 8;
+    std::size_t const dest_first = size / 32;
+    v.copy_range(first, first + count, dest, dest_first).get();
+
+    std::vector<T> result =
+        dest.get_range(hpx::launch::sync, dest_first, count);
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], values[first + i]);
+    }
+
+    // the elements outside of the copied range are left untouched
+    HPX_TEST_EQ(dest.get_value(hpx::launch::sync, dest_first - 1), T());
+    HPX_TEST_EQ(dest.get_value(hpx::launch::sync, dest_first + count), T());
+}
+
+int main()
+{
+    test_range<double>(
+        10000, [](std::size_t i) { return static_cast<double>(i); });
+
+    test_range<std::string>(
+        1000, [](std::size_t i) { return std::to_string(i); });
+
+    test_remote_copy_range<double>(
+        10000, [](std::size_t i) { return static_cast<double>(i + 1); });
+
+    test_remote_copy_range<std::string>(
+        1000, [](std::size_t i) { return std::to_string(i + 1); });
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -28,17 +28,20 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -50,25 +53,83 @@ namespace hpx { namespace server {
     ///
     /// This contain the implementation of the partition_unordered_map's
     /// component functionality.
+    ///
+    /// All actions exposed by this component are direct actions, i.e. they
+    /// are executed concurrently on the threads delivering the parcels. The
+    /// elements are therefore stored in a number of independently locked
+    /// stripes, each of which is a std::unordered_map holding the keys hashing
+    /// to it.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        struct stripe
+        {
+            mutable mutex_type mtx_;
+            data_type data_;
+        };
+        typedef util::cache_aligned_data<stripe> stripe_type;
+
+        static constexpr int stripe_bits = 5;
+        static constexpr std::size_t num_stripes = std::size_t(1)
+            << stripe_bits;
+
+        Hash hash_;
+        std::unique_ptr<stripe_type[]> stripes_;
+
+        // The client distributes the keys over the partitions using the
+        // remainder of their hash value, all keys stored in this partition
+        // have the same remainder. Use the upper bits of the (mixed) hash
+        // value to select the stripe instead.
+        stripe& get_stripe(Key const& key) const
+        {
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(hash_(key)) * 0x9e3779b97f4a7c15ull;
+            return stripes_[static_cast<std::size_t>(h >> (64 - stripe_bits))]
+                .data_;
+        }
+
+        void init_stripes(size_type bucket_count, Hash const& hash,
+            KeyEqual const& equal)
+        {
+            stripes_.reset(new stripe_type[num_stripes]);
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripes_[i].data_.data_ = data_type(
+                    (bucket_count + num_stripes - 1) / num_stripes, hash,
+                    equal);
+            }
+        }
+
+        void assign(data_type const& d)
+        {
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe& s = stripes_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.data_.clear();
+            }
+            for (auto const& v : d)
+            {
+                stripe& s = get_stripe(v.first);
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.data_.insert(v);
+            }
+        }
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -77,24 +138,30 @@ namespace hpx { namespace server {
 
         /// Default Constructor which create partition_unordered_map
         /// with size 0.
-        partition_unordered_map() {}
+        partition_unordered_map()
+        {
+            init_stripes(0, Hash(), KeyEqual());
+        }
 
         explicit partition_unordered_map(size_type bucket_count)
-          : partition_unordered_map_(bucket_count)
         {
+            init_stripes(bucket_count, Hash(), KeyEqual());
         }
 
         partition_unordered_map(
             size_type bucket_count, Hash const& hash, KeyEqual const& equal)
-          : partition_unordered_map_(bucket_count, hash, equal)
+          : hash_(hash)
         {
+            init_stripes(bucket_count, hash, equal);
         }
 
         // support components::copy
         partition_unordered_map(partition_unordered_map const& rhs)
           : base_type(rhs)
-          , partition_unordered_map_(rhs.partition_unordered_map_)
+          , hash_(rhs.hash_)
         {
+            init_stripes(0, rhs.hash_, rhs.stripes_[0].data_.data_.key_eq());
+            assign(rhs.get_copied_data());
         }
 
         partition_unordered_map& operator=(partition_unordered_map const& rhs)
@@ -102,14 +169,15 @@ namespace hpx { namespace server {
             if (this != &rhs)
             {
                 this->base_type::operator=(rhs);
-                partition_unordered_map_ = rhs.partition_unordered_map_;
+                assign(rhs.get_copied_data());
             }
             return *this;
         }
 
         partition_unordered_map(partition_unordered_map&& rhs)
           : base_type(HPX_MOVE(rhs))
-          , partition_unordered_map_(HPX_MOVE(rhs.partition_unordered_map_))
+          , hash_(HPX_MOVE(rhs.hash_))
+          , stripes_(HPX_MOVE(rhs.stripes_))
         {
         }
 
@@ -118,8 +186,8 @@ namespace hpx { namespace server {
             if (this != &rhs)
             {
                 this->base_type::operator=(HPX_MOVE(rhs));
-                partition_unordered_map_ =
-                    HPX_MOVE(rhs.partition_unordered_map_);
+                hash_ = HPX_MOVE(rhs.hash_);
+                stripes_ = HPX_MOVE(rhs.stripes_);
             }
             return *this;
         }
@@ -127,38 +195,18 @@ namespace hpx { namespace server {
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            data_type result(0, hash_, stripes_[0].data_.data_.key_eq());
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe const& s = stripes_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result.insert(s.data_.begin(), s.data_.end());
+            }
+            return result;
         }
         void set_copied_data(data_type&& d)
         {
-            partition_unordered_map_ = HPX_MOVE(d);
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            assign(d);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -168,27 +216,26 @@ namespace hpx { namespace server {
         /// Returns the number of elements
         size_type size() const
         {
-            return partition_unordered_map_.size();
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe const& s = stripes_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.data_.size();
+            }
+            return result;
         }
 
         /// Returns the maximum possible number of elements
         size_type max_size() const
         {
-            return partition_unordered_map_.max_size();
-        }
-
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
+            return stripes_[0].data_.data_.max_size();
         }
 
-        /// Checks if the container has no elements, i.e. whether
-        /// begin() == end().
+        /// Checks if the container has no elements
         bool empty() const
         {
-            return partition_unordered_map_.empty();
+            return size() == 0;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -203,27 +250,13 @@ namespace hpx { namespace server {
         /// \return Return the value of the element at position represented
         ///         by \a pos.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m)
-              , it_(it)
-            {
-            }
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            stripe& s = get_stripe(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            typename data_type::iterator it = s.data_.find(key);
+            if (it == s.data_.end())
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
@@ -234,8 +267,9 @@ namespace hpx { namespace server {
             if (!erase)
                 return it->second;
 
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            T result = HPX_MOVE(it->second);
+            s.data_.erase(it);
+            return result;
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -253,15 +287,16 @@ namespace hpx { namespace server {
 
             for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                stripe& s = get_stripe(keys[i]);
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                typename data_type::iterator it = s.data_.find(keys[i]);
+                if (it == s.data_.end())
                 {
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "partition_unordered_map::get_values",
                         "unable to find requested key in this partition of the "
                         "unordered_map");
-                    break;
                 }
                 result.push_back(it->second);
             }
@@ -281,7 +316,9 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            stripe& s = get_stripe(pos);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            s.data_[pos] = val;
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -294,10 +331,13 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+            {
+                stripe& s = get_stripe(keys[i]);
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.data_[keys[i]] = val[i];
+            }
         }
 
         /// Remove all elements from the vector leaving the
@@ -305,13 +345,20 @@ namespace hpx { namespace server {
         ///
         void clear()
         {
-            partition_unordered_map_.clear();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe& s = stripes_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.data_.clear();
+            }
         }
 
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
-            return partition_unordered_map_.erase(key);
+            stripe& s = get_stripe(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.data_.erase(key);
         }
 
         /// Macros to define HPX component actions for all exported functions.
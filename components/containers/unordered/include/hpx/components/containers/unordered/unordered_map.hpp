@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -800,6 +801,150 @@ namespace hpx {
                 .set_value(pos, HPX_FORWARD(T_, val));
         }
 
+        /// Asynchronously returns the elements with the given keys. The keys
+        /// are routed to their partitions in one pass, each partition is
+        /// accessed at most once.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements
+        ///         with the given keys, in the order of \a keys.
+        ///
+        future<std::vector<T>> get_values(std::vector<Key> const& keys) const
+        {
+            // the keys and their original positions for each partition
+            std::vector<std::vector<Key>> part_keys(partitions_.size());
+            std::vector<std::vector<std::size_t>> part_pos(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_pos[part].push_back(i);
+            }
+
+            auto result = std::make_shared<std::vector<T>>(keys.size());
+
+            // vector holding futures of the values for all remote partitions
+            std::vector<future<void>> part_futures;
+
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    std::vector<T> values =
+                        part_data.local_data_->get_values(part_keys[part]);
+                    for (std::size_t i = 0; i != values.size(); ++i)
+                        (*result)[part_pos[part][i]] = HPX_MOVE(values[i]);
+                }
+                else
+                {
+                    part_futures.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .get_values(part_keys[part])
+                            .then([result, pos = HPX_MOVE(part_pos[part])](
+                                      future<std::vector<T>>&& f) {
+                                std::vector<T> values = f.get();
+                                for (std::size_t i = 0; i != values.size();
+                                     ++i)
+                                {
+                                    (*result)[pos[i]] = HPX_MOVE(values[i]);
+                                }
+                            }));
+                }
+            }
+
+            return hpx::when_all(part_futures)
+                .then([result](future<std::vector<future<void>>>&& f)
+                          -> std::vector<T> {
+                    // rethrow exceptions, if any
+                    for (future<void>& part_future : f.get())
+                        part_future.get();
+                    return HPX_MOVE(*result);
+                });
+        }
+
+        /// Returns the elements with the given keys.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements with the given keys,
+        ///         in the order of \a keys.
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously copy the values of \a vals to the elements with the
+        /// given keys. The keys are routed to their partitions in one pass,
+        /// each partition is accessed at most once.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<Key>> part_keys(partitions_.size());
+            std::vector<std::vector<T>> part_vals(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_vals[part].push_back(vals[i]);
+            }
+
+            // vector holding futures of the state for all remote partitions
+            std::vector<future<void>> part_futures;
+
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->set_values(
+                        part_keys[part], part_vals[part]);
+                }
+                else
+                {
+                    part_futures.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .set_values(part_keys[part], part_vals[part]));
+                }
+            }
+
+            return hpx::when_all(part_futures)
+                .then([](future<std::vector<future<void>>>&& f) -> void {
+                    // rethrow exceptions, if any
+                    for (future<void>& part_future : f.get())
+                        part_future.get();
+                });
+        }
+
+        /// Copy the values of \a vals to the elements with the given keys.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
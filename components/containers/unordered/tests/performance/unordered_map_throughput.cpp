@@ -0,0 +1,213 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the insert and lookup throughput of a distributed
+// hpx::unordered_map. Every locality runs a number of tasks which
+// concurrently insert (and later look up) their own set of keys. Most of the
+// keys are stored in partitions on other localities, so all partitions see
+// concurrent remote accesses. The elements are accessed either one by one or
+// in batches of the given size.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double)
+
+typedef hpx::unordered_map<std::uint64_t, double> map_type;
+
+char const* const map_name = "/unordered_map_throughput/map";
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t first_key(std::uint64_t elements, std::uint64_t num_tasks,
+    std::uint64_t task)
+{
+    return (hpx::get_locality_id() * num_tasks + task) * elements;
+}
+
+void insert_keys(map_type& m, std::uint64_t first, std::uint64_t elements,
+    std::uint64_t batch)
+{
+    if (batch == 0)
+    {
+        for (std::uint64_t i = 0; i != elements; ++i)
+        {
+            m.set_value(hpx::launch::sync, first + i, double(i));
+        }
+        return;
+    }
+
+    std::vector<std::uint64_t> keys;
+    std::vector<double> values;
+    for (std::uint64_t i = 0; i != elements; ++i)
+    {
+        keys.push_back(first + i);
+        values.push_back(double(i));
+        if (keys.size() == batch || i + 1 == elements)
+        {
+            m.set_values(hpx::launch::sync, keys, values);
+            keys.clear();
+            values.clear();
+        }
+    }
+}
+
+void lookup_keys(map_type const& m, std::uint64_t first,
+    std::uint64_t elements, std::uint64_t batch)
+{
+    if (batch == 0)
+    {
+        for (std::uint64_t i = 0; i != elements; ++i)
+        {
+            HPX_TEST_EQ(m.get_value(hpx::launch::sync, first + i), double(i));
+        }
+        return;
+    }
+
+    std::vector<std::uint64_t> keys;
+    for (std::uint64_t i = 0; i != elements; ++i)
+    {
+        keys.push_back(first + i);
+        if (keys.size() == batch || i + 1 == elements)
+        {
+            std::vector<double> values = m.get_values(hpx::launch::sync, keys);
+            HPX_TEST_EQ(values.size(), keys.size());
+            keys.clear();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_phase(bool insert, std::uint64_t elements, std::uint64_t num_tasks,
+    std::uint64_t batch)
+{
+    map_type m;
+    m.connect_to(map_name).get();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::uint64_t t = 0; t != num_tasks; ++t)
+    {
+        std::uint64_t first = first_key(elements, num_tasks, t);
+        if (insert)
+        {
+            tasks.push_back(
+                hpx::async(&insert_keys, std::ref(m), first, elements, batch));
+        }
+        else
+        {
+            tasks.push_back(hpx::async(
+                &lookup_keys, std::cref(m), first, elements, batch));
+        }
+    }
+    hpx::wait_all(tasks);
+}
+HPX_PLAIN_ACTION(run_phase, run_phase_action)
+
+///////////////////////////////////////////////////////////////////////////////
+double time_phase(std::vector<hpx::id_type> const& localities, bool insert,
+    std::uint64_t elements, std::uint64_t num_tasks, std::uint64_t batch)
+{
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> phases;
+    phases.reserve(localities.size());
+    for (hpx::id_type const& id : localities)
+    {
+        phases.push_back(hpx::async<run_phase_action>(
+            id, insert, elements, num_tasks, batch));
+    }
+    hpx::wait_all(phases);
+
+    return t.elapsed();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const elements = vm["elements"].as<std::uint64_t>();
+    std::uint64_t const num_tasks = vm["tasks"].as<std::uint64_t>();
+    std::uint64_t const batch = vm["batch"].as<std::uint64_t>();
+    std::uint64_t const partitions = vm["partitions"].as<std::uint64_t>();
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    {
+        map_type m(hpx::container_layout(
+            partitions * localities.size(), localities));
+        m.register_as(map_name).get();
+
+        double const insert_time =
+            time_phase(localities, true, elements, num_tasks, batch);
+        double const lookup_time =
+            time_phase(localities, false, elements, num_tasks, batch);
+
+        double const total = double(elements * num_tasks * localities.size());
+        HPX_TEST_EQ(m.size(), std::size_t(total));
+
+        if (vm.count("csv") != 0)
+        {
+            std::cout << localities.size() << ","
+                      << hpx::get_os_thread_count() << "," << batch << ","
+                      << total << "," << total / insert_time << ","
+                      << total / lookup_time << "\n";
+        }
+        else
+        {
+            std::cout << "inserted " << total << " elements in "
+                      << insert_time << " s (" << total / insert_time
+                      << " ops/s), looked up " << total << " elements in "
+                      << lookup_time << " s (" << total / lookup_time
+                      << " ops/s) using " << localities.size()
+                      << " localities, batch size " << batch << "\n";
+        }
+        hpx::util::print_cdash_timing("UnorderedMapInsert", insert_time);
+        hpx::util::print_cdash_timing("UnorderedMapLookup", lookup_time);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("elements", value<std::uint64_t>()->default_value(10000),
+         "number of elements each task inserts and looks up")
+        ("tasks", value<std::uint64_t>()->default_value(8),
+         "number of concurrent tasks on each locality")
+        ("batch", value<std::uint64_t>()->default_value(0),
+         "number of elements accessed at once (0: access elements one by one)")
+        ("partitions", value<std::uint64_t>()->default_value(4),
+         "number of partitions on each locality")
+        ("csv", "output results as csv "
+         "(format: localities,threads,batch,count,inserts/s,lookups/s)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
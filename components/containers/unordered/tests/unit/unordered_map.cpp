@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/include/traits.hpp>
 #include <hpx/include/unordered_map.hpp>
@@ -112,6 +113,59 @@ void trivial_tests(DistPolicy const& policy)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename DistPolicy>
+void batch_tests(DistPolicy const& policy)
+{
+    std::size_t const count = 1000;
+    std::size_t const num_tasks = 8;
+
+    hpx::unordered_map<Key, Value> m(policy);
+
+    // insert elements concurrently
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&, t]() {
+            for (std::size_t i = t; i < count; i += num_tasks)
+            {
+                m.set_value(hpx::launch::sync, std::to_string(i), Value(i));
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+    HPX_TEST_EQ(m.size(), count);
+
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        values.push_back(Value(i + 1));
+    }
+
+    std::vector<Value> result = m.get_values(hpx::launch::sync, keys);
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], Value(i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), count);
+    HPX_TEST(m.get_values(hpx::launch::sync, keys) == values);
+
+    // accessing non-existing keys is an error
+    HPX_TEST_THROW(m.get_values(hpx::launch::sync, std::vector<Key>{"none"}),
+        hpx::exception);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(m.erase(hpx::launch::sync, keys[i]), std::size_t(1));
+    }
+    HPX_TEST_EQ(m.size(), std::size_t(0));
+}
+
 template <typename Key, typename Value>
 void trivial_tests()
 {
@@ -164,6 +218,8 @@ int main()
     trivial_tests<std::string, double>(hpx::container_layout(3, localities));
     trivial_tests<std::string, double>(hpx::container_layout(localities));
 
+    batch_tests<std::string, double>(hpx::container_layout(3, localities));
+
     return 0;
 }
 #endif
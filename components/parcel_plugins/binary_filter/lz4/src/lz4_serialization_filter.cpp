@@ -0,0 +1,193 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/parcelset/adaptive_compression.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#include <lz4.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        // the first byte of each message tells how the data was stored
+        constexpr int stored = 0;
+        constexpr int compressed = 1;
+
+        hpx::parcelset::adaptive_compression& compression_policy()
+        {
+            static hpx::parcelset::adaptive_compression policy;
+            return policy;
+        }
+
+        // lz4 keeps its state on the stack otherwise, which is too large for
+        // the stacks of HPX threads
+        void* compression_state()
+        {
+            thread_local std::unique_ptr<char[]> state(
+                new char[LZ4_sizeofState()]);
+            return state.get();
+        }
+    }    // namespace
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        if (buffer[0] == compressed)
+        {
+            buffer_.resize(buffer_size);
+            int const decompressed = LZ4_decompress_safe(buffer + 1,
+                buffer_.data(), static_cast<int>(size - 1),
+                static_cast<int>(buffer_size));
+            if (decompressed < 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::init_data",
+                    "decompression failure, archive data bstream is corrupt");
+                return 0;
+            }
+
+            data_ = buffer_.data();
+            size_ = static_cast<std::size_t>(decompressed);
+        }
+        else
+        {
+            // the data was sent uncompressed, load it directly
+            data_ = buffer + 1;
+            size_ = size - 1;
+        }
+
+        current_ = 0;
+        return buffer_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > size_)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, data_ + current_, dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        written = 0;
+
+        // flush is called again with a larger buffer if the data did not fit,
+        // decide only once whether to compress it
+        std::size_t const size = buffer_.size();
+        if (method_ == -1)
+        {
+            // lz4 can't compress buffers larger than LZ4_MAX_INPUT_SIZE
+            bool const compress =
+                size <= static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE) &&
+                compression_policy().should_compress(size);
+            method_ = compress ? compressed : stored;
+        }
+
+        char* dst_begin = static_cast<char*>(dst);
+        if (method_ == compressed)
+        {
+            // make sure we have enough memory
+            std::size_t const needed =
+                1 + static_cast<std::size_t>(
+                        LZ4_compressBound(static_cast<int>(size)));
+            if (needed > dst_count)
+            {
+                return false;
+            }
+
+            int const compressed_size =
+                LZ4_compress_fast_extState(compression_state(), buffer_.data(),
+                    dst_begin + 1, static_cast<int>(size),
+                    static_cast<int>(needed - 1), 1);
+            if (compressed_size <= 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::flush",
+                    "compression failure, flushing did not reach end of data");
+                return false;
+            }
+
+            if (compression_policy().accept(
+                    size, static_cast<std::size_t>(compressed_size)))
+            {
+                dst_begin[0] = compressed;
+                written = 1 + static_cast<std::size_t>(compressed_size);
+                return true;
+            }
+
+            // compressing did not pay off, send the data as is
+            method_ = stored;
+        }
+
+        if (1 + size > dst_count)
+        {
+            return false;
+        }
+
+        dst_begin[0] = stored;
+        if (size != 0)
+        {
+            std::memcpy(dst_begin + 1, buffer_.data(), size);
+        }
+        written = 1 + size;
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
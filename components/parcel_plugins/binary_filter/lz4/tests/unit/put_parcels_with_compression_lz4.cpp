@@ -0,0 +1,16 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/include/compression_lz4.hpp>
+
+#define HPX_ACTION_USES_TEST_COMPRESSION(action)                               \
+    HPX_ACTION_USES_LZ4_COMPRESSION(action)
+
+#include "../../../tests/put_parcels_with_adaptive_compression.hpp"
+#endif
@@ -0,0 +1,209 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/parcelset/adaptive_compression.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#include <zstd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        // the first byte of each message tells how the data was stored
+        constexpr int stored = 0;
+        constexpr int compressed = 1;
+
+        hpx::parcelset::adaptive_compression& compression_policy()
+        {
+            static hpx::parcelset::adaptive_compression policy;
+            return policy;
+        }
+
+        // the contexts are reused to avoid allocating them for each message
+        struct context_deleter
+        {
+            void operator()(ZSTD_CCtx* ctx) const noexcept
+            {
+                ZSTD_freeCCtx(ctx);
+            }
+
+            void operator()(ZSTD_DCtx* ctx) const noexcept
+            {
+                ZSTD_freeDCtx(ctx);
+            }
+        };
+
+        ZSTD_CCtx* compression_context()
+        {
+            thread_local std::unique_ptr<ZSTD_CCtx, context_deleter> ctx(
+                ZSTD_createCCtx());
+            return ctx.get();
+        }
+
+        ZSTD_DCtx* decompression_context()
+        {
+            thread_local std::unique_ptr<ZSTD_DCtx, context_deleter> ctx(
+                ZSTD_createDCtx());
+            return ctx.get();
+        }
+
+        // favor speed over compression ratio
+        constexpr int compression_level = 1;
+    }    // namespace
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        if (buffer[0] == compressed)
+        {
+            buffer_.resize(buffer_size);
+            std::size_t const decompressed =
+                ZSTD_decompressDCtx(decompression_context(), buffer_.data(),
+                    buffer_size, buffer + 1, size - 1);
+            if (ZSTD_isError(decompressed))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::init_data",
+                    "decompression failure, archive data bstream is corrupt");
+                return 0;
+            }
+
+            data_ = buffer_.data();
+            size_ = decompressed;
+        }
+        else
+        {
+            // the data was sent uncompressed, load it directly
+            data_ = buffer + 1;
+            size_ = size - 1;
+        }
+
+        current_ = 0;
+        return buffer_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > size_)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, data_ + current_, dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        written = 0;
+
+        // flush is called again with a larger buffer if the data did not fit,
+        // decide only once whether to compress it
+        std::size_t const size = buffer_.size();
+        if (method_ == -1)
+        {
+            bool const compress = compression_policy().should_compress(size);
+            method_ = compress ? compressed : stored;
+        }
+
+        char* dst_begin = static_cast<char*>(dst);
+        if (method_ == compressed)
+        {
+            // make sure we have enough memory
+            std::size_t const needed = 1 + ZSTD_compressBound(size);
+            if (needed > dst_count)
+            {
+                return false;
+            }
+
+            std::size_t const compressed_size =
+                ZSTD_compressCCtx(compression_context(), dst_begin + 1,
+                    needed - 1, buffer_.data(), size, compression_level);
+            if (ZSTD_isError(compressed_size))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::flush",
+                    "compression failure, flushing did not reach end of data");
+                return false;
+            }
+
+            if (compression_policy().accept(size, compressed_size))
+            {
+                dst_begin[0] = compressed;
+                written = 1 + compressed_size;
+                return true;
+            }
+
+            // compressing did not pay off, send the data as is
+            method_ = stored;
+        }
+
+        if (1 + size > dst_count)
+        {
+            return false;
+        }
+
+        dst_begin[0] = stored;
+        if (size != 0)
+        {
+            std::memcpy(dst_begin + 1, buffer_.data(), size);
+        }
+        written = 1 + size;
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
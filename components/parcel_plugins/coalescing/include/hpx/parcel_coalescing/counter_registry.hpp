@@ -50,6 +50,8 @@ namespace hpx::plugins::parcel {
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
+            get_counter_type num_messages_parameter;
+            get_counter_type interval_parameter;
             std::int64_t min_boundary, max_boundary, num_buckets;
         };
 
@@ -65,7 +67,9 @@ namespace hpx::plugins::parcel {
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
             get_counter_values_creator_type
-                time_between_parcels_histogram_creator);
+                time_between_parcels_histogram_creator,
+            get_counter_type num_messages_parameter,
+            get_counter_type interval_parameter);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -73,6 +77,10 @@ namespace hpx::plugins::parcel {
             std::string const& name) const;
         get_counter_type get_average_time_between_parcels_counter(
             std::string const& name) const;
+        get_counter_type get_num_messages_parameter_counter(
+            std::string const& name) const;
+        get_counter_type get_interval_parameter_counter(
+            std::string const& name) const;
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
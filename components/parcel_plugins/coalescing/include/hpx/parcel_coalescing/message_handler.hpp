@@ -63,6 +63,10 @@ namespace hpx::plugins::parcel {
             std::int64_t num_buckets,
             hpx::function<std::vector<std::int64_t>(bool)>& result);
 
+        // currently used coalescing parameters
+        std::int64_t get_num_messages_parameter(bool reset);
+        std::int64_t get_interval_parameter(bool reset);
+
         // register the given action
         static void register_action(char const* action, error_code& ec);
 
@@ -74,6 +78,10 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_max_latency();
+
+        void update_arrival_rate(std::int64_t time_since_last_parcel);
+        void adapt_parameters();
 
     private:
         mutable mutex_type mtx_;
@@ -86,6 +94,21 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // In adaptive mode the number of parcels to coalesce and the flush
+        // interval are derived from the observed parcel arrival rate and
+        // the time the parcelport needs to send a message, such that no
+        // parcel is delayed by more than max_latency_ (in microseconds).
+        // The configured number of messages and interval act as upper
+        // bounds.
+        bool adaptive_;
+        std::size_t max_num_coalesced_parcels_;
+        std::size_t max_interval_;
+        std::size_t max_latency_;
+        double average_arrival_time_;    // ns, moving average
+        double average_send_time_;       // ns, moving average
+        std::int64_t last_sending_time_;
+        std::int64_t last_messages_sent_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -23,6 +23,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -41,6 +42,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      max_latency = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +52,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "max_latency = 100";
         }
     };
 }    // namespace hpx::traits
@@ -84,19 +89,46 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_max_latency(std::size_t max_latency)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.max_latency",
+                max_latency));
+        }
+
+        // weight of the most recent sample in the moving averages
+        constexpr double moving_average_weight = 1.0 / 8;
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_num_coalesced_parcels_ =
+            detail::get_num_messages(max_num_coalesced_parcels_);
+        if (!adaptive_ || num_coalesced_parcels_ > max_num_coalesced_parcels_)
+            num_coalesced_parcels_ = max_num_coalesced_parcels_;
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        max_interval_ = detail::get_interval(max_interval_);
+        if (!adaptive_ || interval_ > max_interval_)
+            interval_ = max_interval_;
+    }
+
+    void coalescing_message_handler::update_max_latency()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        max_latency_ = detail::get_max_latency(max_latency_);
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -114,6 +146,14 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , max_num_coalesced_parcels_(num_coalesced_parcels_)
+      , max_interval_(interval_)
+      , max_latency_(detail::get_max_latency(interval_))
+      , average_arrival_time_(0)
+      , average_send_time_(0)
+      , last_sending_time_(0)
+      , last_messages_sent_(0)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -127,6 +167,10 @@ namespace hpx::plugins::parcel {
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
     {
+        // never hold back parcels longer than allowed
+        if (adaptive_)
+            interval_ = (std::min)(interval_, max_latency_);
+
         // register performance counter functions
         coalescing_counter_registry::instance().register_action(action_name,
             util::bind_front(
@@ -141,7 +185,11 @@ namespace hpx::plugins::parcel {
                 this),
             util::bind_front(&coalescing_message_handler::
                                  get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            util::bind_front(
+                &coalescing_message_handler::get_num_messages_parameter, this),
+            util::bind_front(
+                &coalescing_message_handler::get_interval_parameter, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -150,6 +198,9 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.max_latency",
+            util::bind(&coalescing_message_handler::update_max_latency, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -167,6 +218,8 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        update_arrival_rate(time_since_last_parcel);
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
@@ -175,6 +228,9 @@ namespace hpx::plugins::parcel {
             (buffer_.empty() &&
                 std::chrono::nanoseconds(time_since_last_parcel) > interval))
         {
+            // parcels arriving slowly have to update the parameters as well
+            adapt_parameters();
+
             ++num_messages_;
             l.unlock();
 
@@ -274,6 +330,8 @@ namespace hpx::plugins::parcel {
         if (buffer_.empty())
             return false;
 
+        adapt_parameters();
+
         detail::message_buffer buff(num_coalesced_parcels_);
         std::swap(buff, buffer_);
 
@@ -286,6 +344,87 @@ namespace hpx::plugins::parcel {
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void coalescing_message_handler::update_arrival_rate(
+        std::int64_t time_since_last_parcel)
+    {
+        if (!adaptive_)
+            return;
+
+        if (average_arrival_time_ == 0)
+        {
+            average_arrival_time_ = double(time_since_last_parcel);
+            return;
+        }
+
+        average_arrival_time_ += detail::moving_average_weight *
+            (double(time_since_last_parcel) - average_arrival_time_);
+    }
+
+    // Called with mtx_ held whenever a message is about to be sent.
+    void coalescing_message_handler::adapt_parameters()
+    {
+        if (!adaptive_)
+            return;
+
+        // sample the average time the parcelport needed for sending a message
+        // since the last adjustment
+        std::int64_t const sending_time = pp_->get_sending_time(false);
+        std::int64_t const messages_sent = pp_->get_message_send_count(false);
+        if (messages_sent > last_messages_sent_ &&
+            sending_time >= last_sending_time_)
+        {
+            double const send_time = double(sending_time - last_sending_time_) /
+                double(messages_sent - last_messages_sent_);
+
+            if (average_send_time_ == 0)
+            {
+                average_send_time_ = send_time;
+            }
+            else
+            {
+                average_send_time_ += detail::moving_average_weight *
+                    (send_time - average_send_time_);
+            }
+        }
+
+        // the counters might have been reset in the meantime
+        last_sending_time_ = sending_time;
+        last_messages_sent_ = messages_sent;
+
+        if (average_arrival_time_ == 0)
+            return;    // no parcels seen yet
+
+        // Coalescing pays off only if parcels arrive faster than they can be
+        // sent one by one. In this case wait for as many parcels as are
+        // expected to arrive within the latency budget.
+        double num_parcels = 1.0;
+        if (average_send_time_ == 0 ||
+            average_arrival_time_ < average_send_time_)
+        {
+            num_parcels = (std::min)(
+                double(max_latency_) * 1000.0 / average_arrival_time_,
+                double(max_num_coalesced_parcels_));
+        }
+        num_coalesced_parcels_ =
+            (std::max)(std::size_t(num_parcels), std::size_t(1));
+
+        // parcels which are not coalesced are sent right away
+        if (num_coalesced_parcels_ == 1)
+        {
+            interval_ = 1;
+            return;
+        }
+
+        // don't wait longer than it takes to fill the buffer
+        double const fill_time =
+            double(num_coalesced_parcels_) * average_arrival_time_ / 1000.0;
+        std::size_t const max_interval =
+            (std::min)(max_interval_, max_latency_);
+        interval_ = (std::max)(
+            (std::min)(std::size_t(fill_time), max_interval), std::size_t(1));
+    }
+
     // performance counter values
     std::int64_t coalescing_message_handler::get_average_time_between_parcels(
         bool reset)
@@ -431,6 +570,20 @@ namespace hpx::plugins::parcel {
             this);
     }
 
+    std::int64_t coalescing_message_handler::get_num_messages_parameter(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_interval_parameter(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(interval_) * 1000;    // ns
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // register the given action (called during startup)
     void coalescing_message_handler::register_action(
@@ -537,6 +537,113 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The counters reporting the coalescing parameters currently used for an
+    // action differ only in the registry function they are retrieved from.
+    using get_parameter_counter_type =
+        coalescing_counter_registry::get_counter_type (
+            coalescing_counter_registry::*)(std::string const&) const;
+
+    struct parameter_counter_surrogate
+    {
+        parameter_counter_surrogate(get_parameter_counter_type get_counter,
+            std::string const& parameters)
+          : get_counter_(get_counter)
+          , parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = (coalescing_counter_registry::instance().*
+                    get_counter_)(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        get_parameter_counter_type get_counter_;
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        get_parameter_counter_type get_counter, hpx::error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_raw:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "parameter_counter_creator",
+                    "invalid counter name for coalescing parameter (instance "
+                    "name must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "parameter_counter_creator",
+                    "invalid counter parameter for coalescing parameter: must "
+                    "specify an action type");
+                return naming::invalid_gid;
+            }
+
+            // ask registry
+            hpx::function<std::int64_t(bool)> f =
+                (coalescing_counter_registry::instance().*get_counter)(
+                    paths.parameters_);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(info,
+                parameter_counter_surrogate(get_counter, paths.parameters_),
+                ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter, "parameter_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
+    hpx::naming::gid_type num_messages_parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return parameter_counter_creator(info,
+            &coalescing_counter_registry::get_num_messages_parameter_counter,
+            ec);
+    }
+
+    hpx::naming::gid_type interval_parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return parameter_counter_creator(info,
+            &coalescing_counter_registry::get_interval_parameter_counter, ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     //
@@ -585,7 +692,23 @@ namespace hpx::plugins::parcel {
                 "the action which is given by the counter parameter",
                 HPX_PERFORMANCE_COUNTER_V1,
                 &time_between_parcels_histogram_counter_creator,
-                &counter_discoverer, "ns/0.1%"}};
+                &counter_discoverer, "ns/0.1%"},
+            // /coalescing(...)/parameters/num-messages@action-name
+            {"/coalescing/parameters/num-messages", counter_raw,
+                "returns the number of parcels the message handler associated "
+                "with the action which is given by the counter parameter "
+                "currently coalesces into one message",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &num_messages_parameter_counter_creator, &counter_discoverer,
+                ""},
+            // /coalescing(...)/parameters/interval@action-name
+            {"/coalescing/parameters/interval", counter_raw,
+                "returns the time the message handler associated with the "
+                "action which is given by the counter parameter currently "
+                "waits for further parcels before sending a message",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &interval_parameter_counter_creator, &counter_discoverer,
+                "ns"}};
 
         // Install the counter types, un-installation of the types is handled
         // automatically.
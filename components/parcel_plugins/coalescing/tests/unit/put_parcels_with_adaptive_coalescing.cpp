@@ -0,0 +1,146 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_parcels = 1000;
+std::size_t const num_single_parcels = 50;
+std::int64_t const max_num_messages = 50;
+std::int64_t const max_latency = 100;    // us
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test(std::size_t i)
+{
+    return i;
+}
+HPX_DECLARE_PLAIN_ACTION(test, test_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(test_action)
+HPX_PLAIN_ACTION(test, test_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync).get_value<std::int64_t>();
+}
+
+std::int64_t get_interval()
+{
+    return get_counter_value(
+        "/coalescing{locality#0/total}/parameters/interval@test_action");
+}
+
+// send single parcels with enough time in between for them not to be
+// coalesced anymore
+void send_single_parcels(hpx::id_type const& id)
+{
+    test_action act;
+    for (std::size_t i = 0; i != num_single_parcels; ++i)
+    {
+        HPX_TEST_EQ(hpx::async(act, id, i).get(), i);
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void send_burst(hpx::id_type const& id)
+{
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_parcels);
+
+    test_action act;
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        results.push_back(hpx::async(act, id, i));
+    }
+
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+}
+
+void test_adaptive_parameters(hpx::id_type const& id)
+{
+    // parcels arriving slowly are sent right away, the handler does not
+    // wait for more parcels (the minimal interval is 1us)
+    send_single_parcels(id);
+    HPX_TEST_EQ(get_interval(), std::int64_t(1000));
+
+    // a burst of parcels makes the handler coalesce them, waiting longer
+    // for further parcels, unless the parcelport sends single messages faster
+    // than the parcels arrive (e.g. over shared memory)
+    send_burst(id);
+
+    // the chosen number of parcels must stay within the configured bounds
+    std::int64_t num_messages = get_counter_value(
+        "/coalescing{locality#0/total}/parameters/num-messages@test_action");
+    HPX_TEST_LTE(std::int64_t(1), num_messages);
+    HPX_TEST_LTE(num_messages, max_num_messages);
+
+    std::int64_t const burst_interval = get_interval();
+    if (num_messages > 1)
+    {
+        HPX_TEST_LT(std::int64_t(1000), burst_interval);
+        HPX_TEST_LTE(burst_interval, max_latency * 1000);
+    }
+    else
+    {
+        HPX_TEST_EQ(burst_interval, std::int64_t(1000));
+    }
+
+    // once the traffic drops the interval shrinks back
+    send_single_parcels(id);
+    HPX_TEST_EQ(get_interval(), std::int64_t(1000));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_adaptive_parameters(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) in adaptive mode,
+    // the plugin section does not exist before the plugin has been loaded
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive!=1",
+        "hpx.plugins.coalescing_message_handler.num_messages!=" +
+            std::to_string(max_num_messages),
+        "hpx.plugins.coalescing_message_handler.interval!=1000",
+        "hpx.plugins.coalescing_message_handler.max_latency!=" +
+            std::to_string(max_latency)};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
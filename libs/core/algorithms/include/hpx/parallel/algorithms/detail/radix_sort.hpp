@@ -0,0 +1,627 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keys are sorted by 8 bit digits, least significant digit first.
+    static constexpr std::size_t radix_sort_bits = 8;
+    static constexpr std::size_t radix_sort_buckets = 1 << radix_sort_bits;
+
+    // The minimal number of elements handled by one task in the parallel
+    // implementation.
+    static constexpr std::size_t radix_sort_limit_per_task = 1 << 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic keys onto unsigned integers of the same size such that
+    // the order of the unsigned integers matches the order of the keys.
+    template <typename Key, typename Enable = void>
+    struct radix_sort_key
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_key<Key,
+        std::enable_if_t<std::is_integral<Key>::value &&
+            !std::is_same<Key, bool>::value>>
+    {
+        using type = std::make_unsigned_t<Key>;
+
+        static constexpr type call(Key key) noexcept
+        {
+            if constexpr (std::is_signed<Key>::value)
+            {
+                // flip the sign bit to move negative values to the front
+                return type(key) ^ (type(1) << (sizeof(type) * CHAR_BIT - 1));
+            }
+            else
+            {
+                return key;
+            }
+        }
+    };
+
+    template <typename Key>
+    struct radix_sort_key<Key,
+        std::enable_if_t<std::is_floating_point<Key>::value &&
+            std::numeric_limits<Key>::is_iec559 &&
+            (sizeof(Key) == sizeof(std::uint32_t) ||
+                sizeof(Key) == sizeof(std::uint64_t))>>
+    {
+        using type = std::conditional_t<sizeof(Key) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static type call(Key key) noexcept
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(Key));
+
+            // negative values are stored as sign and magnitude, invert all
+            // bits to reverse their order, set the sign bit of positive values
+            // to move them behind the negative ones
+            constexpr type sign = type(1) << (sizeof(type) * CHAR_BIT - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    template <typename Key, typename Enable = void>
+    struct is_radix_sort_key : std::false_type
+    {
+    };
+
+    template <typename Key>
+    struct is_radix_sort_key<Key,
+        std::void_t<typename radix_sort_key<Key>::type>> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Proj>
+    using radix_sort_key_t =
+        std::decay_t<hpx::util::invoke_result_t<Proj&,
+            typename std::iterator_traits<Iter>::reference>>;
+
+    template <typename Comp, typename Key>
+    struct is_radix_sort_compare
+      : std::integral_constant<bool,
+            std::is_same<Comp, detail::less>::value ||
+                std::is_same<Comp, std::less<>>::value ||
+                std::is_same<Comp, std::less<Key>>::value>
+    {
+    };
+
+    // A sequence can be sorted by radix sort if the elements are ordered by
+    // an arithmetic key (possibly after applying a projection) using the
+    // default comparison.
+    template <typename Iter, typename Proj, typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Proj>
+    struct is_radix_sortable<Iter, Proj,
+        std::enable_if_t<hpx::traits::is_random_access_iterator_v<Iter> &&
+            hpx::is_invocable_v<Proj&,
+                typename std::iterator_traits<Iter>::reference>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        static constexpr bool value =
+            is_radix_sort_key<radix_sort_key_t<Iter, Proj>>::value &&
+            std::is_move_constructible<value_type>::value &&
+            std::is_move_assignable<value_type>::value;
+    };
+
+    template <typename Iter, typename Comp, typename Proj>
+    struct use_radix_sort
+      : std::integral_constant<bool,
+            is_radix_sortable<Iter, std::decay_t<Proj>>::value &&
+                is_radix_sort_compare<std::decay_t<Comp>,
+                    radix_sort_key_t<Iter, std::decay_t<Proj>>>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename UKey>
+    constexpr std::size_t radix_sort_digit(UKey key, std::size_t pass) noexcept
+    {
+        return std::size_t(key >> (pass * radix_sort_bits)) &
+            (radix_sort_buckets - 1);
+    }
+
+    template <typename KeyTraits, typename Proj, typename T>
+    typename KeyTraits::type radix_sort_get_key(Proj& proj, T&& value)
+    {
+        return KeyTraits::call(HPX_INVOKE(proj, HPX_FORWARD(T, value)));
+    }
+
+    // Moves the elements [src, src + count) to their bucket positions in the
+    // destination sequence, 'offsets' is updated with the next free position
+    // of each bucket. The relative order of elements in a bucket is kept.
+    template <typename KeyTraits, typename Src, typename Dest, typename Proj>
+    void radix_sort_scatter(Src src, std::size_t count, Dest dest,
+        std::size_t* offsets, std::size_t pass, Proj& proj)
+    {
+        for (std::size_t i = 0; i != count; ++i, ++src)
+        {
+            std::size_t const digit = radix_sort_digit(
+                radix_sort_get_key<KeyTraits>(proj, *src), pass);
+            *(dest + offsets[digit]++) = HPX_MOVE(*src);
+        }
+    }
+
+    // Same as radix_sort_scatter, but the destination is uninitialized
+    // storage the elements are move constructed into. The elements
+    // constructed for bucket 'digit' are [initial offsets[digit],
+    // offsets[digit]), even if an exception is thrown.
+    template <typename KeyTraits, typename Src, typename T, typename Proj>
+    void radix_sort_scatter_construct(Src src, std::size_t count, T* dest,
+        std::size_t* offsets, std::size_t pass, Proj& proj)
+    {
+        for (std::size_t i = 0; i != count; ++i, ++src)
+        {
+            std::size_t const digit = radix_sort_digit(
+                radix_sort_get_key<KeyTraits>(proj, *src), pass);
+            ::new (static_cast<void*>(dest + offsets[digit])) T(HPX_MOVE(*src));
+            ++offsets[digit];
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Uninitialized storage for the elements moved out of the sequence being
+    // sorted. This avoids requiring the elements to be default constructible.
+    // The elements are constructed by the first pass which moves the data into
+    // the buffer, all of them are destroyed together with the buffer.
+    template <typename T>
+    class radix_sort_buffer
+    {
+    public:
+        radix_sort_buffer() = default;
+
+        radix_sort_buffer(radix_sort_buffer const&) = delete;
+        radix_sort_buffer& operator=(radix_sort_buffer const&) = delete;
+
+        ~radix_sort_buffer()
+        {
+            if (data_ != nullptr)
+            {
+                if (constructed_)
+                {
+                    std::destroy_n(data_, count_);
+                }
+                std::allocator<T>().deallocate(data_, count_);
+            }
+        }
+
+        void allocate(std::size_t count)
+        {
+            HPX_ASSERT(data_ == nullptr);
+            data_ = std::allocator<T>().allocate(count);
+            count_ = count;
+        }
+
+        T* get() const noexcept
+        {
+            return data_;
+        }
+
+        T& operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+        bool constructed() const noexcept
+        {
+            return constructed_;
+        }
+
+        // all elements of the buffer have been constructed
+        void set_constructed() noexcept
+        {
+            constructed_ = true;
+        }
+
+        // destroys the elements [begin[digit], end[digit]) for all digits,
+        // used to clean up after a pass constructing the elements failed
+        void destroy(std::size_t const* begin, std::size_t const* end) noexcept
+        {
+            for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+            {
+                std::destroy(data_ + begin[digit], data_ + end[digit]);
+            }
+        }
+
+    private:
+        T* data_ = nullptr;
+        std::size_t count_ = 0;
+        bool constructed_ = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Proj>
+    Iter sequential_radix_sort(Iter first, Iter last, Proj&& proj)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_traits = radix_sort_key<radix_sort_key_t<Iter, Proj>>;
+        using histogram_type = std::array<std::size_t, radix_sort_buckets>;
+
+        constexpr std::size_t passes = sizeof(typename key_traits::type);
+
+        std::size_t const count = std::distance(first, last);
+        if (count < 2)
+        {
+            return last;
+        }
+
+        // compute the histograms of all digits in one sweep
+        std::array<histogram_type, passes> histograms = {};
+        for (Iter it = first; it != last; ++it)
+        {
+            auto const key = radix_sort_get_key<key_traits>(proj, *it);
+            for (std::size_t pass = 0; pass != passes; ++pass)
+            {
+                ++histograms[pass][radix_sort_digit(key, pass)];
+            }
+        }
+
+        auto const first_key = radix_sort_get_key<key_traits>(proj, *first);
+
+        radix_sort_buffer<value_type> buffer;
+        bool in_buffer = false;
+
+        for (std::size_t pass = 0; pass != passes; ++pass)
+        {
+            histogram_type& offsets = histograms[pass];
+
+            // nothing to do if all keys have the same digit
+            if (offsets[radix_sort_digit(first_key, pass)] == count)
+            {
+                continue;
+            }
+
+            std::size_t sum = 0;
+            for (std::size_t& offset : offsets)
+            {
+                sum += std::exchange(offset, sum);
+            }
+
+            if (!buffer)
+            {
+                buffer.allocate(count);
+            }
+
+            if (in_buffer)
+            {
+                radix_sort_scatter<key_traits>(
+                    buffer.get(), count, first, offsets.data(), pass, proj);
+            }
+            else if (buffer.constructed())
+            {
+                radix_sort_scatter<key_traits>(
+                    first, count, buffer.get(), offsets.data(), pass, proj);
+            }
+            else
+            {
+                histogram_type const begin = offsets;
+                try
+                {
+                    radix_sort_scatter_construct<key_traits>(
+                        first, count, buffer.get(), offsets.data(), pass, proj);
+                }
+                catch (...)
+                {
+                    buffer.destroy(begin.data(), offsets.data());
+                    throw;
+                }
+                buffer.set_constructed();
+            }
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer)
+        {
+            std::move(buffer.get(), buffer.get() + count, first);
+        }
+        return last;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Executes f(chunk) for all chunks and waits for the tasks to finish,
+    // the exceptions thrown by the tasks are collected into an exception_list.
+    template <typename Exec, typename F>
+    void radix_sort_bulk(Exec& exec, std::size_t chunks, F&& f)
+    {
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(chunks));
+
+        auto workitems =
+            execution::bulk_async_execute(exec, HPX_FORWARD(F, f), shape);
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        for (auto& workitem : workitems)
+        {
+            if (workitem.has_exception())
+            {
+                errors.push_back(workitem.get_exception_ptr());
+            }
+        }
+
+        if (!errors.empty())
+        {
+            throw exception_list(HPX_MOVE(errors));
+        }
+    }
+
+    // Each pass computes a histogram of the current digit for every chunk of
+    // the input, derives the positions of the chunks' elements in each bucket
+    // from those, and moves the elements of all chunks concurrently.
+    template <typename Exec, typename Iter, typename Proj>
+    Iter parallel_radix_sort(
+        Exec&& exec, Iter first, Iter last, std::size_t cores, Proj&& proj)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_traits = radix_sort_key<radix_sort_key_t<Iter, Proj>>;
+        using histogram_type = std::array<std::size_t, radix_sort_buckets>;
+
+        constexpr std::size_t passes = sizeof(typename key_traits::type);
+
+        std::size_t const count = std::distance(first, last);
+        std::size_t const chunks = (std::min)(
+            (std::max)(cores, std::size_t(1)),
+            (count + radix_sort_limit_per_task - 1) /
+                radix_sort_limit_per_task);
+
+        if (chunks < 2)
+        {
+            return sequential_radix_sort(first, last, proj);
+        }
+
+        try
+        {
+            std::size_t const chunk_size = (count + chunks - 1) / chunks;
+            auto chunk_begin = [&](std::size_t chunk) {
+                return (std::min)(chunk * chunk_size, count);
+            };
+
+            // the first sweep computes the histograms of all digits for each
+            // chunk, this is used to skip passes over digits which are the
+            // same for all keys
+            std::vector<std::array<histogram_type, passes>> initial(chunks);
+            radix_sort_bulk(exec, chunks, [&](std::size_t chunk) {
+                auto& histograms = initial[chunk];
+                histograms = {};
+
+                Iter it = first + chunk_begin(chunk);
+                Iter end = first + chunk_begin(chunk + 1);
+                for (/**/; it != end; ++it)
+                {
+                    auto const key = radix_sort_get_key<key_traits>(proj, *it);
+                    for (std::size_t pass = 0; pass != passes; ++pass)
+                    {
+                        ++histograms[pass][radix_sort_digit(key, pass)];
+                    }
+                }
+            });
+
+            auto const first_key =
+                radix_sort_get_key<key_traits>(proj, *first);
+
+            radix_sort_buffer<value_type> buffer;
+            std::vector<histogram_type> offsets(chunks);
+            bool in_buffer = false;
+            bool first_pass = true;
+
+            for (std::size_t pass = 0; pass != passes; ++pass)
+            {
+                std::size_t const first_digit =
+                    radix_sort_digit(first_key, pass);
+
+                std::size_t same_digit = 0;
+                for (auto const& histograms : initial)
+                {
+                    same_digit += histograms[pass][first_digit];
+                }
+
+                // nothing to do if all keys have the same digit
+                if (same_digit == count)
+                {
+                    continue;
+                }
+
+                if (first_pass)
+                {
+                    // the histograms of the first sweep are still valid
+                    for (std::size_t chunk = 0; chunk != chunks; ++chunk)
+                    {
+                        offsets[chunk] = initial[chunk][pass];
+                    }
+                    first_pass = false;
+                }
+                else
+                {
+                    radix_sort_bulk(exec, chunks, [&](std::size_t chunk) {
+                        histogram_type& histogram = offsets[chunk];
+                        histogram = {};
+
+                        std::size_t const begin = chunk_begin(chunk);
+                        std::size_t const end = chunk_begin(chunk + 1);
+                        for (std::size_t i = begin; i != end; ++i)
+                        {
+                            auto const key = in_buffer ?
+                                radix_sort_get_key<key_traits>(
+                                    proj, buffer[i]) :
+                                radix_sort_get_key<key_traits>(
+                                    proj, *(first + i));
+                            ++histogram[radix_sort_digit(key, pass)];
+                        }
+                    });
+                }
+
+                // turn the histograms into the start positions of each
+                // chunk's elements in each bucket
+                std::size_t sum = 0;
+                for (std::size_t digit = 0; digit != radix_sort_buckets;
+                     ++digit)
+                {
+                    for (histogram_type& histogram : offsets)
+                    {
+                        sum += std::exchange(histogram[digit], sum);
+                    }
+                }
+
+                if (!buffer)
+                {
+                    buffer.allocate(count);
+                }
+
+                if (in_buffer || buffer.constructed())
+                {
+                    radix_sort_bulk(exec, chunks, [&](std::size_t chunk) {
+                        std::size_t const begin = chunk_begin(chunk);
+                        std::size_t const size =
+                            chunk_begin(chunk + 1) - begin;
+                        if (in_buffer)
+                        {
+                            radix_sort_scatter<key_traits>(
+                                buffer.get() + begin, size, first,
+                                offsets[chunk].data(), pass, proj);
+                        }
+                        else
+                        {
+                            radix_sort_scatter<key_traits>(first + begin,
+                                size, buffer.get(), offsets[chunk].data(),
+                                pass, proj);
+                        }
+                    });
+                }
+                else
+                {
+                    // the first pass moving the elements into the buffer
+                    // constructs them, all chunks have to clean up if one
+                    // of them fails
+                    std::vector<histogram_type> const begin = offsets;
+                    try
+                    {
+                        radix_sort_bulk(exec, chunks, [&](std::size_t chunk) {
+                            std::size_t const first_index = chunk_begin(chunk);
+                            radix_sort_scatter_construct<key_traits>(
+                                first + first_index,
+                                chunk_begin(chunk + 1) - first_index,
+                                buffer.get(), offsets[chunk].data(), pass,
+                                proj);
+                        });
+                    }
+                    catch (...)
+                    {
+                        for (std::size_t chunk = 0; chunk != chunks; ++chunk)
+                        {
+                            buffer.destroy(
+                                begin[chunk].data(), offsets[chunk].data());
+                        }
+                        throw;
+                    }
+                    buffer.set_constructed();
+                }
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                radix_sort_bulk(exec, chunks, [&](std::size_t chunk) {
+                    std::size_t const begin = chunk_begin(chunk);
+                    std::size_t const end = chunk_begin(chunk + 1);
+                    std::move(buffer.get() + begin, buffer.get() + end,
+                        first + begin);
+                });
+            }
+
+            return last;
+        }
+        catch (std::bad_alloc const&)
+        {
+            throw;
+        }
+        catch (hpx::exception_list const&)
+        {
+            throw;
+        }
+        catch (...)
+        {
+            throw hpx::exception_list(std::current_exception());
+        }
+    }
+
+    // Sorts the sequence on the executor of the given execution policy. Task
+    // policies run the sort asynchronously and return a future.
+    template <typename ExPolicy, typename Iter, typename Proj>
+    typename util::detail::algorithm_result<ExPolicy, Iter>::type
+    parallel_radix_sort_with_policy(
+        ExPolicy&& policy, Iter first, Iter last, Proj&& proj)
+    {
+        using algorithm_result = util::detail::algorithm_result<ExPolicy, Iter>;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        if constexpr (hpx::is_async_execution_policy_v<std::decay_t<ExPolicy>>)
+        {
+            return algorithm_result::get(execution::async_execute(
+                policy.executor(),
+                [exec = policy.executor(), first, last, cores,
+                    proj = HPX_FORWARD(Proj, proj)]() mutable {
+                    return parallel_radix_sort(exec, first, last, cores, proj);
+                }));
+        }
+        else
+        {
+            return algorithm_result::get(parallel_radix_sort(
+                policy.executor(), first, last, cores, proj));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
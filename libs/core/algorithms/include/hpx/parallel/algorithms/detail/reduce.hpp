@@ -0,0 +1,76 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/accumulate.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // Sequentially reduce the elements of a range, the order in which the
+    // elements are combined is unspecified (this is used as a customization
+    // point by the vectorized implementations).
+    template <typename ExPolicy>
+    struct sequential_reduce_t final
+      : hpx::functional::detail::tag_fallback<sequential_reduce_t<ExPolicy>>
+    {
+    private:
+        // clang-format off
+        template <typename Iter, typename Sent, typename T, typename Reduce,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent, Iter>::value
+            )>
+        // clang-format on
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_reduce_t<ExPolicy>, Iter first, Sent last, T init,
+            Reduce&& r)
+        {
+            return detail::accumulate(
+                first, last, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+        }
+
+        template <typename Iter, typename T, typename Reduce>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_reduce_t<ExPolicy>, Iter first, std::size_t count,
+            T init, Reduce&& r)
+        {
+            return util::accumulate_n(
+                first, count, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_reduce_t<ExPolicy> sequential_reduce =
+        sequential_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce>
+    inline constexpr T sequential_reduce(
+        Iter first, Sent last, T init, Reduce&& r)
+    {
+        return sequential_reduce_t<ExPolicy>{}(
+            first, last, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    inline constexpr T sequential_reduce(
+        Iter first, std::size_t count, T init, Reduce&& r)
+    {
+        return sequential_reduce_t<ExPolicy>{}(
+            first, count, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
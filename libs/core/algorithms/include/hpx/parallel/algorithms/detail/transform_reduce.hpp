@@ -0,0 +1,134 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // Sequentially reduce the transformed elements of one or two ranges, the
+    // order in which the elements are combined is unspecified (this is used
+    // as a customization point by the vectorized implementations).
+    template <typename ExPolicy>
+    struct sequential_transform_reduce_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_transform_reduce_t<ExPolicy>>
+    {
+    private:
+        // clang-format off
+        template <typename Iter, typename Sent, typename T, typename Reduce,
+            typename Convert,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent, Iter>::value
+            )>
+        // clang-format on
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_transform_reduce_t<ExPolicy>, Iter first, Sent last,
+            T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; first != last; ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+
+        template <typename Iter, typename T, typename Reduce,
+            typename Convert>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_transform_reduce_t<ExPolicy>, Iter first,
+            std::size_t count, T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+
+        // clang-format off
+        template <typename Iter1, typename Sent, typename Iter2, typename T,
+            typename Reduce, typename Convert,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent, Iter1>::value
+            )>
+        // clang-format on
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_transform_reduce_t<ExPolicy>, Iter1 first1, Sent last1,
+            Iter2 first2, T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; first1 != last1; (void) ++first1, ++first2)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first1, *first2));
+            }
+            return init;
+        }
+
+        template <typename Iter1, typename Iter2, typename T, typename Reduce,
+            typename Convert>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_transform_reduce_t<ExPolicy>, Iter1 first1,
+            std::size_t count, Iter2 first2, T init, Reduce&& r,
+            Convert&& conv)
+        {
+            for (/**/; count != 0; (void) --count, ++first1, ++first2)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first1, *first2));
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_transform_reduce_t<ExPolicy>
+        sequential_transform_reduce = sequential_transform_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce, typename Convert>
+    inline constexpr T sequential_transform_reduce(
+        Iter first, Sent last, T init, Reduce&& r, Convert&& conv)
+    {
+        return sequential_transform_reduce_t<ExPolicy>{}(first, last,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert>
+    inline constexpr T sequential_transform_reduce(
+        Iter first, std::size_t count, T init, Reduce&& r, Convert&& conv)
+    {
+        return sequential_transform_reduce_t<ExPolicy>{}(first, count,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Sent, typename Iter2,
+        typename T, typename Reduce, typename Convert>
+    inline constexpr T sequential_transform_reduce(Iter1 first1, Sent last1,
+        Iter2 first2, T init, Reduce&& r, Convert&& conv)
+    {
+        return sequential_transform_reduce_t<ExPolicy>{}(first1, last1, first2,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename T,
+        typename Reduce, typename Convert>
+    inline constexpr T sequential_transform_reduce(Iter1 first1,
+        std::size_t count, Iter2 first2, T init, Reduce&& r, Convert&& conv)
+    {
+        return sequential_transform_reduce_t<ExPolicy>{}(first1, count, first2,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,215 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order of
+    /// their keys using a least significant digit radix sort. The relative
+    /// order of elements with equal keys is preserved.
+    ///
+    /// \note   Complexity: O(N * sizeof(Key)), where
+    ///                     N = std::distance(first, last). Passes over digits
+    ///                     which are equal for all keys are skipped.
+    ///
+    /// The key of an element is the result of invoking the projection
+    /// \a proj on it. It has to be an integral type (except bool), \a float,
+    /// or \a double. The algorithm allocates a temporary buffer of
+    /// N elements.
+    ///
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to
+    ///                     compute its key.
+    ///
+    /// \returns  The \a radix_sort algorithm does not return anything.
+    ///
+    template <typename RandomIt, typename Proj>
+    void radix_sort(RandomIt first, RandomIt last, Proj&& proj);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order of
+    /// their keys using a least significant digit radix sort. The relative
+    /// order of elements with equal keys is preserved.
+    ///
+    /// \note   Complexity: O(N * sizeof(Key)), where
+    ///                     N = std::distance(first, last). Passes over digits
+    ///                     which are equal for all keys are skipped.
+    ///
+    /// The parallel version computes a histogram of each digit for every
+    /// chunk of the input concurrently, and moves the elements of all chunks
+    /// to their buckets concurrently.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to
+    ///                     compute its key.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    typename parallel::util::detail::algorithm_result<ExPolicy>::type
+    radix_sort(ExPolicy&& policy, RandomIt first, RandomIt last, Proj&& proj);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/type_support/void_guard.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_sort
+    template <typename RandomIt>
+    struct radix_sort : public detail::algorithm<radix_sort<RandomIt>, RandomIt>
+    {
+        radix_sort()
+          : radix_sort::algorithm("radix_sort")
+        {
+        }
+
+        template <typename ExPolicy, typename Sent, typename Proj>
+        static RandomIt sequential(
+            ExPolicy, RandomIt first, Sent last, Proj&& proj)
+        {
+            auto last_iter = detail::advance_to_sentinel(first, last);
+            return sequential_radix_sort(first, last_iter, proj);
+        }
+
+        template <typename ExPolicy, typename Sent, typename Proj>
+        static typename util::detail::algorithm_result<ExPolicy,
+            RandomIt>::type
+        parallel(ExPolicy&& policy, RandomIt first, Sent last_s, Proj&& proj)
+        {
+            using algorithm_result =
+                util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+            auto last = detail::advance_to_sentinel(first, last_s);
+
+            try
+            {
+                return parallel_radix_sort_with_policy(
+                    HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Proj, proj));
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    detail::handle_exception<ExPolicy, RandomIt>::call(
+                        std::current_exception()));
+            }
+        }
+    };
+}}}}    // namespace hpx::parallel::v1::detail
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::experimental::radix_sort
+    inline constexpr struct radix_sort_t final
+      : hpx::detail::tag_parallel_algorithm<radix_sort_t>
+    {
+        // clang-format off
+        template <typename RandomIt,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandomIt> &&
+                parallel::v1::detail::is_radix_sortable<
+                    RandomIt, std::decay_t<Proj>>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::radix_sort_t,
+            RandomIt first, RandomIt last, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            hpx::parallel::v1::detail::radix_sort<RandomIt>().call(
+                hpx::execution::seq, first, last, HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                parallel::v1::detail::is_radix_sortable<
+                    RandomIt, std::decay_t<Proj>>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(hpx::experimental::radix_sort_t, ExPolicy&& policy,
+            RandomIt first, RandomIt last, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                typename hpx::parallel::util::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::v1::detail::radix_sort<RandomIt>().call(
+                       HPX_FORWARD(ExPolicy, policy), first, last,
+                       HPX_FORWARD(Proj, proj));
+        }
+    } radix_sort{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -221,9 +221,9 @@ namespace hpx {
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
-#include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -254,8 +254,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(
                 ExPolicy, InIterB first, InIterE last, T_&& init, Reduce&& r)
             {
-                return detail::accumulate(
-                    first, last, HPX_FORWARD(T_, init), HPX_FORWARD(Reduce, r));
+                return sequential_reduce<std::decay_t<ExPolicy>>(first, last,
+                    T(HPX_FORWARD(T_, init)), HPX_FORWARD(Reduce, r));
             }
 
             template <typename ExPolicy, typename FwdIterB, typename FwdIterE,
@@ -272,7 +272,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [r](FwdIterB part_begin, std::size_t part_size) -> T {
                     T val = *part_begin;
-                    return util::accumulate_n(
+                    return sequential_reduce<std::decay_t<ExPolicy>>(
                         ++part_begin, --part_size, HPX_MOVE(val), r);
                 };
 
@@ -244,6 +244,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -446,6 +447,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    // arithmetic keys ordered by the default comparison are
+                    // sorted using a parallel radix sort
+                    if constexpr (use_radix_sort<RandomIt, Comp, Proj>::value)
+                    {
+                        if (std::size_t(last - first) >=
+                            2 * radix_sort_limit_per_task)
+                        {
+                            return parallel_radix_sort_with_policy(
+                                HPX_FORWARD(ExPolicy, policy), first, last,
+                                HPX_FORWARD(Proj, proj));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
@@ -264,9 +264,9 @@ namespace hpx {
 
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
-#include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/transform_reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -335,17 +335,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(
                 Iter part_begin, std::size_t part_size)
             {
-                using reference =
-                    typename std::iterator_traits<Iter>::reference;
-
                 T val = HPX_INVOKE(convert_, *part_begin);
-                return util::accumulate_n(++part_begin, --part_size,
-                    HPX_MOVE(val),
-                    [HPX_CXX20_CAPTURE_THIS(=)](
-                        T const& res, reference next) mutable -> T {
-                        return HPX_INVOKE(
-                            reduce_, res, HPX_INVOKE(convert_, next));
-                    });
+                return sequential_transform_reduce<execution_policy_type>(
+                    ++part_begin, --part_size, HPX_MOVE(val), reduce_,
+                    convert_);
             }
         };
 
@@ -363,13 +356,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(ExPolicy, Iter first, Sent last, T_&& init,
                 Reduce&& r, Convert&& conv)
             {
-                using value_type =
-                    typename std::iterator_traits<Iter>::value_type;
-
-                return detail::accumulate(first, last, HPX_FORWARD(T_, init),
-                    [&r, &conv](T const& res, value_type const& next) -> T {
-                        return HPX_INVOKE(r, res, HPX_INVOKE(conv, next));
-                    });
+                return sequential_transform_reduce<std::decay_t<ExPolicy>>(
+                    first, last, T(HPX_FORWARD(T_, init)),
+                    HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -446,37 +435,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // transform_reduce_binary
     namespace detail {
 
-        template <typename F>
-        struct transform_reduce_binary_indirect
-        {
-            F f_;
-
-            template <typename Iter1, typename Iter2>
-            HPX_HOST_DEVICE HPX_FORCEINLINE constexpr auto operator()(
-                Iter1 it1, Iter2 it2) -> decltype(HPX_INVOKE(f_, *it1, *it2))
-            {
-                return HPX_INVOKE(f_, *it1, *it2);
-            }
-        };
-
-        template <typename Op1, typename Op2, typename T>
-        struct transform_reduce_binary_partition
-        {
-            typedef typename std::decay<T>::type value_type;
-
-            Op1 op1_;
-            Op2 op2_;
-            value_type& part_sum_;
-
-            template <typename Iter1, typename Iter2>
-            HPX_HOST_DEVICE HPX_FORCEINLINE constexpr void operator()(
-                Iter1 it1, Iter2 it2)
-            {
-                part_sum_ =
-                    HPX_INVOKE(op1_, part_sum_, HPX_INVOKE(op2_, *it1, *it2));
-            }
-        };
-
         template <typename T>
         struct transform_reduce_binary
           : public detail::algorithm<transform_reduce_binary<T>, T>
@@ -491,51 +449,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(ExPolicy&& /* policy */, Iter first1,
                 Sent last1, Iter2 first2, T_ init, Op1&& op1, Op2&& op2)
             {
-                if (first1 == last1)
-                {
-                    return init;
-                }
-
-                // check whether we should apply vectorization
-                if (!util::loop_optimization<ExPolicy>(first1, last1))
-                {
-                    util::loop2<ExPolicy>(std::false_type(), first1, last1,
-                        first2,
-                        transform_reduce_binary_partition<Op1, Op2, T>{
-                            HPX_FORWARD(Op1, op1), HPX_FORWARD(Op2, op2),
-                            init});
-                    return init;
-                }
-
-                // loop_step properly advances the iterators
-                auto part_sum = util::loop_step<ExPolicy>(std::true_type(),
-                    transform_reduce_binary_indirect<Op2>{op2}, first1, first2);
-
-                std::pair<Iter, Iter2> p = util::loop2<ExPolicy>(
-                    std::true_type(), first1, last1, first2,
-                    transform_reduce_binary_partition<Op1, Op2,
-                        decltype(part_sum)>{op1, op2, part_sum});
-
-                // this is to support vectorization, it will call op1 for each
-                // of the elements of a value-pack
-                auto result = util::detail::accumulate_values<ExPolicy>(
-                    [&op1](T const& sum, T&& val) -> T {
-                        return HPX_INVOKE(op1, sum, val);
-                    },
-                    HPX_MOVE(part_sum), HPX_MOVE(init));
-
-                // the vectorization might not cover all of the sequences,
-                // handle the remainder directly
-                if (p.first != last1)
-                {
-                    util::loop2<ExPolicy>(std::false_type(), p.first, last1,
-                        p.second,
-                        transform_reduce_binary_partition<Op1, Op2,
-                            decltype(result)>{HPX_FORWARD(Op1, op1),
-                            HPX_FORWARD(Op2, op2), result});
-                }
-
-                return util::detail::extract_value<ExPolicy>(result);
+                return sequential_transform_reduce<std::decay_t<ExPolicy>>(
+                    first1, last1, first2, T(HPX_MOVE(init)),
+                    HPX_FORWARD(Op1, op1), HPX_FORWARD(Op2, op2));
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -563,55 +479,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     Iter it1 = hpx::get<0>(iters);
                     Iter2 it2 = hpx::get<1>(iters);
 
-                    Iter last1 = it1;
-                    std::advance(last1, part_size);
-
-                    if (!util::loop_optimization<ExPolicy>(it1, last1))
-                    {
-                        // loop_step properly advances the iterators
-                        auto result =
-                            util::loop_step<ExPolicy>(std::false_type(),
-                                transform_reduce_binary_indirect<Op2>{op2}, it1,
-                                it2);
-
-                        util::loop2<ExPolicy>(std::false_type(), it1, last1,
-                            it2,
-                            transform_reduce_binary_partition<Op1, Op2,
-                                decltype(result)>{HPX_FORWARD(Op1, op1),
-                                HPX_FORWARD(Op2, op2), result});
-
-                        return util::detail::extract_value<ExPolicy>(result);
-                    }
-
-                    // loop_step properly advances the iterators
-                    auto part_sum = util::loop_step<ExPolicy>(std::true_type(),
-                        transform_reduce_binary_indirect<Op2>{op2}, it1, it2);
-
-                    std::pair<Iter, Iter2> p =
-                        util::loop2<ExPolicy>(std::true_type(), it1, last1, it2,
-                            transform_reduce_binary_partition<Op1, Op2,
-                                decltype(part_sum)>{op1, op2, part_sum});
-
-                    // this is to support vectorization, it will call op1
-                    // for each of the elements of a value-pack
-                    auto result = util::detail::accumulate_values<ExPolicy>(
-                        [&op1](T const& sum, T&& val) -> T {
-                            return HPX_INVOKE(op1, sum, val);
-                        },
-                        part_sum);
-
-                    // the vectorization might not cover all of the sequences,
-                    // handle the remainder directly
-                    if (p.first != last1)
-                    {
-                        util::loop2<ExPolicy>(std::false_type(), p.first, last1,
-                            p.second,
-                            transform_reduce_binary_partition<Op1, Op2,
-                                decltype(result)>{HPX_FORWARD(Op1, op1),
-                                HPX_FORWARD(Op2, op2), result});
-                    }
-
-                    return util::detail::extract_value<ExPolicy>(result);
+                    T val = HPX_INVOKE(op2, *it1, *it2);
+                    return sequential_transform_reduce<std::decay_t<ExPolicy>>(
+                        ++it1, --part_size, ++it2, HPX_MOVE(val), op1, op2);
                 };
 
                 using hpx::util::make_zip_iterator;
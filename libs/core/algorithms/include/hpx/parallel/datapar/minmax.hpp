@@ -0,0 +1,327 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_reduce.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/find.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // min_element, max_element, and minmax_element are vectorized for
+    // arithmetic element types if the default comparison and projection are
+    // used.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct is_datapar_minmax : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    struct is_datapar_minmax<Iter, F, Proj,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        static constexpr bool value =
+            std::is_arithmetic<value_type>::value &&
+            std::is_same<std::decay_t<F>, detail::less>::value &&
+            std::is_same<std::decay_t<Proj>, util::projection_identity>::value;
+    };
+
+    template <typename ExPolicy>
+    struct datapar_minmax_element
+    {
+        // Computes the smallest and the largest value of the given non-empty
+        // sequence in one pass. The vector packs are combined lane-wise, the
+        // lanes are reduced at the end. Returns false if a pack holds a value
+        // which is not ordered (NaN): the lane-wise minimum and maximum drop
+        // the values seen so far in that lane, the results can't be used in
+        // this case.
+        template <typename Iter, typename T>
+        static bool values(Iter first, std::size_t count, T& min_value,
+            T& max_value, bool need_min, bool need_max)
+        {
+            using V = typename traits::vector_pack_type<T>::type;
+            using load = traits::vector_pack_load<V, T>;
+            constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+            min_value = max_value = *first;
+
+            for (/**/; count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                T const curr = *first;
+                if (curr < min_value)
+                    min_value = curr;
+                if (max_value < curr)
+                    max_value = curr;
+            }
+
+            if (count >= size)
+            {
+                V min_pack = load::aligned(first);
+                V max_pack = min_pack;
+                std::advance(first, size);
+
+                if constexpr (std::is_floating_point<T>::value)
+                {
+                    if (traits::any_of(min_pack != min_pack))
+                        return false;
+                }
+
+                for (count -= size; count >= size; count -= size)
+                {
+                    V const curr = load::aligned(first);
+                    if constexpr (std::is_floating_point<T>::value)
+                    {
+                        if (traits::any_of(curr != curr))
+                            return false;
+                    }
+                    if (need_min)
+                        min_pack = traits::min(min_pack, curr);
+                    if (need_max)
+                        max_pack = traits::max(max_pack, curr);
+                    std::advance(first, size);
+                }
+
+                T const min_lanes = traits::hmin(min_pack);
+                if (min_lanes < min_value)
+                    min_value = min_lanes;
+
+                T const max_lanes = traits::hmax(max_pack);
+                if (max_value < max_lanes)
+                    max_value = max_lanes;
+            }
+
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                T const curr = *first;
+                if (curr < min_value)
+                    min_value = curr;
+                if (max_value < curr)
+                    max_value = curr;
+            }
+            return true;
+        }
+
+        // The scalar implementations return the first smallest and the last
+        // largest element.
+        template <typename Iter, typename T>
+        static Iter find_last(Iter first, std::size_t count, T const& value)
+        {
+            Iter it = std::next(first, count);
+            while (it != first)
+            {
+                if (*--it == value)
+                    return it;
+            }
+            return std::next(first, count);
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static Iter min_element(
+            Iter first, std::size_t count, F const& f, Proj const& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            if (count == 0 || count == 1)
+                return first;
+
+            value_type min_value, max_value;
+            if (!values(first, count, min_value, max_value, true, false))
+            {
+                return sequential_min_element(
+                    hpx::execution::seq, first, count, f, proj);
+            }
+
+            Iter last = std::next(first, count);
+            Iter it = sequential_find<ExPolicy>(first, last, min_value);
+            if (it == last)
+            {
+                // the sequence contains values which are not ordered (NaN)
+                return sequential_min_element(
+                    hpx::execution::seq, first, count, f, proj);
+            }
+            return it;
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static Iter max_element(
+            Iter first, std::size_t count, F const& f, Proj const& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            if (count == 0 || count == 1)
+                return first;
+
+            value_type min_value, max_value;
+            if (!values(first, count, min_value, max_value, false, true))
+            {
+                return sequential_max_element(
+                    hpx::execution::seq, first, count, f, proj);
+            }
+
+            Iter it = find_last(first, count, max_value);
+            if (it == std::next(first, count))
+            {
+                return sequential_max_element(
+                    hpx::execution::seq, first, count, f, proj);
+            }
+            return it;
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static util::min_max_result<Iter> minmax_element(
+            Iter first, std::size_t count, F const& f, Proj const& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            if (count == 0 || count == 1)
+                return util::min_max_result<Iter>{first, first};
+
+            value_type min_value, max_value;
+            if (!values(first, count, min_value, max_value, true, true))
+            {
+                return sequential_minmax_element(
+                    hpx::execution::seq, first, count, f, proj);
+            }
+
+            Iter last = std::next(first, count);
+            util::min_max_result<Iter> result = {
+                sequential_find<ExPolicy>(first, last, min_value),
+                find_last(first, count, max_value)};
+            if (result.min == last || result.max == last)
+            {
+                return sequential_minmax_element(
+                    hpx::execution::seq, first, count, f, proj);
+            }
+            return result;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            is_datapar_minmax<Iter, F, Proj>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_min_element_t,
+        ExPolicy&&, Iter first, Sent last, F const& f, Proj const& proj)
+    {
+        return datapar_minmax_element<std::decay_t<ExPolicy>>::min_element(
+            first, detail::distance(first, last), f, proj);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_datapar_minmax<Iter, F, Proj>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_min_element_t,
+        ExPolicy&&, Iter first, std::size_t count, F const& f,
+        Proj const& proj)
+    {
+        return datapar_minmax_element<std::decay_t<ExPolicy>>::min_element(
+            first, count, f, proj);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            is_datapar_minmax<Iter, F, Proj>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_max_element_t,
+        ExPolicy&&, Iter first, Sent last, F const& f, Proj const& proj)
+    {
+        return datapar_minmax_element<std::decay_t<ExPolicy>>::max_element(
+            first, detail::distance(first, last), f, proj);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_datapar_minmax<Iter, F, Proj>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_max_element_t,
+        ExPolicy&&, Iter first, std::size_t count, F const& f,
+        Proj const& proj)
+    {
+        return datapar_minmax_element<std::decay_t<ExPolicy>>::max_element(
+            first, count, f, proj);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            is_datapar_minmax<Iter, F, Proj>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<Iter> tag_invoke(
+        sequential_minmax_element_t, ExPolicy&&, Iter first, Sent last,
+        F const& f, Proj const& proj)
+    {
+        return datapar_minmax_element<std::decay_t<ExPolicy>>::minmax_element(
+            first, detail::distance(first, last), f, proj);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_datapar_minmax<Iter, F, Proj>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<Iter> tag_invoke(
+        sequential_minmax_element_t, ExPolicy&&, Iter first, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        return datapar_minmax_element<std::decay_t<ExPolicy>>::minmax_element(
+            first, count, f, proj);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
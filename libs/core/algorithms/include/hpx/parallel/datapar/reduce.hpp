@@ -0,0 +1,168 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V>
+    struct datapar_accumulate
+    {
+        static constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+        // Combines the vector packs returned by 'next' lane-wise using the
+        // given reduction operation. Four independent accumulators are used
+        // to hide the latency of the operation. The lanes of the accumulators
+        // are reduced into 'init' at the end. Returns the number of elements
+        // which have been consumed (a multiple of the vector pack size).
+        template <typename T, typename Reduce, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+            std::size_t count, T& init, Reduce& r, F&& next)
+        {
+            std::size_t const packs = count / size;
+            if (packs == 0)
+            {
+                return 0;
+            }
+
+            V accum0 = next();
+            std::size_t i = 1;
+            if (packs >= 4)
+            {
+                V accum1 = next();
+                V accum2 = next();
+                V accum3 = next();
+                for (i = 4; i + 4 <= packs; i += 4)
+                {
+                    accum0 = HPX_INVOKE(r, accum0, next());
+                    accum1 = HPX_INVOKE(r, accum1, next());
+                    accum2 = HPX_INVOKE(r, accum2, next());
+                    accum3 = HPX_INVOKE(r, accum3, next());
+                }
+                accum0 = HPX_INVOKE(r, accum0, accum1);
+                accum2 = HPX_INVOKE(r, accum2, accum3);
+                accum0 = HPX_INVOKE(r, accum0, accum2);
+            }
+
+            for (/**/; i != packs; ++i)
+            {
+                accum0 = HPX_INVOKE(r, accum0, next());
+            }
+
+            // horizontal reduction
+            for (std::size_t j = 0; j != size; ++j)
+            {
+                init = HPX_INVOKE(r, init, T(accum0[j]));
+            }
+
+            return packs * size;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The reduction is vectorized if the reduction operation can be invoked
+    // with vector packs and if the result type is the element type of the
+    // sequence.
+    template <typename Iter, typename T, typename Reduce,
+        typename Enable = void>
+    struct is_datapar_reduce : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Reduce>
+    struct is_datapar_reduce<Iter, T, Reduce,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        static constexpr bool value = std::is_same<T, value_type>::value &&
+            hpx::is_invocable_r_v<V, std::decay_t<Reduce>&, V, V>;
+    };
+
+    template <typename ExPolicy>
+    struct datapar_reduce
+    {
+        template <typename Iter, typename T, typename Reduce>
+        static T call(Iter first, std::size_t count, T init, Reduce& r)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+
+            for (/**/; count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, init, *first);
+            }
+
+            std::size_t const done =
+                datapar_accumulate<V>::call(count, init, r, [&first]() {
+                    V v = traits::vector_pack_load<V, value_type>::aligned(
+                        first);
+                    std::advance(first, traits::vector_pack_size<V>::value);
+                    return v;
+                });
+
+            return util::accumulate_n(
+                first, count - done, HPX_MOVE(init), r);
+        }
+    };
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            is_datapar_reduce<Iter, T, Reduce>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(sequential_reduce_t<ExPolicy>,
+        Iter first, Sent last, T init, Reduce&& r)
+    {
+        return datapar_reduce<ExPolicy>::call(
+            first, detail::distance(first, last), HPX_MOVE(init), r);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_datapar_reduce<Iter, T, Reduce>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(sequential_reduce_t<ExPolicy>,
+        Iter first, std::size_t count, T init, Reduce&& r)
+    {
+        return datapar_reduce<ExPolicy>::call(first, count, HPX_MOVE(init), r);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
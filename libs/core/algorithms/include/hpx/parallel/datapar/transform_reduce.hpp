@@ -0,0 +1,246 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/transform_reduce.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/reduce.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The unary transform_reduce is vectorized if both operations can be
+    // invoked with vector packs and if the result type is the element type
+    // of the sequence.
+    template <typename Iter, typename T, typename Reduce, typename Convert,
+        typename Enable = void>
+    struct is_datapar_transform_reduce : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Reduce, typename Convert>
+    struct is_datapar_transform_reduce<Iter, T, Reduce, Convert,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        static constexpr bool value = std::is_same<T, value_type>::value &&
+            hpx::is_invocable_r_v<V, std::decay_t<Convert>&, V> &&
+            hpx::is_invocable_r_v<V, std::decay_t<Reduce>&, V, V>;
+    };
+
+    template <typename ExPolicy>
+    struct datapar_transform_reduce
+    {
+        template <typename Iter, typename T, typename Reduce,
+            typename Convert>
+        static T call(Iter first, std::size_t count, T init, Reduce& r,
+            Convert& conv)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+
+            for (/**/; count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+
+            std::size_t const done =
+                datapar_accumulate<V>::call(count, init, r, [&]() -> V {
+                    V v = traits::vector_pack_load<V, value_type>::aligned(
+                        first);
+                    std::advance(first, traits::vector_pack_size<V>::value);
+                    return HPX_INVOKE(conv, v);
+                });
+
+            for (count -= done; count != 0; (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+    };
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce, typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            is_datapar_transform_reduce<Iter, T, Reduce, Convert>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_transform_reduce_t<ExPolicy>, Iter first, Sent last, T init,
+        Reduce&& r, Convert&& conv)
+    {
+        return datapar_transform_reduce<ExPolicy>::call(
+            first, detail::distance(first, last), HPX_MOVE(init), r, conv);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_datapar_transform_reduce<Iter, T, Reduce, Convert>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_transform_reduce_t<ExPolicy>, Iter first, std::size_t count,
+        T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_transform_reduce<ExPolicy>::call(
+            first, count, HPX_MOVE(init), r, conv);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The binary transform_reduce is vectorized if both sequences have the
+    // same vector pack layout, if both operations can be invoked with vector
+    // packs, and if the result type is the element type of the first
+    // sequence.
+    template <typename Iter1, typename Iter2, typename T, typename Reduce,
+        typename Convert, typename Enable = void>
+    struct is_datapar_transform_reduce_binary : std::false_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename T, typename Reduce,
+        typename Convert>
+    struct is_datapar_transform_reduce_binary<Iter1, Iter2, T, Reduce,
+        Convert,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter1>::value &&
+            util::detail::iterator_datapar_compatible<Iter2>::value &&
+            util::detail::iterators_datapar_compatible<Iter1, Iter2>::value>>
+    {
+        using value_type1 = typename std::iterator_traits<Iter1>::value_type;
+        using value_type2 = typename std::iterator_traits<Iter2>::value_type;
+        using V1 = typename traits::vector_pack_type<value_type1>::type;
+        using V2 = typename traits::vector_pack_type<value_type2>::type;
+
+        static constexpr bool value = std::is_same<T, value_type1>::value &&
+            hpx::is_invocable_r_v<V1, std::decay_t<Convert>&, V1, V2> &&
+            hpx::is_invocable_r_v<V1, std::decay_t<Reduce>&, V1, V1>;
+    };
+
+    template <typename ExPolicy>
+    struct datapar_transform_reduce_binary
+    {
+        template <typename Iter1, typename Iter2, typename T, typename Reduce,
+            typename Convert>
+        static T call(Iter1 first1, std::size_t count, Iter2 first2, T init,
+            Reduce& r, Convert& conv)
+        {
+            using value_type1 =
+                typename std::iterator_traits<Iter1>::value_type;
+            using value_type2 =
+                typename std::iterator_traits<Iter2>::value_type;
+            using V1 = typename traits::vector_pack_type<value_type1>::type;
+            using V2 = typename traits::vector_pack_type<value_type2>::type;
+
+            using load1 = traits::vector_pack_load<V1, value_type1>;
+            using load2 = traits::vector_pack_load<V2, value_type2>;
+
+            constexpr std::size_t size = traits::vector_pack_size<V1>::value;
+
+            for (/**/; count != 0 && !util::detail::is_data_aligned(first1);
+                 (void) --count, ++first1, ++first2)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first1, *first2));
+            }
+
+            // the second sequence is not necessarily aligned in the same way
+            // as the first one
+            std::size_t done = 0;
+            if (util::detail::is_data_aligned(first2))
+            {
+                done = datapar_accumulate<V1>::call(count, init, r, [&]() {
+                    V1 v1 = load1::aligned(first1);
+                    V2 v2 = load2::aligned(first2);
+                    std::advance(first1, size);
+                    std::advance(first2, size);
+                    return V1(HPX_INVOKE(conv, v1, v2));
+                });
+            }
+            else
+            {
+                done = datapar_accumulate<V1>::call(count, init, r, [&]() {
+                    V1 v1 = load1::aligned(first1);
+                    V2 v2 = load2::unaligned(first2);
+                    std::advance(first1, size);
+                    std::advance(first2, size);
+                    return V1(HPX_INVOKE(conv, v1, v2));
+                });
+            }
+
+            for (count -= done; count != 0; (void) --count, ++first1, ++first2)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first1, *first2));
+            }
+            return init;
+        }
+    };
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter1, typename Sent, typename Iter2,
+        typename T, typename Reduce, typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter1>::value &&
+            is_datapar_transform_reduce_binary<
+                Iter1, Iter2, T, Reduce, Convert>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_transform_reduce_t<ExPolicy>, Iter1 first1, Sent last1,
+        Iter2 first2, T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_transform_reduce_binary<ExPolicy>::call(first1,
+            detail::distance(first1, last1), first2, HPX_MOVE(init), r, conv);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename T,
+        typename Reduce, typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_datapar_transform_reduce_binary<
+                Iter1, Iter2, T, Reduce, Convert>::value
+        )>
+    // clang-format on
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_transform_reduce_t<ExPolicy>, Iter1 first1,
+        std::size_t count, Iter2 first2, T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_transform_reduce_binary<ExPolicy>::call(
+            first1, count, first2, HPX_MOVE(init), r, conv);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,164 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e9), T(1e9));
+        for (T& t : c)
+            t = dist(gen);
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist;
+        for (T& t : c)
+            t = dist(gen);
+    }
+    return c;
+}
+
+template <typename F>
+double run(F&& f, int test_count)
+{
+    double time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        time += std::chrono::duration<double>(end - start).count();
+    }
+    return time / test_count;
+}
+
+// Compare the radix sort with the comparison based sorts. A lambda comparison
+// is used to force hpx::sort onto its comparison based implementation.
+template <typename T>
+void benchmark(char const* name, std::size_t size, int test_count)
+{
+    std::vector<T> const A = make_data<T>(size);
+    std::vector<T> B;
+
+    auto less = [](T lhs, T rhs) { return lhs < rhs; };
+
+    double const std_sort = run(
+        [&]() {
+            B = A;
+            std::sort(B.begin(), B.end());
+        },
+        test_count);
+
+    double const hpx_sort = run(
+        [&]() {
+            B = A;
+            hpx::sort(hpx::execution::par, B.begin(), B.end(), less);
+        },
+        test_count);
+
+    double const hpx_sort_radix = run(
+        [&]() {
+            B = A;
+            hpx::sort(hpx::execution::par, B.begin(), B.end());
+        },
+        test_count);
+
+    double const radix_sort_seq = run(
+        [&]() {
+            B = A;
+            hpx::experimental::radix_sort(B.begin(), B.end());
+        },
+        test_count);
+
+    double const radix_sort_par = run(
+        [&]() {
+            B = A;
+            hpx::experimental::radix_sort(
+                hpx::execution::par, B.begin(), B.end());
+        },
+        test_count);
+
+    std::cout << "------------- " << name << " (" << size
+              << " elements) -------------\n"
+              << "std::sort                          : " << std_sort << "\n"
+              << "hpx::sort(par, comparison)         : " << hpx_sort << "\n"
+              << "hpx::sort(par)                     : " << hpx_sort_radix
+              << "\n"
+              << "hpx::experimental::radix_sort      : " << radix_sort_seq
+              << "\n"
+              << "hpx::experimental::radix_sort(par) : " << radix_sort_par
+              << "\n"
+              << std::flush;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    benchmark<std::uint64_t>("std::uint64_t", size, test_count);
+    benchmark<std::int32_t>("std::int32_t", size, test_count);
+    benchmark<double>("double", size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            value<std::size_t>()->default_value(10000000),
+            "number of elements to sort (default: 10000000)")
+        ("test_count",
+            value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
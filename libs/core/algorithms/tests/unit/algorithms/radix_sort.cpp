@@ -0,0 +1,298 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// The sizes are chosen to cover the sequential fallback for small inputs as
+// well as the parallel implementation.
+std::size_t const sizes[] = {0, 1, 2, 100, 10007, 300007};
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+        for (T& t : c)
+            t = dist(gen);
+    }
+    else
+    {
+        std::uniform_int_distribution<std::int64_t> dist(
+            std::int64_t((std::numeric_limits<T>::min)()),
+            std::int64_t((std::numeric_limits<T>::max)() / 2));
+        for (T& t : c)
+            t = T(dist(gen));
+    }
+
+    if (size > 2)
+    {
+        c[0] = (std::numeric_limits<T>::max)();
+        c[1] = (std::numeric_limits<T>::lowest)();
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_radix_sort()
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = make_data<T>(size);
+        std::vector<T> expected = c;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<T> d = c;
+        hpx::experimental::radix_sort(d.begin(), d.end());
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_radix_sort(ExPolicy&& policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = make_data<T>(size);
+        std::vector<T> expected = c;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<T> d = c;
+        hpx::experimental::radix_sort(policy, d.begin(), d.end());
+        HPX_TEST(d == expected);
+
+        // hpx::sort uses the radix sort for large arithmetic sequences
+        d = c;
+        hpx::sort(policy, d.begin(), d.end());
+        HPX_TEST(d == expected);
+
+        d = c;
+        hpx::sort(policy, d.begin(), d.end(), std::less<T>());
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_radix_sort_async(ExPolicy&& policy)
+{
+    std::vector<T> c = make_data<T>(300007);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::future<void> f =
+        hpx::experimental::radix_sort(policy, c.begin(), c.end());
+    f.wait();
+    HPX_TEST(!f.has_exception());
+    HPX_TEST(c == expected);
+
+    // hpx::sort returns a future which becomes ready once the sequence is
+    // sorted
+    std::vector<T> d = make_data<T>(300007);
+    expected = d;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::future<void> r = hpx::sort(policy, d.begin(), d.end());
+    r.wait();
+    HPX_TEST(!r.has_exception());
+    HPX_TEST(d == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// elements with equal keys keep their relative order
+template <typename ExPolicy>
+void test_radix_sort_stable(ExPolicy&& policy)
+{
+    using element = std::pair<int, std::size_t>;
+
+    std::uniform_int_distribution<int> dist(-100, 100);
+
+    std::vector<element> c(300007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = element(dist(gen), i);
+    }
+
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+    hpx::experimental::radix_sort(
+        policy, c.begin(), c.end(), [](element const& e) { return e.first; });
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// elements are not required to be default constructible, all elements moved
+// into the temporary buffer are destroyed
+struct counted_element
+{
+    static std::atomic<std::int64_t> count;
+
+    explicit counted_element(int key)
+      : key(key)
+    {
+        ++count;
+    }
+    counted_element(counted_element const& rhs)
+      : key(rhs.key)
+    {
+        ++count;
+    }
+    counted_element(counted_element&& rhs) noexcept
+      : key(rhs.key)
+    {
+        ++count;
+    }
+    counted_element& operator=(counted_element const&) = default;
+    counted_element& operator=(counted_element&&) noexcept = default;
+    ~counted_element()
+    {
+        --count;
+    }
+
+    int key;
+};
+
+std::atomic<std::int64_t> counted_element::count(0);
+
+template <typename ExPolicy>
+void test_radix_sort_not_default_constructible(ExPolicy&& policy)
+{
+    static_assert(!std::is_default_constructible<counted_element>::value,
+        "!std::is_default_constructible<counted_element>::value");
+
+    std::uniform_int_distribution<int> dist(-100000, 100000);
+    {
+        std::vector<counted_element> c;
+        c.reserve(300007);
+        for (std::size_t i = 0; i != 300007; ++i)
+        {
+            c.emplace_back(dist(gen));
+        }
+
+        auto const proj = [](counted_element const& e) { return e.key; };
+        hpx::experimental::radix_sort(policy, c.begin(), c.end(), proj);
+        HPX_TEST(std::is_sorted(c.begin(), c.end(),
+            [](counted_element const& lhs, counted_element const& rhs) {
+                return lhs.key < rhs.key;
+            }));
+        HPX_TEST_EQ(counted_element::count.load(), std::int64_t(c.size()));
+    }
+    HPX_TEST_EQ(counted_element::count.load(), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the default comparison is the only one mapped onto the radix sort
+void test_radix_sort_greater()
+{
+    std::vector<double> c = make_data<double>(300007);
+    std::vector<double> expected = c;
+    std::sort(expected.begin(), expected.end(), std::greater<double>());
+
+    hpx::sort(hpx::execution::par, c.begin(), c.end(), std::greater<double>());
+    HPX_TEST(c == expected);
+}
+
+template <typename T>
+void test_radix_sort_types()
+{
+    using namespace hpx::execution;
+
+    test_radix_sort<T>();
+    test_radix_sort<T>(seq);
+    test_radix_sort<T>(par);
+    test_radix_sort<T>(par_unseq);
+
+    test_radix_sort_async<T>(seq(task));
+    test_radix_sort_async<T>(par(task));
+}
+
+void radix_sort_test()
+{
+    test_radix_sort_types<std::int8_t>();
+    test_radix_sort_types<std::uint16_t>();
+    test_radix_sort_types<int>();
+    test_radix_sort_types<unsigned int>();
+    test_radix_sort_types<std::int64_t>();
+    test_radix_sort_types<std::uint64_t>();
+    test_radix_sort_types<float>();
+    test_radix_sort_types<double>();
+
+    test_radix_sort_stable(hpx::execution::seq);
+    test_radix_sort_stable(hpx::execution::par);
+
+    test_radix_sort_not_default_constructible(hpx::execution::seq);
+    test_radix_sort_not_default_constructible(hpx::execution::par);
+
+    test_radix_sort_greater();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    radix_sort_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -11,7 +11,10 @@
 #include <hpx/parallel/algorithms/sort_by_key.hpp>
 #include <hpx/type_support/unused.hpp>
 //
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -229,6 +232,56 @@ void test_sort_by_key_async(
     HPX_TEST(is_equal);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Large inputs with arithmetic keys sorted by the default comparison are
+// handed to the radix sort, all others use the comparison based sort. Each
+// value encodes its key and the original position of the pair.
+template <typename Compare>
+void test_sort_by_key_dispatch(
+    std::size_t size, Compare comp, bool radix_sort_used)
+{
+    std::mt19937 g(std::rand());
+    std::uniform_int_distribution<std::int32_t> dist(-1000, 1000);
+
+    std::vector<std::int32_t> keys(size);
+    std::vector<std::int64_t> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = dist(g);
+        values[i] = std::int64_t(keys[i] + 1000) * std::int64_t(size) +
+            static_cast<std::int64_t>(i);
+    }
+
+    hpx::parallel::sort_by_key(
+        hpx::execution::par, keys.begin(), keys.end(), values.begin(), comp);
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end(), comp));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(values[i] / std::int64_t(size) - 1000,
+            std::int64_t(keys[i]));
+    }
+
+    // the radix sort is stable, equal keys keep the original order
+    if (radix_sort_used)
+    {
+        HPX_TEST(std::is_sorted(values.begin(), values.end()));
+    }
+}
+
+void test_sort_by_key_dispatch()
+{
+    std::size_t const radix_size =
+        2 * hpx::parallel::v1::detail::radix_sort_limit_per_task + 17;
+
+    // radix sort
+    test_sort_by_key_dispatch(radix_size, std::less<>(), true);
+
+    // comparison based sort for other comparisons and small inputs
+    test_sort_by_key_dispatch(radix_size, std::greater<>(), false);
+    test_sort_by_key_dispatch(1000, std::less<>(), false);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void test_sort_by_key1()
 {
@@ -302,6 +355,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::srand(seed);
 
     test_sort_by_key1();
+    test_sort_by_key_dispatch();
     sort_by_key_benchmark();
 
     return hpx::local::finalize();
@@ -0,0 +1,213 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// The sizes are chosen such that the vectorized loops have to handle
+// sequences shorter than one vector pack and unaligned tails.
+std::size_t const sizes[] = {0, 1, 3, 17, 64, 1007, 10007};
+
+// The sequences contain many duplicates, the vectorized implementations have
+// to return the same positions as the sequential ones.
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_minmax_element(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    using hpx::execution::seq;
+
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c(size);
+        for (T& t : c)
+        {
+            t = T(std::rand() % 50) - T(25);    //-V101
+        }
+
+        iterator first(std::begin(c));
+        iterator last(std::end(c));
+
+        HPX_TEST(hpx::min_element(policy, first, last) ==
+            hpx::min_element(seq, first, last));
+        HPX_TEST(hpx::max_element(policy, first, last) ==
+            hpx::max_element(seq, first, last));
+
+        auto r1 = hpx::minmax_element(policy, first, last);
+        auto r2 = hpx::minmax_element(seq, first, last);
+        HPX_TEST(r1.min == r2.min);
+        HPX_TEST(r1.max == r2.max);
+
+        // an unaligned start of the sequence
+        if (size > 1)
+        {
+            iterator next(std::next(std::begin(c)));
+
+            HPX_TEST(hpx::min_element(policy, next, last) ==
+                hpx::min_element(seq, next, last));
+            HPX_TEST(hpx::max_element(policy, next, last) ==
+                hpx::max_element(seq, next, last));
+
+            r1 = hpx::minmax_element(policy, next, last);
+            r2 = hpx::minmax_element(seq, next, last);
+            HPX_TEST(r1.min == r2.min);
+            HPX_TEST(r1.max == r2.max);
+        }
+    }
+}
+
+// A NaN inside a vector pack must not hide the values seen before in the same
+// lane. The unique extrema are placed 32 and 64 elements in front of the NaN,
+// which puts them into the same lane for all pack sizes. The results have to
+// be the same as the ones of the corresponding non-vectorized policy.
+template <typename T, typename ExPolicy, typename ScalarPolicy,
+    typename IteratorTag>
+void test_minmax_element_nan(ExPolicy policy, ScalarPolicy ref, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c(1007);
+    for (std::size_t pos = 64; pos != 128; ++pos)
+    {
+        for (T& t : c)
+        {
+            t = T(std::rand() % 50) - T(25);    //-V101
+        }
+        c[pos - 32] = T(-50);
+        c[pos - 64] = T(50);
+        c[pos] = std::numeric_limits<T>::quiet_NaN();
+
+        iterator first(std::begin(c));
+        iterator last(std::end(c));
+
+        HPX_TEST(hpx::min_element(policy, first, last) ==
+            hpx::min_element(ref, first, last));
+        HPX_TEST(hpx::max_element(policy, first, last) ==
+            hpx::max_element(ref, first, last));
+
+        auto r1 = hpx::minmax_element(policy, first, last);
+        auto r2 = hpx::minmax_element(ref, first, last);
+        HPX_TEST(r1.min == r2.min);
+        HPX_TEST(r1.max == r2.max);
+    }
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_minmax_element_async(ExPolicy p, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    using hpx::execution::seq;
+
+    std::vector<T> c(10007);
+    for (T& t : c)
+    {
+        t = T(std::rand() % 50) - T(25);    //-V101
+    }
+
+    iterator first(std::begin(c));
+    iterator last(std::end(c));
+
+    auto f1 = hpx::min_element(p, first, last);
+    auto f2 = hpx::max_element(p, first, last);
+    auto f3 = hpx::minmax_element(p, first, last);
+
+    HPX_TEST(f1.get() == hpx::min_element(seq, first, last));
+    HPX_TEST(f2.get() == hpx::max_element(seq, first, last));
+
+    auto r1 = f3.get();
+    auto r2 = hpx::minmax_element(seq, first, last);
+    HPX_TEST(r1.min == r2.min);
+    HPX_TEST(r1.max == r2.max);
+}
+
+template <typename IteratorTag>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element<int>(simd, IteratorTag());
+    test_minmax_element<int>(par_simd, IteratorTag());
+    test_minmax_element<float>(simd, IteratorTag());
+    test_minmax_element<float>(par_simd, IteratorTag());
+    test_minmax_element<double>(simd, IteratorTag());
+    test_minmax_element<double>(par_simd, IteratorTag());
+
+    test_minmax_element_nan<float>(simd, seq, IteratorTag());
+    test_minmax_element_nan<float>(par_simd, par, IteratorTag());
+    test_minmax_element_nan<double>(simd, seq, IteratorTag());
+    test_minmax_element_nan<double>(par_simd, par, IteratorTag());
+
+    test_minmax_element_async<int>(simd(task), IteratorTag());
+    test_minmax_element_async<int>(par_simd(task), IteratorTag());
+    test_minmax_element_async<double>(simd(task), IteratorTag());
+    test_minmax_element_async<double>(par_simd(task), IteratorTag());
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<std::random_access_iterator_tag>();
+    test_minmax_element<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    minmax_element_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
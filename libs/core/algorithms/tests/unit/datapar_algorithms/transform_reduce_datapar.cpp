@@ -0,0 +1,166 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// The sizes are chosen such that the vectorized loops have to handle
+// sequences shorter than one vector pack and unaligned tails.
+std::size_t const sizes[] = {0, 1, 3, 17, 64, 1007, 10007};
+
+struct square
+{
+    template <typename T>
+    T operator()(T const& t) const
+    {
+        return t * t;
+    }
+};
+
+template <typename T, typename Iter>
+T transform_reduce_reference(Iter first, Iter last, T init)
+{
+    for (/**/; first != last; ++first)
+    {
+        init = init + square()(*first);
+    }
+    return init;
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_transform_reduce(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    for (std::size_t size : sizes)
+    {
+        // small values to keep the floating point sums exact
+        std::vector<T> c(size);
+        for (T& t : c)
+        {
+            t = T(std::rand() % 32);    //-V101
+        }
+        T init = T(std::rand() % 100);    //-V101
+
+        T r1 = hpx::transform_reduce(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), init, std::plus<>(), square());
+        T r2 = transform_reduce_reference(std::begin(c), std::end(c), init);
+        HPX_TEST_EQ(r1, r2);
+
+        // an unaligned start of the sequence
+        if (size > 1)
+        {
+            r1 = hpx::transform_reduce(policy,
+                iterator(std::next(std::begin(c))), iterator(std::end(c)),
+                init, std::plus<>(), square());
+            r2 = transform_reduce_reference(
+                std::next(std::begin(c)), std::end(c), init);
+            HPX_TEST_EQ(r1, r2);
+        }
+    }
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_transform_reduce_async(ExPolicy p, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c(10007);
+    for (T& t : c)
+    {
+        t = T(std::rand() % 32);    //-V101
+    }
+    T init = T(std::rand() % 100);    //-V101
+
+    hpx::future<T> f = hpx::transform_reduce(p, iterator(std::begin(c)),
+        iterator(std::end(c)), init, std::plus<>(), square());
+    f.wait();
+
+    HPX_TEST_EQ(
+        f.get(), transform_reduce_reference(std::begin(c), std::end(c), init));
+}
+
+template <typename IteratorTag>
+void test_transform_reduce()
+{
+    using namespace hpx::execution;
+
+    test_transform_reduce<int>(simd, IteratorTag());
+    test_transform_reduce<int>(par_simd, IteratorTag());
+    test_transform_reduce<float>(simd, IteratorTag());
+    test_transform_reduce<float>(par_simd, IteratorTag());
+    test_transform_reduce<double>(simd, IteratorTag());
+    test_transform_reduce<double>(par_simd, IteratorTag());
+
+    test_transform_reduce_async<int>(simd(task), IteratorTag());
+    test_transform_reduce_async<int>(par_simd(task), IteratorTag());
+    test_transform_reduce_async<double>(simd(task), IteratorTag());
+    test_transform_reduce_async<double>(par_simd(task), IteratorTag());
+}
+
+void transform_reduce_test()
+{
+    test_transform_reduce<std::random_access_iterator_tag>();
+    test_transform_reduce<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    transform_reduce_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
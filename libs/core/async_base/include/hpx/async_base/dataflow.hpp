@@ -7,7 +7,6 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 
 #include <type_traits>
 #include <utility>
@@ -16,6 +15,18 @@
 namespace hpx { namespace lcos { namespace detail {
     template <typename FD, typename Enable = void>
     struct dataflow_dispatch;
+
+    // see hpx/futures/detail/future_data_pool.hpp
+    template <typename T>
+    struct future_data_pool_allocator;
+
+    // Unless an allocator is given explicitly, hpx::dataflow allocates its
+    // frames from the future_data pool.
+    template <typename F>
+    struct dataflow_default_allocator
+    {
+        using type = future_data_pool_allocator<int>;
+    };
 }}}    // namespace hpx::lcos::detail
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -23,12 +34,12 @@ namespace hpx {
     template <typename F, typename... Ts>
     HPX_FORCEINLINE auto dataflow(F&& f, Ts&&... ts) -> decltype(
         lcos::detail::dataflow_dispatch<typename std::decay<F>::type>::call(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(F, f),
-            HPX_FORWARD(Ts, ts)...))
+            typename lcos::detail::dataflow_default_allocator<F>::type{},
+            HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...))
     {
         return lcos::detail::dataflow_dispatch<typename std::decay<F>::type>::
-            call(hpx::util::internal_allocator<>{}, HPX_FORWARD(F, f),
-                HPX_FORWARD(Ts, ts)...);
+            call(typename lcos::detail::dataflow_default_allocator<F>::type{},
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
     }
 
     template <typename Allocator, typename F, typename... Ts>
@@ -0,0 +1,41 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/hashed_lru_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+
+#include <functional>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A thread-safe LRU cache made up of a number of independently
+    ///        locked segments, each of which is a \a hashed_lru_cache.
+    ///
+    /// The least recently used order is maintained per segment, the
+    /// capacity passed to the constructor is evenly divided between the
+    /// segments, see \a sharded_cache.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache.
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    The statistics policy used for each segment.
+    /// \tparam Mutex         The type of the lock protecting each segment.
+    /// \tparam Hash          The hash function used for the keys.
+    /// \tparam KeyEqual      The function object used to compare keys.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Mutex = std::mutex, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    using concurrent_lru_cache =
+        sharded_cache<hashed_lru_cache<Key, Entry, Statistics, Hash, KeyEqual>,
+            Mutex, hash_sharder<Key, Hash>>;
+}}}    // namespace hpx::util::cache
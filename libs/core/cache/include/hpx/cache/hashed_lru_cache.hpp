@@ -0,0 +1,388 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/cache/storage/open_hash_map.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class hashed_lru_cache hashed_lru_cache.hpp
+    ///        hpx/cache/hashed_lru_cache.hpp
+    ///
+    /// \brief The \a hashed_lru_cache is a drop-in replacement for the
+    ///        \a lru_cache which stores its entries in an open addressing
+    ///        hash table (\a storage#open_hash_map) instead of a tree.
+    ///
+    /// The recently-used order is maintained by an intrusive doubly linked
+    /// list threaded through the (stable) nodes of the hash table. Looking
+    /// up or touching an entry does not allocate any memory, inserting an
+    /// entry only allocates whenever the table has to grow.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache. As opposed to the
+    ///                       \a lru_cache, keys are compared for equality
+    ///                       using \a KeyEqual only, keys representing ranges
+    ///                       are not supported.
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance, see \a lru_cache.
+    /// \tparam Hash          The hash function used for the keys.
+    /// \tparam KeyEqual      The function object used to compare keys.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class hashed_lru_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        static constexpr size_type npos = size_type(-1);
+
+        struct node
+        {
+            explicit node(entry_type const& entry)
+              : entry_(entry)
+              , prev_(npos)
+              , next_(npos)
+            {
+            }
+
+            entry_type entry_;
+            size_type prev_;
+            size_type next_;
+        };
+
+        using map_type = storage::open_hash_map<Key, node, Hash, KeyEqual>;
+        using iterator = typename map_type::iterator;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a hashed_lru_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time, see \a lru_cache.
+        hashed_lru_cache(size_type max_size = 0)
+          : max_size_(max_size)
+          , head_(npos)
+          , tail_(npos)
+        {
+        }
+
+        hashed_lru_cache(hashed_lru_cache&& other)
+          : max_size_(other.max_size_)
+          , head_(other.head_)
+          , tail_(other.tail_)
+          , map_(HPX_MOVE(other.map_))
+          , statistics_(HPX_MOVE(other.statistics_))
+        {
+            other.head_ = npos;
+            other.tail_ = npos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        size_type size() const
+        {
+            return map_.size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to. The hash table is sized such that
+        ///             it does not have to grow before this size is reached.
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+            while (map_.size() > max_size_)
+            {
+                evict();
+            }
+            map_.reserve(max_size_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key, the entry is not touched.
+        bool holds_key(key_type const& key)
+        {
+            return map_.find(key) != map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key, see
+        ///        \a lru_cache::get_entry.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = map_.find(key);
+            if (it == map_.end())
+            {
+                // Got miss
+                statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            touch(it.index());
+
+            // update statistics
+            statistics_.got_hit();
+
+            // got hit
+            realkey = it->first;
+            entry = it->second.entry_;
+            return true;
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache, returns \a false if the
+        ///        key is already held by the cache.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+            if (map_.find(key) != map_.end())
+            {
+                return false;
+            }
+
+            insert_nonexist(key, entry);
+            return true;
+        }
+
+        void insert_nonexist(key_type const& key, entry_type const& entry)
+        {
+            std::pair<iterator, bool> p = map_.emplace(key, entry);
+            HPX_ASSERT(p.second);
+            link_front(p.first.index());
+
+            // update statistics
+            statistics_.got_insertion();
+
+            // Do we need to evict a cache entry?
+            if (map_.size() > max_size_)
+            {
+                // evict an entry
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, or insert it if
+        ///        it is not held by the cache, see \a lru_cache::update.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            // Is it already in the cache?
+            iterator it = map_.find(key);
+            if (it == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                // got miss
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return;
+            }
+
+            // got hit!
+            it->second.entry_ = entry;
+            touch(it.index());
+            // update statistics
+            statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Conditionally update an existing element in this cache, see
+        ///        \a lru_cache::update_if.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+            // Is it already in the cache?
+            iterator it = map_.find(key);
+            if (it == map_.end())
+            {
+                // got miss
+                statistics_.got_miss();    // update statistics
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return true;
+            }
+
+            if (f(key, it->first))
+                return false;
+
+            // got hit!
+            touch(it.index());
+            it->second.entry_ = entry;
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked with an \a entry_pair for each
+        ///               of the entries currently held in the cache.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (iterator it = map_.begin(); it != map_.end();)
+            {
+                if (ep(entry_pair(it->first, it->second.entry_)))
+                {
+                    ++erased;
+
+                    unlink(it.index());
+                    it = map_.erase(it);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = map_.size();
+            map_.clear();
+            head_ = npos;
+            tail_ = npos;
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    private:
+        node& get_node(size_type index) noexcept
+        {
+            return map_.at_index(index).second;
+        }
+
+        void link_front(size_type index) noexcept
+        {
+            node& n = get_node(index);
+            n.prev_ = npos;
+            n.next_ = head_;
+            if (head_ != npos)
+                get_node(head_).prev_ = index;
+            else
+                tail_ = index;
+            head_ = index;
+        }
+
+        void unlink(size_type index) noexcept
+        {
+            node& n = get_node(index);
+            if (n.prev_ != npos)
+                get_node(n.prev_).next_ = n.next_;
+            else
+                head_ = n.next_;
+
+            if (n.next_ != npos)
+                get_node(n.next_).prev_ = n.prev_;
+            else
+                tail_ = n.prev_;
+        }
+
+        void touch(size_type index) noexcept
+        {
+            if (index != head_)
+            {
+                unlink(index);
+                link_front(index);
+            }
+        }
+
+        void evict()
+        {
+            HPX_ASSERT(tail_ != npos);
+            statistics_.got_eviction();
+
+            size_type const index = tail_;
+            unlink(index);
+            map_.erase(iterator(&map_, index));
+        }
+
+        size_type max_size_;
+        size_type head_;
+        size_type tail_;
+
+        map_type map_;
+
+        statistics_type statistics_;
+    };
+}}}    // namespace hpx::util::cache
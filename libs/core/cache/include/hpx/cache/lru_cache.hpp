@@ -358,6 +358,7 @@ namespace hpx { namespace util { namespace cache {
 
                     storage_.erase(jt);
                     it = map_.erase(it);
+                    --current_size_;
 
                     // update statistics
                     statistics_.got_eviction();
@@ -0,0 +1,298 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A \a Sharder mapping each key to exactly one shard based on
+    ///        its hash value.
+    ///
+    /// The hash value is scrambled before selecting the shard to avoid
+    /// correlating the shard with the low bits used by hash tables inside of
+    /// the shards.
+    template <typename Key, typename Hash = std::hash<Key>>
+    struct hash_sharder
+    {
+        std::pair<std::size_t, std::size_t> operator()(
+            Key const& key, std::size_t num_shards) const
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(Hash()(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            return std::make_pair(
+                static_cast<std::size_t>(h % num_shards), std::size_t(1));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class sharded_cache sharded_cache.hpp hpx/cache/sharded_cache.hpp
+    ///
+    /// \brief The \a sharded_cache splits the entries of a cache into a
+    ///        number of independent shards, each protected by its own lock.
+    ///        Concurrent accesses to different shards do not contend with
+    ///        each other.
+    ///
+    /// \tparam Cache         The type of the cache used for each shard (for
+    ///                       instance \a lru_cache).
+    /// \tparam Mutex         The type of the lock protecting each shard.
+    /// \tparam Sharder       A function object mapping a key to the shards
+    ///                       holding the corresponding entry. It is invoked
+    ///                       as \a Sharder()(key, num_shards) and has to
+    ///                       return a pair of the first shard and the number
+    ///                       of consecutive shards (modulo the number of
+    ///                       shards) the entry is stored in. Keys which
+    ///                       compare equal to each other have to be mapped
+    ///                       to a common shard, usually by returning
+    ///                       exactly one shard for each key.
+    ///
+    /// \note  Entries which are stored in more than one shard are counted
+    ///        once for each shard by \a size() and the cache statistics.
+    template <typename Cache, typename Mutex, typename Sharder>
+    class sharded_cache
+    {
+    public:
+        using cache_type = Cache;
+        using mutex_type = Mutex;
+        using sharder_type = Sharder;
+        using key_type = typename cache_type::key_type;
+        using entry_type = typename cache_type::entry_type;
+        using statistics_type = typename cache_type::statistics_type;
+        using size_type = typename cache_type::size_type;
+
+    private:
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            cache_type cache_;
+        };
+        using shard_type = util::cache_aligned_data<shard>;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a sharded_cache.
+        ///
+        /// \param num_shards [in] The number of independent shards.
+        /// \param max_size   [in] The maximal overall size this cache is
+        ///                   allowed to reach, the capacity is evenly
+        ///                   distributed over all shards.
+        explicit sharded_cache(std::size_t num_shards, size_type max_size = 0)
+          : num_shards_(num_shards != 0 ? num_shards : 1)
+          , shards_(new shard_type[num_shards_])
+        {
+            reserve(max_size);
+        }
+
+        std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the current size of the cache (summed over all
+        ///        shards).
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard const& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.cache_.size();
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return capacity_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to, the new
+        ///        capacity is evenly distributed over all shards.
+        void reserve(size_type max_size)
+        {
+            capacity_ = max_size;
+
+            size_type const shard_size =
+                (max_size + num_shards_ - 1) / num_shards_;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.cache_.reserve(shard_size);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] The key under which the entry is stored.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.cache_.get_entry(key, realkey, entry);
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into all shards the key maps to.
+        ///
+        /// \returns      This function returns \a true if the entry was
+        ///               inserted into all of the shards.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            bool result = true;
+            for_each_shard(key, [&](shard& s) {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result = s.cache_.insert(key, entry) && result;
+            });
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, or insert it if
+        ///        it is not held by the cache.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            for_each_shard(key, [&](shard& s) {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.cache_.update(key, entry);
+            });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Conditionally update an existing element in this cache,
+        ///        see \a lru_cache::update_if.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated in all shards.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            bool result = true;
+            for_each_shard(key, [&](shard& s) {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result = s.cache_.update_if(key, entry, f) && result;
+            });
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from all shards for which the
+        ///        supplied function object returns true.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                erased += s.cache_.erase(ep);
+            }
+            return erased;
+        }
+
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from all shards.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                erased += s.cache_.clear();
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Sum up a value extracted from the statistics of all shards
+        ///
+        /// \param f      [in] A function object which is invoked with a
+        ///               reference to the statistics instance of each shard
+        ///               (while holding the lock of that shard).
+        template <typename F>
+        std::int64_t accumulate_statistics(F&& f)
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result +=
+                    static_cast<std::int64_t>(f(s.cache_.get_statistics()));
+            }
+            return result;
+        }
+
+    private:
+        shard& get_shard(key_type const& key)
+        {
+            std::pair<std::size_t, std::size_t> const p =
+                sharder_type()(key, num_shards_);
+            return shards_[p.first % num_shards_].data_;
+        }
+
+        template <typename F>
+        void for_each_shard(key_type const& key, F&& f)
+        {
+            std::pair<std::size_t, std::size_t> const p =
+                sharder_type()(key, num_shards_);
+
+            HPX_ASSERT(p.second != 0);
+            std::size_t const count =
+                p.second < num_shards_ ? p.second : num_shards_;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(shards_[(p.first + i) % num_shards_].data_);
+            }
+        }
+
+        std::size_t const num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        size_type capacity_ = 0;
+    };
+}}}    // namespace hpx::util::cache
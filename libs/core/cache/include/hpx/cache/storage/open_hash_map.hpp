@@ -0,0 +1,538 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache { namespace storage {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class open_hash_map open_hash_map.hpp
+    ///        hpx/cache/storage/open_hash_map.hpp
+    ///
+    /// \brief The \a open_hash_map is an associative container using open
+    ///        addressing (linear probing) which can be used as the
+    ///        \a CacheStorage of a \a local_cache.
+    ///
+    /// The elements are stored in fixed size chunks of nodes which are never
+    /// moved, only the (small) index entries are relocated while probing,
+    /// growing, or erasing. This keeps iterators and references valid until
+    /// the referenced element is erased, as required by \a local_cache, and
+    /// avoids a heap allocation for each inserted element. Erased nodes are
+    /// reused by subsequent insertions.
+    ///
+    /// \tparam Key       The type of the keys.
+    /// \tparam T         The type of the mapped values.
+    /// \tparam Hash      The hash function used for the keys.
+    /// \tparam KeyEqual  The function object used to compare keys.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class open_hash_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+    private:
+        static constexpr size_type npos = size_type(-1);
+        static constexpr size_type chunk_size = 256;
+        static constexpr size_type min_buckets = 16;
+        static constexpr size_type max_buckets = size_type(1)
+            << (std::numeric_limits<size_type>::digits - 1);
+
+        struct node
+        {
+            typename std::aligned_storage<sizeof(value_type),
+                alignof(value_type)>::type storage_;
+            size_type next_free_;
+            bool used_;
+
+            value_type& value() noexcept
+            {
+                return *reinterpret_cast<value_type*>(&storage_);
+            }
+
+            value_type const& value() const noexcept
+            {
+                return *reinterpret_cast<value_type const*>(&storage_);
+            }
+        };
+
+        struct chunk
+        {
+            node nodes_[chunk_size];
+        };
+
+        struct bucket
+        {
+            std::size_t hash_;
+            size_type node_;
+        };
+
+        template <typename Map, typename Value>
+        class iterator_base
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Value;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            iterator_base() = default;
+
+            iterator_base(Map* map, size_type node) noexcept
+              : map_(map)
+              , node_(node)
+            {
+            }
+
+            // allow conversion from iterator to const_iterator
+            template <typename OtherMap, typename OtherValue,
+                typename Enable = typename std::enable_if<
+                    std::is_convertible<OtherMap*, Map*>::value>::type>
+            iterator_base(
+                iterator_base<OtherMap, OtherValue> const& rhs) noexcept
+              : map_(rhs.map_)
+              , node_(rhs.node_)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return map_->get_node(node_).value();
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &map_->get_node(node_).value();
+            }
+
+            iterator_base& operator++() noexcept
+            {
+                node_ = map_->next_used(node_ + 1);
+                return *this;
+            }
+
+            iterator_base operator++(int) noexcept
+            {
+                iterator_base tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(
+                iterator_base const& lhs, iterator_base const& rhs) noexcept
+            {
+                return lhs.node_ == rhs.node_;
+            }
+
+            friend bool operator!=(
+                iterator_base const& lhs, iterator_base const& rhs) noexcept
+            {
+                return lhs.node_ != rhs.node_;
+            }
+
+            // the stable index of the referenced node
+            size_type index() const noexcept
+            {
+                return node_;
+            }
+
+        private:
+            template <typename, typename>
+            friend class iterator_base;
+            friend class open_hash_map;
+
+            Map* map_ = nullptr;
+            size_type node_ = 0;
+        };
+
+    public:
+        using iterator = iterator_base<open_hash_map, value_type>;
+        using const_iterator =
+            iterator_base<open_hash_map const, value_type const>;
+
+        ///////////////////////////////////////////////////////////////////////
+        explicit open_hash_map(size_type num_buckets = min_buckets,
+            hasher const& hash = hasher(),
+            key_equal const& equal = key_equal())
+          : size_(0)
+          , num_nodes_(0)
+          , free_list_(npos)
+          , hash_(hash)
+          , equal_(equal)
+        {
+            buckets_.resize(round_up(num_buckets), bucket{0, npos});
+        }
+
+        open_hash_map(open_hash_map&& rhs) noexcept
+          : buckets_(HPX_MOVE(rhs.buckets_))
+          , chunks_(HPX_MOVE(rhs.chunks_))
+          , size_(rhs.size_)
+          , num_nodes_(rhs.num_nodes_)
+          , free_list_(rhs.free_list_)
+          , hash_(HPX_MOVE(rhs.hash_))
+          , equal_(HPX_MOVE(rhs.equal_))
+        {
+            rhs.buckets_.assign(min_buckets, bucket{0, npos});
+            rhs.size_ = 0;
+            rhs.num_nodes_ = 0;
+            rhs.free_list_ = npos;
+        }
+
+        open_hash_map(open_hash_map const&) = delete;
+        open_hash_map& operator=(open_hash_map const&) = delete;
+        open_hash_map& operator=(open_hash_map&&) = delete;
+
+        ~open_hash_map()
+        {
+            destroy_all();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(this, next_used(0));
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this, npos);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(this, next_used(0));
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator(this, npos);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator find(key_type const& key) noexcept
+        {
+            size_type const pos = find_bucket(key, hash_(key));
+            return pos == npos ? end() : iterator(this, buckets_[pos].node_);
+        }
+
+        const_iterator find(key_type const& key) const noexcept
+        {
+            size_type const pos = find_bucket(key, hash_(key));
+            return pos == npos ? end() :
+                                 const_iterator(this, buckets_[pos].node_);
+        }
+
+        size_type count(key_type const& key) const noexcept
+        {
+            return find_bucket(key, hash_(key)) == npos ? 0 : 1;
+        }
+
+        // Return the element stored at the given (stable) node index.
+        value_type& at_index(size_type index) noexcept
+        {
+            HPX_ASSERT(index < num_nodes_ && get_node(index).used_);
+            return get_node(index).value();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::pair<iterator, bool> insert(value_type const& value)
+        {
+            return emplace(value.first, value.second);
+        }
+
+        template <typename... Ts>
+        std::pair<iterator, bool> emplace(key_type const& key, Ts&&... ts)
+        {
+            std::size_t const hash = hash_(key);
+            size_type const pos = find_bucket(key, hash);
+            if (pos != npos)
+            {
+                return std::make_pair(
+                    iterator(this, buckets_[pos].node_), false);
+            }
+
+            // keep the load factor below 3/4
+            if (size_ + 1 > buckets_.size() / 4 * 3)
+            {
+                rehash(buckets_.size() == max_buckets ? max_buckets :
+                                                        2 * buckets_.size());
+            }
+
+            size_type const index = allocate_node();
+            node& n = get_node(index);
+            try
+            {
+                ::new (&n.storage_) value_type(std::piecewise_construct,
+                    std::forward_as_tuple(key),
+                    std::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+            }
+            catch (...)
+            {
+                release_node(index);
+                throw;
+            }
+            n.used_ = true;
+
+            buckets_[free_bucket(hash)] = bucket{hash, index};
+            ++size_;
+
+            return std::make_pair(iterator(this, index), true);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator erase(iterator it)
+        {
+            HPX_ASSERT(it.node_ < num_nodes_ && get_node(it.node_).used_);
+
+            size_type const index = it.node_;
+            key_type const& key = get_node(index).value().first;
+
+            // locate the bucket referring to this node
+            size_type const mask = buckets_.size() - 1;
+            size_type pos = home_bucket(hash_(key));
+            while (buckets_[pos].node_ != index)
+            {
+                HPX_ASSERT(buckets_[pos].node_ != npos);
+                pos = (pos + 1) & mask;
+            }
+            erase_bucket(pos);
+
+            get_node(index).value().~value_type();
+            release_node(index);
+            --size_;
+
+            return iterator(this, next_used(index + 1));
+        }
+
+        size_type erase(key_type const& key)
+        {
+            iterator it = find(key);
+            if (it == end())
+                return 0;
+
+            erase(it);
+            return 1;
+        }
+
+        void clear() noexcept
+        {
+            destroy_all();
+
+            chunks_.clear();
+            for (bucket& b : buckets_)
+            {
+                b.node_ = npos;
+            }
+            size_ = 0;
+            num_nodes_ = 0;
+            free_list_ = npos;
+        }
+
+        // Change the number of buckets, this does not invalidate iterators.
+        void rehash(size_type num_buckets)
+        {
+            num_buckets = round_up(num_buckets);
+            while (size_ > num_buckets / 4 * 3 && num_buckets != max_buckets)
+            {
+                num_buckets *= 2;
+            }
+
+            std::vector<bucket> old(num_buckets, bucket{0, npos});
+            std::swap(old, buckets_);
+
+            for (bucket const& b : old)
+            {
+                if (b.node_ != npos)
+                {
+                    buckets_[free_bucket(b.hash_)] = b;
+                }
+            }
+        }
+
+        void reserve(size_type count)
+        {
+            // keep the load factor below 3/4 without overflowing for large
+            // element counts
+            if (count > buckets_.size() / 4 * 3)
+            {
+                rehash(count > max_buckets / 4 * 3 ? max_buckets :
+                                                     count + (count + 2) / 3);
+            }
+        }
+
+    private:
+        static size_type round_up(size_type n) noexcept
+        {
+            if (n > max_buckets / 2)
+                return max_buckets;
+
+            size_type result = min_buckets;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        // Fibonacci hashing spreads the bits of weak hash functions (like
+        // std::hash for integers) over all buckets.
+        size_type home_bucket(std::size_t hash) const noexcept
+        {
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+            return static_cast<size_type>(h >> 32) & (buckets_.size() - 1);
+        }
+
+        size_type find_bucket(
+            key_type const& key, std::size_t hash) const noexcept
+        {
+            size_type const mask = buckets_.size() - 1;
+            for (size_type pos = home_bucket(hash);; pos = (pos + 1) & mask)
+            {
+                bucket const& b = buckets_[pos];
+                if (b.node_ == npos)
+                {
+                    return npos;
+                }
+                if (b.hash_ == hash &&
+                    equal_(get_node(b.node_).value().first, key))
+                {
+                    return pos;
+                }
+            }
+        }
+
+        size_type free_bucket(std::size_t hash) const noexcept
+        {
+            size_type const mask = buckets_.size() - 1;
+            size_type pos = home_bucket(hash);
+            while (buckets_[pos].node_ != npos)
+            {
+                pos = (pos + 1) & mask;
+            }
+            return pos;
+        }
+
+        // backward shift deletion, no tombstones are left behind
+        void erase_bucket(size_type pos) noexcept
+        {
+            size_type const mask = buckets_.size() - 1;
+            size_type next = (pos + 1) & mask;
+            while (buckets_[next].node_ != npos)
+            {
+                size_type const home = home_bucket(buckets_[next].hash_);
+
+                // move the entry if its home is not in (pos, next]
+                if (((next - home) & mask) >= ((next - pos) & mask))
+                {
+                    buckets_[pos] = buckets_[next];
+                    pos = next;
+                }
+                next = (next + 1) & mask;
+            }
+            buckets_[pos].node_ = npos;
+        }
+
+        node& get_node(size_type index) noexcept
+        {
+            return chunks_[index / chunk_size]->nodes_[index % chunk_size];
+        }
+
+        node const& get_node(size_type index) const noexcept
+        {
+            return chunks_[index / chunk_size]->nodes_[index % chunk_size];
+        }
+
+        size_type next_used(size_type index) const noexcept
+        {
+            while (index < num_nodes_ && !get_node(index).used_)
+            {
+                ++index;
+            }
+            return index < num_nodes_ ? index : npos;
+        }
+
+        size_type allocate_node()
+        {
+            if (free_list_ != npos)
+            {
+                size_type const index = free_list_;
+                free_list_ = get_node(index).next_free_;
+                return index;
+            }
+
+            if (num_nodes_ == chunks_.size() * chunk_size)
+            {
+                chunks_.push_back(std::make_unique<chunk>());
+                for (node& n : chunks_.back()->nodes_)
+                {
+                    n.used_ = false;
+                }
+            }
+            return num_nodes_++;
+        }
+
+        void release_node(size_type index) noexcept
+        {
+            node& n = get_node(index);
+            n.used_ = false;
+            n.next_free_ = free_list_;
+            free_list_ = index;
+        }
+
+        void destroy_all() noexcept
+        {
+            for (size_type i = 0; i != num_nodes_; ++i)
+            {
+                node& n = get_node(i);
+                if (n.used_)
+                {
+                    n.value().~value_type();
+                    n.used_ = false;
+                }
+            }
+        }
+
+        std::vector<bucket> buckets_;
+        std::vector<std::unique_ptr<chunk>> chunks_;
+        size_type size_;
+        size_type num_nodes_;
+        size_type free_list_;
+        hasher hash_;
+        key_equal equal_;
+    };
+}}}}    // namespace hpx::util::cache::storage
@@ -0,0 +1,154 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_lru_cache.hpp>
+#include <hpx/cache/hashed_lru_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using cache_type = hpx::util::cache::hashed_lru_cache<int, std::string,
+    hpx::util::cache::statistics::local_statistics>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    cache_type c(8);
+
+    HPX_TEST(c.insert(1, "one"));
+    HPX_TEST(c.insert(2, "two"));
+    HPX_TEST(!c.insert(1, "uno"));
+    HPX_TEST_EQ(c.size(), cache_type::size_type(2));
+    HPX_TEST(c.holds_key(2));
+
+    std::string value;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("one"));
+    HPX_TEST(!c.get_entry(3, value));
+
+    c.update(1, "uno");
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("uno"));
+
+    // the update is rejected if the function returns true
+    HPX_TEST(!c.update_if(2, "dos", [](int, int) { return true; }));
+    HPX_TEST(c.update_if(2, "dos", [](int, int) { return false; }));
+    HPX_TEST(c.get_entry(2, value));
+    HPX_TEST_EQ(value, std::string("dos"));
+
+    HPX_TEST_EQ(c.get_statistics().hits(), std::size_t(5));
+    HPX_TEST_EQ(c.get_statistics().misses(), std::size_t(1));
+
+    HPX_TEST_EQ(c.erase([](std::pair<int, std::string> const& p) {
+        return p.first == 1;
+    }),
+        cache_type::size_type(1));
+    HPX_TEST(!c.holds_key(1));
+
+    HPX_TEST_EQ(c.clear(), cache_type::size_type(1));
+    HPX_TEST_EQ(c.size(), cache_type::size_type(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_order()
+{
+    cache_type c(3);
+
+    HPX_TEST(c.insert(1, "one"));
+    HPX_TEST(c.insert(2, "two"));
+    HPX_TEST(c.insert(3, "three"));
+
+    // touch the oldest entry, the next insertion evicts the entry '2'
+    std::string value;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST(c.insert(4, "four"));
+
+    HPX_TEST_EQ(c.size(), cache_type::size_type(3));
+    HPX_TEST(c.holds_key(1));
+    HPX_TEST(!c.holds_key(2));
+    HPX_TEST(c.holds_key(3));
+    HPX_TEST(c.holds_key(4));
+
+    // shrinking the cache evicts the least recently used entries
+    c.reserve(1);
+    HPX_TEST_EQ(c.size(), cache_type::size_type(1));
+    HPX_TEST(c.holds_key(4));
+    HPX_TEST_EQ(c.get_statistics().evictions(), std::size_t(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_many_entries()
+{
+    cache_type c(1000);
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        c.update(i, std::to_string(i));
+    }
+    HPX_TEST_EQ(c.size(), cache_type::size_type(1000));
+
+    // only the most recently inserted entries are left
+    std::string value;
+    for (int i = 0; i != 10000; ++i)
+    {
+        HPX_TEST_EQ(c.get_entry(i, value), i >= 9000);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    using concurrent_cache_type = hpx::util::cache::concurrent_lru_cache<int,
+        std::string, hpx::util::cache::statistics::local_statistics>;
+
+    concurrent_cache_type c(16, 1024);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (int i = 0; i != 1000; ++i)
+            {
+                int const key = (t * 1000 + i) % 100;
+                c.update(key, std::to_string(key));
+
+                std::string value;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, std::to_string(key));
+                }
+            }
+        });
+    }
+
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(c.size(), concurrent_cache_type::size_type(100));
+    HPX_TEST_EQ(c.accumulate_statistics([](auto& s) { return s.hits(); }) +
+            c.accumulate_statistics([](auto& s) { return s.misses(); }),
+        std::int64_t(8000));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_lru_order();
+    test_many_entries();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,213 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/policies/always.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/cache/storage/open_hash_map.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <map>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using map_type = hpx::util::cache::storage::open_hash_map<int, std::string>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_find_erase()
+{
+    map_type m;
+    HPX_TEST(m.empty());
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        auto p = m.insert(map_type::value_type(i, std::to_string(i)));
+        HPX_TEST(p.second);
+        HPX_TEST_EQ(p.first->first, i);
+    }
+    HPX_TEST_EQ(m.size(), std::size_t(1000));
+
+    // duplicate keys are not inserted
+    auto p = m.insert(map_type::value_type(42, "other"));
+    HPX_TEST(!p.second);
+    HPX_TEST_EQ(p.first->second, std::string("42"));
+
+    // erase every other element
+    for (int i = 0; i < 1000; i += 2)
+    {
+        HPX_TEST_EQ(m.erase(i), std::size_t(1));
+    }
+    HPX_TEST_EQ(m.size(), std::size_t(500));
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        auto it = m.find(i);
+        if (i % 2 == 0)
+        {
+            HPX_TEST(it == m.end());
+        }
+        else
+        {
+            HPX_TEST(it != m.end());
+            HPX_TEST_EQ(it->second, std::to_string(i));
+        }
+    }
+
+    // iteration visits each remaining element exactly once
+    std::size_t count = 0;
+    for (auto const& v : m)
+    {
+        HPX_TEST_EQ(v.first % 2, 1);
+        ++count;
+    }
+    HPX_TEST_EQ(count, std::size_t(500));
+
+    m.clear();
+    HPX_TEST(m.empty());
+    HPX_TEST(m.begin() == m.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// all keys collide, exercise probing and backward shift deletion
+struct bad_hash
+{
+    std::size_t operator()(int) const
+    {
+        return 0;
+    }
+};
+
+void test_collisions()
+{
+    hpx::util::cache::storage::open_hash_map<int, int, bad_hash> m;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(m.emplace(i, i * i).second);
+    }
+    for (int i = 0; i < 100; i += 3)
+    {
+        HPX_TEST_EQ(m.erase(i), std::size_t(1));
+    }
+    for (int i = 0; i != 100; ++i)
+    {
+        auto it = m.find(i);
+        HPX_TEST_EQ(it == m.end(), i % 3 == 0);
+        if (it != m.end())
+        {
+            HPX_TEST_EQ(it->second, i * i);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_iterator_stability()
+{
+    map_type m;
+
+    std::vector<map_type::iterator> its;
+    for (int i = 0; i != 100; ++i)
+    {
+        its.push_back(m.emplace(i, std::to_string(i)).first);
+    }
+
+    // growing the table does not invalidate iterators or references
+    std::string const* ref = &its[17]->second;
+    for (int i = 100; i != 10000; ++i)
+    {
+        m.emplace(i, std::to_string(i));
+    }
+    HPX_TEST_EQ(ref, &its[17]->second);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(its[i]->first, i);
+        HPX_TEST(m.find(i) == its[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// use the open_hash_map as the storage of a local_cache
+void test_local_cache_storage()
+{
+    using entry_type = hpx::util::cache::entries::lru_entry<std::string>;
+    using cache_type = hpx::util::cache::local_cache<std::string, entry_type,
+        std::less<entry_type>,
+        hpx::util::cache::policies::always<entry_type>,
+        hpx::util::cache::storage::open_hash_map<std::string, entry_type>,
+        hpx::util::cache::statistics::local_statistics>;
+
+    cache_type c(3);
+
+    char const* const keys[] = {"white", "yellow", "green", "blue"};
+    for (char const* k : keys)
+    {
+        HPX_TEST(c.insert(k, k));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<cache_type::size_type>(3));
+
+    // the least recently used entry has been evicted
+    std::string value;
+    HPX_TEST(!c.get_entry("white", value));
+    HPX_TEST(c.get_entry("blue", value));
+    HPX_TEST_EQ(value, std::string("blue"));
+
+    HPX_TEST_EQ(c.get_statistics().hits(), std::size_t(1));
+    HPX_TEST_EQ(c.get_statistics().misses(), std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reserve()
+{
+    map_type m;
+    m.reserve(1000);
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(m.insert(map_type::value_type(i, std::to_string(i))).second);
+    }
+    HPX_TEST_EQ(m.size(), std::size_t(1000));
+
+    // reserving more buckets than can be allocated has to fail instead of
+    // overflowing the bucket count
+    bool caught = false;
+    try
+    {
+        m.reserve((std::numeric_limits<std::size_t>::max)());
+    }
+    catch (std::length_error const&)
+    {
+        caught = true;
+    }
+    catch (std::bad_alloc const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // the map is left unchanged
+    HPX_TEST_EQ(m.size(), std::size_t(1000));
+    HPX_TEST(m.find(999) != m.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_find_erase();
+    test_collisions();
+    test_iterator_stability();
+    test_local_cache_storage();
+    test_reserve();
+
+    return hpx::util::report_errors();
+}
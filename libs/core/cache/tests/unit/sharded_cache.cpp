@@ -0,0 +1,135 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// keys below 100 are stored in one shard, keys above in all shards
+struct sharder
+{
+    std::pair<std::size_t, std::size_t> operator()(
+        int key, std::size_t num_shards) const
+    {
+        if (key < 100)
+        {
+            return std::make_pair(std::size_t(key), std::size_t(1));
+        }
+        return std::make_pair(std::size_t(0), num_shards);
+    }
+};
+
+using cache_type = hpx::util::cache::sharded_cache<
+    hpx::util::cache::lru_cache<int, std::string,
+        hpx::util::cache::statistics::local_statistics>,
+    std::mutex, sharder>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    cache_type c(4, 8);
+
+    HPX_TEST_EQ(c.num_shards(), std::size_t(4));
+    HPX_TEST_EQ(c.capacity(), cache_type::size_type(8));
+
+    HPX_TEST(c.insert(1, "one"));
+    HPX_TEST(c.insert(2, "two"));
+    HPX_TEST(!c.insert(1, "uno"));
+    HPX_TEST_EQ(c.size(), cache_type::size_type(2));
+
+    std::string value;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("one"));
+    HPX_TEST(!c.get_entry(3, value));
+
+    c.update(1, "uno");
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("uno"));
+
+    // an entry stored in all shards is visible from each of them
+    HPX_TEST(c.insert(100, "hundred"));
+    HPX_TEST_EQ(c.size(), cache_type::size_type(6));
+
+    HPX_TEST_EQ(c.accumulate_statistics([](auto& s) { return s.hits(); }),
+        std::int64_t(3));
+    HPX_TEST_EQ(c.accumulate_statistics([](auto& s) { return s.misses(); }),
+        std::int64_t(1));
+
+    HPX_TEST_EQ(
+        c.erase([](std::pair<int, std::string> const& p) {
+            return p.first == 100;
+        }),
+        cache_type::size_type(4));
+
+    HPX_TEST_EQ(c.clear(), cache_type::size_type(2));
+    HPX_TEST_EQ(c.size(), cache_type::size_type(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    // each shard holds at most one entry
+    cache_type c(4, 4);
+
+    HPX_TEST(c.insert(0, "zero"));
+    HPX_TEST(c.insert(4, "four"));
+
+    std::string value;
+    HPX_TEST(!c.get_entry(0, value));
+    HPX_TEST(c.get_entry(4, value));
+    HPX_TEST_EQ(c.size(), cache_type::size_type(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    cache_type c(16, 1024);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (int i = 0; i != 1000; ++i)
+            {
+                int const key = (t * 1000 + i) % 100;
+                c.update(key, std::to_string(key));
+
+                std::string value;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, std::to_string(key));
+                }
+            }
+        });
+    }
+
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(c.size(), cache_type::size_type(100));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_eviction();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,197 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency { namespace detail {
+
+    /// \brief A work-stealing deque as described by Chase and Lev.
+    ///
+    /// Only a single thread (the owner) may push and pop items at the bottom
+    /// of the deque, popping returns the most recently pushed item. Any
+    /// thread may concurrently steal items from the top of the deque, which
+    /// returns the least recently pushed item. The memory orderings follow
+    /// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al.,
+    /// PPoPP 2013).
+    ///
+    /// The underlying array grows as needed. Arrays replaced by a larger one
+    /// are kept alive until the deque is destroyed, as concurrent thieves may
+    /// still be reading from them.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable items");
+
+        struct array
+        {
+            explicit array(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , items_(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & mask_) == 0);
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const noexcept
+            {
+                return items_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T value) noexcept
+            {
+                items_[i & mask_].store(value, std::memory_order_relaxed);
+            }
+
+            array* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                array* a = new array(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                    a->put(i, get(i));
+                return a;
+            }
+
+            std::int64_t const mask_;
+            std::unique_ptr<std::atomic<T>[]> items_;
+        };
+
+    public:
+        /// \brief Create an empty deque, the initial capacity is rounded up
+        ///        to the next power of two.
+        explicit chase_lev_deque(std::size_t initial_capacity = 256)
+        {
+            std::int64_t capacity = 1;
+            while (capacity < static_cast<std::int64_t>(initial_capacity))
+                capacity *= 2;
+
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+            array_.data_.store(new array(capacity), std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        ~chase_lev_deque()
+        {
+            delete array_.data_.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Push an item to the bottom of the deque (owner only).
+        void push(T value)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.data_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                retired_.emplace_back(a);
+                a = a->grow(b, t);
+                array_.data_.store(a, std::memory_order_release);
+            }
+
+            a->put(b, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// \brief Pop the most recently pushed item from the bottom of the
+        ///        deque (owner only). Returns false if the deque is empty.
+        bool pop(T& value)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.data_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            value = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, compete with the thieves for it
+                bool const result = top_.data_.compare_exchange_strong(
+                    t, t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        /// \brief Steal the least recently pushed item from the top of the
+        ///        deque (any thread). Returns false if the deque is empty or
+        ///        if another thread has taken the item concurrently.
+        bool steal(T& value)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;
+
+            array* a = array_.data_.load(std::memory_order_acquire);
+            T const item = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            value = item;
+            return true;
+        }
+
+        /// \brief Return the (approximate) number of items in the deque.
+        std::size_t size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        // top_ is modified by thieves, bottom_ by the owner only
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> top_;
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        hpx::util::cache_line_data<std::atomic<array*>> array_;
+
+        // arrays which have been replaced, accessed by the owner only
+        std::vector<std::unique_ptr<array>> retired_;
+    };
+}}}    // namespace hpx::concurrency::detail
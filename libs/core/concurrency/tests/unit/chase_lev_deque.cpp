@@ -0,0 +1,109 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/detail/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using hpx::concurrency::detail::chase_lev_deque;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_basic()
+{
+    chase_lev_deque<std::uint64_t> q(4);
+
+    std::uint64_t value = 0;
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop(value));
+    HPX_TEST(!q.steal(value));
+
+    // push more items than the initial capacity to force the deque to grow
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        q.push(i);
+    }
+    HPX_TEST_EQ(q.size(), std::size_t(100));
+
+    // stealing returns the oldest item, popping the most recent one
+    HPX_TEST(q.steal(value));
+    HPX_TEST_EQ(value, std::uint64_t(0));
+    HPX_TEST(q.pop(value));
+    HPX_TEST_EQ(value, std::uint64_t(99));
+
+    for (std::uint64_t i = 98; i != 0; --i)
+    {
+        HPX_TEST(q.pop(value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop(value));
+    HPX_TEST(!q.steal(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_steal()
+{
+    constexpr std::uint64_t num_items = 1000000;
+    constexpr std::size_t num_thieves = 3;
+
+    chase_lev_deque<std::uint64_t> q(16);
+    std::vector<std::atomic<int>> seen(num_items);
+    for (auto& s : seen)
+        s.store(0);
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t value = 0;
+            while (!done.load(std::memory_order_acquire) || !q.empty())
+            {
+                if (q.steal(value))
+                    ++seen[value];
+            }
+        });
+    }
+
+    // the owner interleaves pushing and popping items
+    std::uint64_t value = 0;
+    for (std::uint64_t i = 0; i != num_items; ++i)
+    {
+        q.push(i);
+        if (i % 3 == 0 && q.pop(value))
+            ++seen[value];
+    }
+    while (q.pop(value))
+        ++seen[value];
+
+    done.store(true, std::memory_order_release);
+    for (auto& t : thieves)
+        t.join();
+
+    // every item has been taken exactly once
+    std::size_t missing = 0;
+    for (auto const& s : seen)
+    {
+        if (s.load() != 1)
+            ++missing;
+    }
+    HPX_TEST_EQ(missing, std::size_t(0));
+    HPX_TEST(q.empty());
+}
+
+int main()
+{
+    test_basic();
+    test_concurrent_steal();
+
+    return hpx::util::report_errors();
+}
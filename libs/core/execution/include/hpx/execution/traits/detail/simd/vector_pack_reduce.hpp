@@ -0,0 +1,50 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    // element-wise minimum and maximum of two vector packs
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::experimental::simd<T, Abi> min(
+        std::experimental::simd<T, Abi> const& lhs,
+        std::experimental::simd<T, Abi> const& rhs)
+    {
+        return std::experimental::min(lhs, rhs);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::experimental::simd<T, Abi> max(
+        std::experimental::simd<T, Abi> const& lhs,
+        std::experimental::simd<T, Abi> const& rhs)
+    {
+        return std::experimental::max(lhs, rhs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // horizontal minimum and maximum of all elements of a vector pack
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T hmin(
+        std::experimental::simd<T, Abi> const& value)
+    {
+        return std::experimental::hmin(value);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T hmax(
+        std::experimental::simd<T, Abi> const& value)
+    {
+        return std::experimental::hmax(value);
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,47 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/Vc>
+#include <Vc/global.h>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    // element-wise minimum and maximum of two vector packs
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> min(
+        Vc::Vector<T, Abi> const& lhs, Vc::Vector<T, Abi> const& rhs)
+    {
+        return Vc::min(lhs, rhs);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> max(
+        Vc::Vector<T, Abi> const& lhs, Vc::Vector<T, Abi> const& rhs)
+    {
+        return Vc::max(lhs, rhs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // horizontal minimum and maximum of all elements of a vector pack
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T hmin(Vc::Vector<T, Abi> const& value)
+    {
+        return value.min();
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T hmax(Vc::Vector<T, Abi> const& value)
+    {
+        return value.max();
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
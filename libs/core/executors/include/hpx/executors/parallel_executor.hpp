@@ -9,7 +9,6 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
@@ -25,6 +24,7 @@
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/one_shot.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
@@ -190,6 +190,13 @@ namespace hpx { namespace execution {
             return exec.policy_.priority();
         }
 
+        friend constexpr hpx::threads::thread_stacksize tag_invoke(
+            hpx::execution::experimental::get_stacksize_t,
+            parallel_policy_executor const& exec) noexcept
+        {
+            return exec.policy_.stacksize();
+        }
+
         friend constexpr parallel_policy_executor tag_invoke(
             hpx::execution::experimental::with_annotation_t,
             parallel_policy_executor const& exec, char const* annotation)
@@ -280,7 +287,7 @@ namespace hpx { namespace execution {
 
             typename hpx::traits::detail::shared_state_ptr<result_type>::type
                 p = lcos::detail::make_continuation_alloc_nounwrap<result_type>(
-                    hpx::util::internal_allocator<>{},
+                    hpx::lcos::detail::future_data_pool_allocator<>{},
                     HPX_FORWARD(Future, predecessor), policy_, HPX_MOVE(func));
 
             return hpx::traits::future_access<hpx::future<result_type>>::create(
@@ -13,6 +13,7 @@
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -23,15 +24,19 @@
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -69,6 +74,22 @@ namespace hpx { namespace lcos { namespace detail {
     HPX_CORE_EXPORT void set_run_on_completed_error_handler(
         run_on_completed_error_handler_type f);
 
+    // Enable or disable running tasks inline (disabled by default, see the
+    // configuration setting hpx.inline_child_tasks). If enabled, an HPX
+    // thread waiting for the result of a task which has been scheduled on a
+    // new thread but has not started running yet runs the task itself.
+    HPX_CORE_EXPORT void set_inline_child_tasks_enabled(bool enable) noexcept;
+    HPX_CORE_EXPORT bool get_inline_child_tasks_enabled() noexcept;
+
+    // Return whether the calling thread may run a task inline which has been
+    // scheduled on the given pool.
+    HPX_CORE_EXPORT bool can_run_child_task_inline(
+        threads::thread_pool_base* pool);
+
+    // number of tasks which have been run inline by a waiting thread
+    HPX_CORE_EXPORT std::int64_t get_inlined_child_tasks_count(bool reset);
+    HPX_CORE_EXPORT void increment_inlined_child_tasks_count() noexcept;
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct future_data;
@@ -110,6 +131,65 @@ namespace hpx { namespace lcos { namespace detail {
             delete this;
         }
 
+        // Shared states which are not created using an allocator are taken
+        // from the (thread caching) future_data pool.
+        static void* operator new(std::size_t size)
+        {
+            return allocate_future_data(size);
+        }
+        static void operator delete(void* p) noexcept
+        {
+            deallocate_future_data(p);
+        }
+
+        // the class specific operator new above hides the global placement
+        // and nothrow forms
+        static void* operator new(std::size_t, void* p) noexcept
+        {
+            return p;
+        }
+        static void operator delete(void*, void*) noexcept {}
+
+        static void* operator new(
+            std::size_t size, std::nothrow_t const&) noexcept
+        {
+            try
+            {
+                return allocate_future_data(size);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+        static void operator delete(void* p, std::nothrow_t const&) noexcept
+        {
+            deallocate_future_data(p);
+        }
+
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+        // over-aligned shared states are not pooled
+        static void* operator new(std::size_t size, std::align_val_t align)
+        {
+            return ::operator new(size, align);
+        }
+        static void operator delete(void* p, std::align_val_t align) noexcept
+        {
+            ::operator delete(p, align);
+        }
+
+        static void* operator new(std::size_t size, std::align_val_t align,
+            std::nothrow_t const&) noexcept
+        {
+            return ::operator new(size, align, std::nothrow);
+        }
+        static void operator delete(void* p, std::align_val_t align,
+            std::nothrow_t const&) noexcept
+        {
+            ::operator delete(p, align, std::nothrow);
+        }
+#endif
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref
@@ -779,17 +859,13 @@ namespace hpx { namespace lcos { namespace detail {
                 return;
             }
 
-            // start new thread at given point in time
-            threads::set_thread_state(id.noref(), abs_time,
-                threads::thread_schedule_state::pending,
-                threads::thread_restart_state::timeout,
-                threads::thread_priority::boost, true, ec);
-            if (ec)
-            {
-                // thread scheduling failed, report error to the new future
-                this->base_type::set_exception(
-                    hpx::detail::access_exception(ec));
-            }
+            // start new thread at given point in time, the timer wheel holds
+            // on to the thread until the timer has fired
+            auto* scheduler =
+                threads::get_thread_id_data(id)->get_scheduler_base();
+            scheduler->add_timer(hpx::get_local_worker_thread_num(), abs_time,
+                HPX_MOVE(id), threads::thread_schedule_state::pending,
+                threads::thread_restart_state::timeout);
         }
     };
 
@@ -816,7 +892,7 @@ namespace hpx { namespace lcos { namespace detail {
 
         void execute_deferred(error_code& /*ec*/ = throws) override
         {
-            if (!started_test_and_set())
+            if (!deferred_test_and_set())
             {
                 this->do_run();
             }
@@ -825,20 +901,14 @@ namespace hpx { namespace lcos { namespace detail {
         // retrieving the value
         result_type* get_result(error_code& ec = throws) override
         {
-            if (!started_test_and_set())
-            {
-                this->do_run();
-            }
+            run_if_not_started();
             return this->future_data<Result>::get_result(ec);
         }
 
         // wait support
         typename base_type::state wait(error_code& ec = throws) override
         {
-            if (!started_test_and_set())
-            {
-                this->do_run();
-            }
+            run_if_not_started();
             return this->future_data<Result>::wait(ec);
         }
 
@@ -846,7 +916,7 @@ namespace hpx { namespace lcos { namespace detail {
             std::chrono::steady_clock::time_point const& abs_time,
             error_code& ec = throws) override
         {
-            if (!started_test())
+            if (deferred_test())
             {
                 return hpx::future_status::deferred;    //-V110
             }
@@ -854,10 +924,59 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     private:
-        bool started_test() const noexcept
+        // tasks which have been scheduled on a new thread are not deferred,
+        // even if they have not been started yet
+        bool deferred_test() const noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return !started_ && inline_pool_ == nullptr;
+        }
+
+        bool deferred_test_and_set()
         {
             std::lock_guard<mutex_type> l(mtx_);
-            return started_;
+            if (inline_pool_ != nullptr)
+            {
+                return true;
+            }
+            return started_test_and_set_locked(l);
+        }
+
+        // Run the task on the calling thread if it has not been started yet.
+        // A task which has been scheduled on a new thread is run only if the
+        // calling thread is allowed to run it inline.
+        void run_if_not_started()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (started_)
+            {
+                return;
+            }
+
+            if (inline_pool_ != nullptr)
+            {
+                threads::thread_pool_base* pool = inline_pool_;
+                l.unlock();
+                if (!can_run_child_task_inline(pool))
+                {
+                    return;
+                }
+                l.lock();
+                if (started_)
+                {
+                    return;
+                }
+                started_ = true;
+                l.unlock();
+
+                increment_inlined_child_tasks_count();
+                this->do_run();
+                return;
+            }
+
+            started_ = true;
+            l.unlock();
+            this->do_run();
         }
 
         template <typename Lock>
@@ -893,6 +1012,42 @@ namespace hpx { namespace lcos { namespace detail {
             started_ = true;
         }
 
+        // Prepare running the task on a new thread such that a thread waiting
+        // for its result may run it inline instead. Returns false, without
+        // marking the task as started, if the task has to run on its own
+        // thread.
+        bool check_started_inline(
+            threads::thread_pool_base* pool, launch const& policy)
+        {
+            // tasks which have to run with a specific priority, stack size,
+            // or on a specific worker thread are never run inline
+            threads::thread_priority const priority = policy.priority();
+            threads::thread_stacksize const stacksize = policy.stacksize();
+            if (!get_inline_child_tasks_enabled() ||
+                policy.hint().mode !=
+                    threads::thread_schedule_hint_mode::none ||
+                (priority != threads::thread_priority::default_ &&
+                    priority != threads::thread_priority::normal) ||
+                (stacksize != threads::thread_stacksize::default_ &&
+                    stacksize != threads::thread_stacksize::small_ &&
+                    stacksize != threads::thread_stacksize::current))
+            {
+                return false;
+            }
+
+            std::unique_lock<mutex_type> l(mtx_);
+            if (started_ || inline_pool_ != nullptr)
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(task_already_started,
+                    "task_base::check_started_inline",
+                    "this task has already been started");
+                return false;
+            }
+            inline_pool_ = pool;
+            return true;
+        }
+
     public:
         // run synchronously
         void run()
@@ -916,6 +1071,16 @@ namespace hpx { namespace lcos { namespace detail {
             this_->do_run();
         }
 
+        // used as the thread function of tasks which may be run inline, the
+        // task might have been run by a waiting thread already
+        static void run_impl_if_not_started(future_base_type this_)
+        {
+            if (!this_->started_test_and_set())
+            {
+                this_->do_run();
+            }
+        }
+
     public:
         template <typename T>
         void set_data(T&& result)
@@ -935,6 +1100,12 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         bool started_ = false;
+
+        // the pool the task has been scheduled on if it may be run inline
+        threads::thread_pool_base* inline_pool_ = nullptr;
+
+    public:
+        static constexpr bool supports_inline_execution = true;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -997,6 +1168,9 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     public:
+        // the thread running the task has to be known for cancellation
+        static constexpr bool supports_inline_execution = false;
+
         // cancellation support
         bool cancelable() const noexcept override
         {
@@ -0,0 +1,124 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The memory for the shared states of futures is taken from a pool of
+    // blocks sorted into size classes of 16 bytes each (up to 512 bytes).
+    // Freed blocks are cached in free lists separate for each OS-thread and
+    // are reused by the next allocation of the same size class on that
+    // OS-thread. Larger blocks are taken from the heap directly.
+    //
+    // Every block records its size class, blocks can therefore be released
+    // on any OS-thread and regardless of whether the pool has been disabled
+    // in between.
+    HPX_CORE_EXPORT void* allocate_future_data(std::size_t size);
+    HPX_CORE_EXPORT void deallocate_future_data(void* p) noexcept;
+
+    // Enable or disable the pool (enabled by default, see the configuration
+    // setting hpx.future_data_pool). If disabled, all blocks are taken from
+    // and returned to the heap.
+    HPX_CORE_EXPORT void set_future_data_pool_enabled(bool enable) noexcept;
+    HPX_CORE_EXPORT bool get_future_data_pool_enabled() noexcept;
+
+    // number of allocations served from the per-thread free lists
+    HPX_CORE_EXPORT std::int64_t get_future_data_pool_hits(bool reset);
+
+    // number of allocations which had to be served from the heap
+    HPX_CORE_EXPORT std::int64_t get_future_data_pool_misses(bool reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocator handing out memory from the future_data pool, this is used
+    // for all shared states which are not explicitly given an allocator.
+    // Over-aligned types are allocated from the heap.
+    template <typename T = int>
+    struct future_data_pool_allocator
+    {
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = future_data_pool_allocator<U>;
+        };
+
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        future_data_pool_allocator() = default;
+
+        template <typename U>
+        constexpr future_data_pool_allocator(
+            future_data_pool_allocator<U> const&) noexcept
+        {
+        }
+
+        HPX_NODISCARD T* allocate(size_type n)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+            if constexpr (alignof(T) > alignof(std::max_align_t))
+            {
+                return std::allocator<T>{}.allocate(n);
+            }
+            else
+            {
+                return static_cast<T*>(allocate_future_data(n * sizeof(T)));
+            }
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            if constexpr (alignof(T) > alignof(std::max_align_t))
+            {
+                std::allocator<T>{}.deallocate(p, n);
+            }
+            else
+            {
+                deallocate_future_data(p);
+            }
+        }
+
+        constexpr size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+    };
+
+    template <typename T, typename U>
+    constexpr bool operator==(future_data_pool_allocator<T> const&,
+        future_data_pool_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    constexpr bool operator!=(future_data_pool_allocator<T> const&,
+        future_data_pool_allocator<U> const&) noexcept
+    {
+        return false;
+    }
+}}}    // namespace hpx::lcos::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -8,13 +8,13 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/modules/errors.hpp>
@@ -95,6 +95,28 @@ namespace hpx { namespace lcos { namespace local {
             threads::thread_id_ref_type apply(threads::thread_pool_base* pool,
                 const char* annotation, launch policy, error_code& ec) override
             {
+                if constexpr (Base::supports_inline_execution)
+                {
+                    // a thread waiting for the result runs the task inline
+                    // if it has not been started by then
+                    if (policy != launch::fork &&
+                        this->check_started_inline(pool, policy))
+                    {
+                        hpx::intrusive_ptr<base_type> this_(this);
+                        threads::thread_init_data data(
+                            threads::make_thread_function_nullary(
+                                util::deferred_call(
+                                    &base_type::run_impl_if_not_started,
+                                    HPX_MOVE(this_))),
+                            util::thread_description(f_, annotation),
+                            policy.priority(), policy.hint(),
+                            policy.stacksize(),
+                            threads::thread_schedule_state::pending);
+
+                        return threads::register_work(data, pool, ec);
+                    }
+                }
+
                 this->check_started();
 
                 hpx::intrusive_ptr<base_type> this_(this);
@@ -673,13 +695,14 @@ namespace hpx { namespace lcos { namespace local {
                 !std::is_same_v<std::decay_t<F>, futures_factory>>>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, HPX_FORWARD(F, f)))
+                hpx::lcos::detail::future_data_pool_allocator<>{},
+                HPX_FORWARD(F, f)))
         {
         }
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, f))
+                hpx::lcos::detail::future_data_pool_allocator<>{}, f))
         {
         }
 
@@ -10,10 +10,16 @@
 
 #if defined(HPX_HAVE_CXX20_COROUTINES)
 
+#include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 
 #include <coroutine>
 #include <cstddef>
@@ -48,6 +54,63 @@ namespace hpx { namespace lcos { namespace detail {
         constexpr void await_resume() const noexcept {}
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Coroutines which have been started on a stackless HPX thread (i.e. a
+    // thread created with thread_stacksize::nostack) remember the thread
+    // pool they were started on. Whenever a future they await becomes ready
+    // they are resumed on a new stackless HPX thread on that pool instead of
+    // on the thread which made the future ready. A suspended coroutine holds
+    // neither a stack nor an HPX thread, it costs only its frame.
+    struct coroutine_stackless_data
+    {
+        coroutine_stackless_data()
+          : stackless_pool_(threads::get_self_stacksize_enum() ==
+                      threads::thread_stacksize::nostack ?
+                  threads::detail::get_self_or_default_pool() :
+                  nullptr)
+        {
+        }
+
+        threads::thread_pool_base* stackless_pool_;
+    };
+
+    template <typename Promise>
+    void resume_coroutine(coroutine_handle<Promise> rh)
+    {
+        if constexpr (std::is_base_of_v<coroutine_stackless_data, Promise>)
+        {
+            threads::thread_pool_base* pool = rh.promise().stackless_pool_;
+            if (pool != nullptr)
+            {
+                bool registered = false;
+                try
+                {
+                    // the coroutine runs until it suspends again or returns,
+                    // which is all a stackless thread is allowed to do
+                    threads::thread_init_data data(
+                        threads::make_thread_function_nullary(
+                            [rh]() { rh.resume(); }),
+                        util::thread_description("resume_coroutine"),
+                        threads::thread_priority::default_,
+                        threads::thread_schedule_hint(),
+                        threads::thread_stacksize::nostack);
+
+                    threads::register_work(data, pool);
+                    registered = true;
+                }
+                catch (...)
+                {
+                    // the coroutine is resumed inline below if no thread
+                    // could be created for it, otherwise it would leak
+                }
+
+                if (registered)
+                    return;
+            }
+        }
+        rh();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Allow using co_await with an expression which evaluates to
     // hpx::future<T>.
@@ -68,7 +131,7 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 rh.promise().set_exception(st->get_exception_ptr());
             }
-            rh();
+            resume_coroutine(rh);
         });
     }
 
@@ -110,7 +173,7 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 rh.promise().set_exception(st->get_exception_ptr());
             }
-            rh();
+            resume_coroutine(rh);
         });
     }
 
@@ -124,7 +187,9 @@ namespace hpx { namespace lcos { namespace detail {
     // derive from future shared state as this will be combined with the
     // necessary stack frame for the resumable function
     template <typename T, typename Derived>
-    struct coroutine_promise_base : hpx::lcos::detail::future_data<T>
+    struct coroutine_promise_base
+      : hpx::lcos::detail::future_data<T>
+      , coroutine_stackless_data
     {
         using base_type = hpx::lcos::detail::future_data<T>;
         using init_no_addref = typename base_type::init_no_addref;
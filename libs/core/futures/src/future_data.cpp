@@ -18,8 +18,12 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <mutex>
@@ -35,6 +39,41 @@ namespace hpx { namespace lcos { namespace detail {
         run_on_completed_error_handler = f;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<bool> inline_child_tasks_enabled(false);
+    static std::atomic<std::int64_t> inlined_child_tasks_count(0);
+
+    void set_inline_child_tasks_enabled(bool enable) noexcept
+    {
+        inline_child_tasks_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    bool get_inline_child_tasks_enabled() noexcept
+    {
+        return inline_child_tasks_enabled.load(std::memory_order_relaxed);
+    }
+
+    bool can_run_child_task_inline(threads::thread_pool_base* pool)
+    {
+        // only HPX threads of the pool the task has been scheduled on may
+        // run it, and only if there is enough stack space left
+        return threads::get_self_ptr() != nullptr &&
+            threads::detail::get_self_or_default_pool() == pool &&
+            hpx::this_thread::has_sufficient_stack_space();
+    }
+
+    std::int64_t get_inlined_child_tasks_count(bool reset)
+    {
+        return reset ?
+            inlined_child_tasks_count.exchange(0, std::memory_order_relaxed) :
+            inlined_child_tasks_count.load(std::memory_order_relaxed);
+    }
+
+    void increment_inlined_child_tasks_count() noexcept
+    {
+        inlined_child_tasks_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
     ///////////////////////////////////////////////////////////////////////////
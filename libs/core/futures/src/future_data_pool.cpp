@@ -0,0 +1,292 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    namespace {
+
+        constexpr std::size_t granularity = 16;
+        constexpr std::size_t num_size_classes = 32;
+        constexpr std::size_t max_pooled_size = granularity * num_size_classes;
+
+        // the maximal number of blocks cached per size class and OS-thread
+        constexpr std::size_t max_cached_blocks = 256;
+
+        // marks blocks which have not been allocated from a size class
+        constexpr std::uint32_t no_size_class = std::uint32_t(-1);
+
+        struct block_header
+        {
+            std::uint32_t size_class_;
+        };
+
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        constexpr std::size_t round_up(std::size_t size) noexcept
+        {
+            constexpr std::size_t alignment = alignof(std::max_align_t);
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr std::size_t header_size = round_up(sizeof(block_header));
+
+        void increment(std::atomic<std::int64_t>& counter) noexcept
+        {
+            // counters are modified by the owning thread only
+            counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+        }
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& counter, bool reset) noexcept
+        {
+            return reset ? counter.exchange(0, std::memory_order_relaxed) :
+                           counter.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<bool> pool_enabled(true);
+
+        ///////////////////////////////////////////////////////////////////////
+        struct thread_cache
+        {
+            // only accessed by the owning thread
+            struct free_list
+            {
+                free_block* head_ = nullptr;
+                std::size_t count_ = 0;
+            };
+            free_list lists_[num_size_classes];
+
+            std::atomic<std::int64_t> hits_{0};
+            std::atomic<std::int64_t> misses_{0};
+        };
+
+        // Keeps track of the caches of all running OS-threads, the counters of
+        // exited threads are accumulated separately.
+        struct cache_registry
+        {
+            std::mutex mtx_;
+            std::vector<thread_cache*> caches_;
+            std::atomic<std::int64_t> retired_hits_{0};
+            std::atomic<std::int64_t> retired_misses_{0};
+        };
+
+        cache_registry& get_registry()
+        {
+            static cache_registry registry;
+            return registry;
+        }
+
+        template <typename F>
+        std::int64_t accumulate_all(F&& f)
+        {
+            cache_registry& r = get_registry();
+            std::lock_guard<std::mutex> l(r.mtx_);
+
+            std::int64_t result = f(r.retired_hits_, r.retired_misses_);
+            for (thread_cache* cache : r.caches_)
+            {
+                result += f(cache->hits_, cache->misses_);
+            }
+            return result;
+        }
+
+        // Fast access to the cache of the current OS-thread, these are
+        // trivially destructible to avoid the overhead of checking whether
+        // the variables have been constructed already.
+        thread_local thread_cache* local_cache = nullptr;
+        thread_local bool local_cache_destroyed = false;
+
+        // Releases the cache of an exiting OS-thread.
+        struct thread_cache_owner
+        {
+            bool has_cache_ = false;
+
+            ~thread_cache_owner()
+            {
+                if (!has_cache_)
+                {
+                    return;
+                }
+
+                thread_cache* cache = local_cache;
+                local_cache = nullptr;
+                local_cache_destroyed = true;
+
+                {
+                    cache_registry& r = get_registry();
+                    std::lock_guard<std::mutex> l(r.mtx_);
+
+                    r.retired_hits_.fetch_add(
+                        cache->hits_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+                    r.retired_misses_.fetch_add(
+                        cache->misses_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+
+                    r.caches_.erase(
+                        std::find(r.caches_.begin(), r.caches_.end(), cache));
+                }
+
+                for (thread_cache::free_list& list : cache->lists_)
+                {
+                    while (list.head_ != nullptr)
+                    {
+                        free_block* b = list.head_;
+                        list.head_ = b->next_;
+                        ::operator delete(
+                            reinterpret_cast<char*>(b) - header_size);
+                    }
+                }
+                delete cache;
+            }
+        };
+
+        thread_local thread_cache_owner cache_owner;
+
+        thread_cache* create_thread_cache()
+        {
+            thread_cache* cache = new thread_cache;
+            {
+                cache_registry& r = get_registry();
+                std::lock_guard<std::mutex> l(r.mtx_);
+                r.caches_.push_back(cache);
+            }
+
+            local_cache = cache;
+            cache_owner.has_cache_ = true;
+
+            return cache;
+        }
+
+        // returns nullptr if the OS-thread is exiting already
+        thread_cache* get_thread_cache()
+        {
+            thread_cache* cache = local_cache;
+            if (HPX_UNLIKELY(cache == nullptr) && !local_cache_destroyed)
+            {
+                cache = create_thread_cache();
+            }
+            return cache;
+        }
+
+        void* allocate_block(std::size_t size, std::uint32_t size_class)
+        {
+            void* p = ::operator new(header_size + size);
+            static_cast<block_header*>(p)->size_class_ = size_class;
+            return static_cast<char*>(p) + header_size;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* allocate_future_data(std::size_t size)
+    {
+        if (!pool_enabled.load(std::memory_order_relaxed))
+        {
+            return allocate_block(size, no_size_class);
+        }
+
+        thread_cache* cache = get_thread_cache();
+        if (size > max_pooled_size || cache == nullptr)
+        {
+            if (cache != nullptr)
+            {
+                increment(cache->misses_);
+            }
+            return allocate_block(size, no_size_class);
+        }
+
+        std::size_t const size_class =
+            size == 0 ? 0 : (size - 1) / granularity;
+
+        thread_cache::free_list& list = cache->lists_[size_class];
+        free_block* b = list.head_;
+        if (b == nullptr)
+        {
+            increment(cache->misses_);
+            return allocate_block((size_class + 1) * granularity,
+                static_cast<std::uint32_t>(size_class));
+        }
+
+        increment(cache->hits_);
+
+        list.head_ = b->next_;
+        --list.count_;
+        return b;
+    }
+
+    void deallocate_future_data(void* p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        char* block = static_cast<char*>(p) - header_size;
+        std::uint32_t const size_class =
+            reinterpret_cast<block_header*>(block)->size_class_;
+
+        // blocks are cached only by OS-threads which have a cache already
+        thread_cache* cache = local_cache;
+        if (size_class != no_size_class && cache != nullptr &&
+            pool_enabled.load(std::memory_order_relaxed))
+        {
+            HPX_ASSERT(size_class < num_size_classes);
+
+            thread_cache::free_list& list = cache->lists_[size_class];
+            if (list.count_ < max_cached_blocks)
+            {
+                list.head_ = new (p) free_block{list.head_};
+                ++list.count_;
+                return;
+            }
+        }
+
+        ::operator delete(block);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_future_data_pool_enabled(bool enable) noexcept
+    {
+        pool_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    bool get_future_data_pool_enabled() noexcept
+    {
+        return pool_enabled.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t get_future_data_pool_hits(bool reset)
+    {
+        return accumulate_all([reset](std::atomic<std::int64_t>& hits,
+                                  std::atomic<std::int64_t>&) {
+            return get_and_reset(hits, reset);
+        });
+    }
+
+    std::int64_t get_future_data_pool_misses(bool reset)
+    {
+        return accumulate_all([reset](std::atomic<std::int64_t>&,
+                                  std::atomic<std::int64_t>& misses) {
+            return get_and_reset(misses, reset);
+        });
+    }
+}}}    // namespace hpx::lcos::detail
@@ -16,6 +16,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -176,6 +177,60 @@ void simple_recursive_await_shared_tests()
     HPX_TEST_EQ(shared_fib2(10).get(), 55);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool is_stackless()
+{
+    return hpx::threads::get_self_stacksize_enum() ==
+        hpx::threads::thread_stacksize::nostack;
+}
+
+hpx::future<int> stackless_test()
+{
+    HPX_TEST(is_stackless());
+    auto result = co_await hpx::async(just_wait, 42);
+
+    // the coroutine is resumed on a new stackless thread
+    HPX_TEST(is_stackless());
+    co_return result;
+}
+
+hpx::future<int> stackless_wait(hpx::shared_future<int> f)
+{
+    auto result = co_await f;
+    HPX_TEST(is_stackless());
+    co_return result;
+}
+
+void stackless_await_tests()
+{
+    auto const policy = hpx::execution::experimental::with_stacksize(
+        hpx::launch::async, hpx::threads::thread_stacksize::nostack);
+
+    hpx::future<int> f1 = hpx::async(policy, &stackless_test);
+    HPX_TEST_EQ(f1.get(), 42);
+
+    // many coroutines suspended on the same future
+    hpx::lcos::local::promise<int> p;
+    hpx::shared_future<int> sf = p.get_future();
+
+    std::vector<hpx::future<int>> futures;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async(policy, &stackless_wait, sf));
+    }
+    p.set_value(42);
+
+    for (auto& f : futures)
+    {
+        HPX_TEST_EQ(f.get(), 42);
+    }
+
+    // coroutines which have not been started on a stackless thread are
+    // resumed by the thread which makes the awaited future ready
+    HPX_TEST(!is_stackless());
+    HPX_TEST_EQ(async_test1().get(), 42);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -185,6 +240,8 @@ int hpx_main()
     simple_await_shared_tests();
     simple_recursive_await_shared_tests();
 
+    stackless_await_tests();
+
     return hpx::local::finalize();
 }
 
@@ -0,0 +1,207 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::lcos::detail::allocate_future_data;
+using hpx::lcos::detail::deallocate_future_data;
+using hpx::lcos::detail::get_future_data_pool_enabled;
+using hpx::lcos::detail::get_future_data_pool_hits;
+using hpx::lcos::detail::get_future_data_pool_misses;
+using hpx::lcos::detail::set_future_data_pool_enabled;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    void* p = allocate_future_data(40);
+    deallocate_future_data(p);
+
+    std::int64_t const hits = get_future_data_pool_hits(false);
+
+    // a block of the same size class is handed out again
+    void* q = allocate_future_data(48);
+    HPX_TEST_EQ(p, q);
+    HPX_TEST(get_future_data_pool_hits(false) > hits);
+
+    deallocate_future_data(q);
+}
+
+void test_sizes()
+{
+    std::vector<void*> blocks;
+    for (std::size_t size = 1; size <= 1024; size += 7)
+    {
+        void* p = allocate_future_data(size);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(
+            reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t),
+            std::uintptr_t(0));
+
+        std::memset(p, 0xff, size);
+        blocks.push_back(p);
+    }
+
+    for (void* p : blocks)
+    {
+        deallocate_future_data(p);
+    }
+}
+
+void test_disabled()
+{
+    // blocks allocated while the pool was enabled may be released after it
+    // was disabled and vice versa
+    void* p = allocate_future_data(64);
+    set_future_data_pool_enabled(false);
+    HPX_TEST(!get_future_data_pool_enabled());
+
+    void* q = allocate_future_data(64);
+    deallocate_future_data(p);
+
+    std::int64_t const hits = get_future_data_pool_hits(false);
+    std::int64_t const misses = get_future_data_pool_misses(false);
+
+    void* r = allocate_future_data(64);
+    HPX_TEST_EQ(get_future_data_pool_hits(false), hits);
+    HPX_TEST_EQ(get_future_data_pool_misses(false), misses);
+
+    set_future_data_pool_enabled(true);
+    deallocate_future_data(q);
+    deallocate_future_data(r);
+}
+
+void test_other_thread()
+{
+    std::vector<void*> blocks(1000);
+    std::thread([&]() {
+        for (void*& p : blocks)
+        {
+            p = allocate_future_data(32);
+        }
+    }).join();
+
+    // blocks are released on a thread different from the one which
+    // allocated them, the allocating thread has exited already
+    std::thread([&]() {
+        for (void* p : blocks)
+        {
+            deallocate_future_data(p);
+        }
+    }).join();
+}
+
+// shared states created with new (std::nothrow) are taken from the pool
+void test_nothrow_new()
+{
+    using shared_state_type = hpx::lcos::detail::future_data<int>;
+
+    hpx::intrusive_ptr<shared_state_type> p(
+        new (std::nothrow) shared_state_type());
+    HPX_TEST(p);
+
+    hpx::future<int> f =
+        hpx::traits::future_access<hpx::future<int>>::create(p);
+    p->set_value(42);
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+void test_futures()
+{
+    for (bool const use_pool : {true, false, true})
+    {
+        set_future_data_pool_enabled(use_pool);
+
+        std::vector<hpx::future<int>> futures;
+        for (int i = 0; i != 100; ++i)
+        {
+            futures.push_back(hpx::async([i]() { return i; }).then(
+                [](hpx::future<int>&& f) { return f.get() + 1; }));
+        }
+
+        for (int i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(futures[i].get(), i + 1);
+        }
+
+        hpx::lcos::local::promise<std::string> p;
+        hpx::future<std::string> f = p.get_future();
+        p.set_value("value");
+        HPX_TEST_EQ(f.get(), std::string("value"));
+    }
+}
+
+// hpx::dataflow takes its frames from the pool, an allocator passed
+// explicitly is used as given
+void test_dataflow_allocator()
+{
+    auto inc = [](hpx::future<int>&& f) { return f.get() + 1; };
+
+    hpx::future<int> f1 = hpx::make_ready_future(41);
+    hpx::future<int> f2 = hpx::make_ready_future(41);
+
+    std::int64_t allocations = get_future_data_pool_hits(false) +
+        get_future_data_pool_misses(false);
+
+    hpx::future<int> r1 = hpx::dataflow(hpx::launch::sync, inc, HPX_MOVE(f1));
+    HPX_TEST(get_future_data_pool_hits(false) +
+            get_future_data_pool_misses(false) >
+        allocations);
+
+    allocations = get_future_data_pool_hits(false) +
+        get_future_data_pool_misses(false);
+
+    hpx::future<int> r2 = hpx::dataflow_alloc(hpx::util::internal_allocator<>{},
+        hpx::launch::sync, inc, HPX_MOVE(f2));
+    HPX_TEST_EQ(get_future_data_pool_hits(false) +
+            get_future_data_pool_misses(false),
+        allocations);
+
+    HPX_TEST_EQ(r1.get(), 42);
+    HPX_TEST_EQ(r2.get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // the pool is enabled by default
+    HPX_TEST(get_future_data_pool_enabled());
+
+    test_reuse();
+    test_sizes();
+    test_disabled();
+    test_other_thread();
+    test_nothrow_new();
+    test_futures();
+    test_dataflow_allocator();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
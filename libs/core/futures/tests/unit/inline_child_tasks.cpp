@@ -0,0 +1,162 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::lcos::detail::get_inline_child_tasks_enabled;
+using hpx::lcos::detail::get_inlined_child_tasks_count;
+using hpx::lcos::detail::set_inline_child_tasks_enabled;
+
+hpx::thread::id get_id()
+{
+    return hpx::this_thread::get_id();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// This test runs on a single worker thread, a child task can't start before
+// its parent waits for it.
+void test_inline()
+{
+    std::int64_t const count = get_inlined_child_tasks_count(false);
+
+    hpx::future<hpx::thread::id> f = hpx::async(&get_id);
+    HPX_TEST(f.get() == hpx::this_thread::get_id());
+    HPX_TEST_EQ(get_inlined_child_tasks_count(false), count + 1);
+
+    hpx::future<void> v = hpx::async([]() {});
+    v.wait();
+    HPX_TEST(v.is_ready());
+    HPX_TEST_EQ(get_inlined_child_tasks_count(false), count + 2);
+}
+
+void test_disabled()
+{
+    set_inline_child_tasks_enabled(false);
+
+    std::int64_t const count = get_inlined_child_tasks_count(false);
+
+    hpx::future<hpx::thread::id> f = hpx::async(&get_id);
+    HPX_TEST(f.get() != hpx::this_thread::get_id());
+    HPX_TEST_EQ(get_inlined_child_tasks_count(false), count);
+
+    set_inline_child_tasks_enabled(true);
+}
+
+void test_not_inlined()
+{
+    std::int64_t const count = get_inlined_child_tasks_count(false);
+
+    // tasks which have to run on a specific worker thread
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_schedule_hint(0));
+    hpx::future<hpx::thread::id> f1 = hpx::async(exec, &get_id);
+    HPX_TEST(f1.get() != hpx::this_thread::get_id());
+
+    // tasks which have to run with a specific priority
+    hpx::launch policy = hpx::launch::async;
+    policy.set_priority(hpx::threads::thread_priority::high);
+    hpx::future<hpx::thread::id> f2 = hpx::async(policy, &get_id);
+    HPX_TEST(f2.get() != hpx::this_thread::get_id());
+
+    // deferred tasks are not counted
+    hpx::future<hpx::thread::id> f3 =
+        hpx::async(hpx::launch::deferred, &get_id);
+    HPX_TEST(f3.get() == hpx::this_thread::get_id());
+
+    HPX_TEST_EQ(get_inlined_child_tasks_count(false), count);
+}
+
+void test_wait_for()
+{
+    // a task which has not started yet is not reported as deferred
+    hpx::future<int> f = hpx::async([]() { return 42; });
+    HPX_TEST(f.wait_for(std::chrono::seconds(0)) !=
+        hpx::future_status::deferred);
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+void test_exception()
+{
+    hpx::future<void> f =
+        hpx::async([]() { throw std::runtime_error("inline"); });
+
+    bool caught = false;
+    try
+    {
+        f.get();
+    }
+    catch (std::runtime_error const& e)
+    {
+        caught = std::string(e.what()) == "inline";
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fib(std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    hpx::future<std::uint64_t> f = hpx::async(&fib, n - 1);
+    std::uint64_t const r = fib(n - 2);
+    return f.get() + r;
+}
+
+void test_recursion()
+{
+    // deeply nested tasks fall back to running on their own thread once the
+    // stack of the waiting thread is exhausted
+    HPX_TEST_EQ(fib(22), std::uint64_t(17711));
+
+    std::vector<hpx::future<std::uint64_t>> futures;
+    for (std::uint64_t i = 0; i != 10; ++i)
+    {
+        futures.push_back(hpx::async(&fib, i + 10));
+    }
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(futures.back().get(), std::uint64_t(4181));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // inlining has been enabled by the configuration
+    HPX_TEST(get_inline_child_tasks_enabled());
+
+    test_inline();
+    test_disabled();
+    test_not_inlined();
+    test_wait_for();
+    test_exception();
+    test_recursion();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1", "hpx.inline_child_tasks=1"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
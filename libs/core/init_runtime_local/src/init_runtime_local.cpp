@@ -15,6 +15,7 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/init_runtime_local/detail/init_logging.hpp>
 #include <hpx/init_runtime_local/init_runtime_local.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
@@ -259,6 +260,10 @@ namespace hpx {
                 util::detail::set_spinlock_deadlock_detection_limit(
                     cmdline.rtcfg_.get_spinlock_deadlock_detection_limit());
 #endif
+                lcos::detail::set_future_data_pool_enabled(
+                    cmdline.rtcfg_.use_future_data_pool());
+                lcos::detail::set_inline_child_tasks_enabled(
+                    cmdline.rtcfg_.use_inline_child_tasks());
 #if defined(HPX_HAVE_LOGGING)
                 util::detail::init_logging_local(cmdline.rtcfg_);
 #else
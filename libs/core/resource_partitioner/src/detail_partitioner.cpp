@@ -149,6 +149,9 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_workstealing:
+            sched = "local_workstealing";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -247,6 +250,14 @@ namespace hpx { namespace resource { namespace detail {
                 "modes");
         }
 
+        // let idle worker threads park instead of spinning
+        if (util::get_entry_as<int>(rtcfg_, "hpx.idle_parking", 0) != 0)
+        {
+            default_scheduler_mode_ = threads::policies::scheduler_mode(
+                default_scheduler_mode_ |
+                threads::policies::scheduler_mode::enable_idle_parking);
+        }
+
         // Create the default pool
         initial_thread_pools_.push_back(init_pool_data("default",
             scheduling_policy::unspecified, default_scheduler_mode_));
@@ -475,6 +486,11 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 ==
+            std::string("local-workstealing").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workstealing;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -276,6 +276,7 @@ int main(int argc, char* argv[])
 #endif
         hpx::resource::scheduling_policy::static_,
         hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::local_workstealing,
         // The shared_priority scheduler sometimes hangs in this test.
         //hpx::resource::scheduling_policy::shared_priority,
     };
@@ -90,6 +90,9 @@ namespace hpx { namespace util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the time (in milliseconds) decref requests are buffered
+        std::size_t get_agas_max_pending_refcnt_delay() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -109,6 +112,12 @@ namespace hpx { namespace util {
         bool enable_spinlock_deadlock_detection() const;
         std::size_t get_spinlock_deadlock_detection_limit() const;
 
+        // Allocate the shared states of futures from the future_data pool
+        bool use_future_data_pool() const;
+
+        // Let threads waiting for the result of a task run it inline
+        bool use_inline_child_tasks() const;
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
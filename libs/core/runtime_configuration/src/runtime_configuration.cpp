@@ -149,6 +149,8 @@ namespace hpx { namespace util {
 #endif
             "expect_connecting_localities = "
             "${HPX_EXPECT_CONNECTING_LOCALITIES:0}",
+            "future_data_pool = ${HPX_FUTURE_DATA_POOL:1}",
+            "inline_child_tasks = ${HPX_INLINE_CHILD_TASKS:0}",
 
             // add placeholders for keys to be added by command line handling
             "os_threads = cores",
@@ -172,6 +174,7 @@ namespace hpx { namespace util {
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
 #endif
+            "idle_parking = ${HPX_IDLE_PARKING:0}",
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
         /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
@@ -189,6 +192,10 @@ namespace hpx { namespace util {
             "[hpx.lcos.collectives]",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
+            // arity of hierarchical communicators, zero selects the arity
+            // based on the number of participating sites
+            "hierarchical_arity = "
+            "${HPX_LCOS_COLLECTIVES_HIERARCHICAL_ARITY:0}",
 
             // connect back to the given latch if specified
             "[hpx.on_startup]",
@@ -302,6 +309,8 @@ namespace hpx { namespace util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "max_pending_refcnt_delay = "
+            "${HPX_AGAS_MAX_PENDING_REFCNT_DELAY:10}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -917,6 +926,17 @@ namespace hpx { namespace util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_max_pending_refcnt_delay()
+        const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "max_pending_refcnt_delay", 10);
+        }
+        return 10;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -1009,6 +1029,29 @@ namespace hpx { namespace util {
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocate the shared states of futures from the future_data pool
+    bool runtime_configuration::use_future_data_pool() const
+    {
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "future_data_pool", 1) != 0;
+        }
+        return true;
+    }
+
+    // Let threads waiting for the result of a task run it inline
+    bool runtime_configuration::use_inline_child_tasks() const
+    {
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "inline_child_tasks", 0) != 0;
+        }
+        return false;
+    }
+
     std::size_t runtime_configuration::trace_depth() const
     {
         if (util::section const* sec = get_section("hpx"); nullptr != sec)
@@ -260,8 +260,9 @@ namespace hpx { namespace util { namespace detail {
                 result = f_();    // invoke the supplied function
             }
 
-            // some other thread might already have started the timer
-            if (nullptr == id_ && result)
+            // some other thread might already have started the timer, the
+            // supplied function might have stopped it
+            if (nullptr == id_ && result && !is_stopped_)
             {
                 HPX_ASSERT(!is_started_);
                 schedule_thread(l);    // wait and repeat
@@ -0,0 +1,406 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/detail/chase_lev_deque.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/thread_queue.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workstealing_scheduler maintains one Chase-Lev deque per OS
+    /// thread in addition to the queues of the local_queue_scheduler. Threads
+    /// created or made ready by a worker thread are pushed onto the deque of
+    /// this worker, which pops them in LIFO order. Idle workers steal half of
+    /// the threads from the deque of a randomly selected victim, preferring
+    /// victims in the same NUMA domain.
+    ///
+    /// As a Chase-Lev deque can be pushed to by its owner only, threads
+    /// scheduled from outside of the worker thread (and threads which are
+    /// rescheduled after yielding) are placed into the queue of the
+    /// local_queue_scheduler, which serves as the inbox of the worker. Threads
+    /// with a priority other than normal are always handed to the
+    /// local_queue_scheduler. Stealing, from both the deques and the inboxes
+    /// of other workers, is done only if enable_stealing is set.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_queue_scheduler_terminated_queue>
+    class local_workstealing_scheduler
+      : public local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+        using thread_queue_type = typename base_type::thread_queue_type;
+
+    private:
+        using thread_repr = thread_id_ref_type::thread_repr;
+        using deque_type = hpx::concurrency::detail::chase_lev_deque<
+            thread_repr*>;
+
+        // the maximal number of threads taken from a victim at once
+        static constexpr std::size_t max_steal_count = 32;
+
+        struct worker_data
+        {
+            worker_data()
+              : random_state_(0)
+            {
+            }
+
+            deque_type deque_;
+
+            // state of the random number generator used to select victims
+            std::uint64_t random_state_;
+
+            // the other workers, grouped by NUMA domain
+            std::vector<std::size_t> local_victims_;
+            std::vector<std::size_t> remote_victims_;
+        };
+
+    public:
+        local_workstealing_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , num_workers_(init.num_queues_)
+          , workers_(new util::cache_aligned_data<worker_data>[num_workers_])
+        {
+        }
+
+        ~local_workstealing_scheduler()
+        {
+            // release the references held for the threads which were never
+            // run
+            thread_repr* p = nullptr;
+            for (std::size_t i = 0; i != num_workers_; ++i)
+            {
+                while (workers_[i].data_.deque_.pop(p))
+                {
+                    thread_id_ref_type thrd(p, thread_id_addref::no);
+                }
+            }
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_workstealing_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            std::size_t const num_thread = get_local_worker(data.schedulehint);
+            if (num_thread == std::size_t(-1) || !data.run_now ||
+                data.initial_state != thread_schedule_state::pending ||
+                !is_normal_priority(data.priority))
+            {
+                base_type::create_thread(data, id, ec);
+                return;
+            }
+
+            // create the thread suspended to prevent it from being placed
+            // into the queue, it is pushed onto the deque instead
+            data.initial_state = thread_schedule_state::suspended;
+
+            thread_id_ref_type thrd;
+            this->queues_[num_thread]->create_thread(data, &thrd, ec);
+            if (ec)
+                return;
+
+            get_thread_id_data(thrd)->set_state(
+                thread_schedule_state::pending);
+
+            if (id)
+                *id = thrd;
+
+            LTM_(debug)
+                .format("local_workstealing_scheduler::create_thread: "
+                        "pool({}), scheduler({}), worker_thread({}), "
+                        "thread({})",
+                    *this->get_parent_pool(), *this, num_thread,
+                    thrd.noref())
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+                .format(", description({})", data.description)
+#endif
+                ;
+
+            workers_[num_thread].data_.deque_.push(thrd.detach());
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing) override
+        {
+            HPX_ASSERT(num_thread < num_workers_);
+
+            worker_data& d = workers_[num_thread].data_;
+
+            // threads created by this worker are run first, in LIFO order
+            thread_repr* p = nullptr;
+            if (d.deque_.pop(p))
+            {
+                thrd.reset(p, false);    // do not addref!
+                return true;
+            }
+
+            {
+                thread_queue_type* q = this->queues_[num_thread];
+                bool result = q->get_next_thread(thrd);
+
+                q->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                q->increment_num_pending_misses();
+
+                bool have_staged =
+                    q->get_staged_queue_length(std::memory_order_relaxed) != 0;
+
+                // Give up, we should have work to convert.
+                if (have_staged)
+                    return false;
+            }
+
+            if (!running || !enable_stealing)
+            {
+                return false;
+            }
+
+            // steal from a random victim in the same NUMA domain first
+            if (steal_from(num_thread, d.local_victims_, running, thrd))
+                return true;
+
+            if (this->has_scheduler_mode(policies::enable_stealing_numa))
+                return steal_from(num_thread, d.remote_victims_, running, thrd);
+
+            return false;
+        }
+
+        /// Schedule the passed thread
+        void schedule_thread(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint, bool allow_fallback,
+            thread_priority priority = thread_priority::normal) override
+        {
+            // only the owning worker may push onto its deque, threads with a
+            // non-normal priority are left to the base scheduler
+            std::size_t const num_thread = get_local_worker(schedulehint);
+            if (num_thread == std::size_t(-1) || !is_normal_priority(priority))
+            {
+                base_type::schedule_thread(
+                    HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            HPX_ASSERT(get_thread_id_data(thrd)->get_scheduler_base() == this);
+
+            LTM_(debug).format("local_workstealing_scheduler::schedule_thread: "
+                               "pool({}), scheduler({}), worker_thread({}), "
+                               "thread({}), description({})",
+                *this->get_parent_pool(), *this, num_thread,
+                get_thread_id_data(thrd)->get_thread_id(),
+                get_thread_id_data(thrd)->get_description());
+
+            workers_[num_thread].data_.deque_.push(thrd.detach());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // This returns the current length of the queues and deques
+        std::int64_t get_queue_length(
+            std::size_t num_thread = std::size_t(-1)) const override
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < num_workers_);
+
+                return base_type::get_queue_length(num_thread) +
+                    static_cast<std::int64_t>(
+                        workers_[num_thread].data_.deque_.size());
+            }
+
+            std::int64_t count = base_type::get_queue_length();
+            for (std::size_t i = 0; i != num_workers_; ++i)
+            {
+                count +=
+                    static_cast<std::int64_t>(workers_[i].data_.deque_.size());
+            }
+            return count;
+        }
+
+        // Queries whether a given core is idle
+        bool is_core_idle(std::size_t num_thread) const override
+        {
+            return workers_[num_thread].data_.deque_.empty() &&
+                base_type::is_core_idle(num_thread);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_start_thread(std::size_t num_thread) override
+        {
+            base_type::on_start_thread(num_thread);
+
+            worker_data& d = workers_[num_thread].data_;
+
+            // seed the random number generator, it must not be zero
+            d.random_state_ = 0x9e3779b97f4a7c15ull * (num_thread + 1);
+
+            d.local_victims_.clear();
+            d.remote_victims_.clear();
+
+            mask_cref_type numa_domain =
+                this->numa_domain_masks_[num_thread];
+            for (std::size_t i = 0; i != num_workers_; ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                if (test(numa_domain, this->affinity_data_.get_pu_num(i)))
+                    d.local_victims_.push_back(i);
+                else
+                    d.remote_victims_.push_back(i);
+            }
+        }
+
+    private:
+        static constexpr bool is_normal_priority(
+            thread_priority priority) noexcept
+        {
+            return priority == thread_priority::default_ ||
+                priority == thread_priority::normal;
+        }
+
+        // Return the number of the calling worker thread if it belongs to
+        // this scheduler and if the given hint does not ask for another worker
+        // thread, otherwise return -1.
+        std::size_t get_local_worker(
+            thread_schedule_hint const& schedulehint) const
+        {
+            std::size_t const num_thread =
+                hpx::threads::detail::get_local_thread_num_tss();
+            if (num_thread >= num_workers_ ||
+                hpx::threads::detail::get_thread_pool_num_tss() !=
+                    this->get_parent_pool()->get_pool_id().index())
+            {
+                return std::size_t(-1);
+            }
+
+            switch (schedulehint.mode)
+            {
+            case thread_schedule_hint_mode::none:
+                return num_thread;
+
+            case thread_schedule_hint_mode::thread:
+                if (schedulehint.hint < 0 ||
+                    std::size_t(schedulehint.hint) % num_workers_ ==
+                        num_thread)
+                {
+                    return num_thread;
+                }
+                return std::size_t(-1);
+
+            default:
+                return std::size_t(-1);
+            }
+        }
+
+        std::size_t next_random(worker_data& d) noexcept
+        {
+            // xorshift64
+            std::uint64_t x = d.random_state_;
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            d.random_state_ = x;
+            return static_cast<std::size_t>(x);
+        }
+
+        // Try to steal from the given victims, starting with a randomly
+        // selected one. Half of the threads found on the deque of the victim
+        // are moved to the deque of the stealing worker.
+        bool steal_from(std::size_t num_thread,
+            std::vector<std::size_t> const& victims, bool running,
+            threads::thread_id_ref_type& thrd)
+        {
+            std::size_t const num_victims = victims.size();
+            if (num_victims == 0)
+                return false;
+
+            worker_data& d = workers_[num_thread].data_;
+            std::size_t const start = next_random(d) % num_victims;
+
+            for (std::size_t i = 0; i != num_victims; ++i)
+            {
+                std::size_t const idx = victims[(start + i) % num_victims];
+                deque_type& victim = workers_[idx].data_.deque_;
+
+                thread_repr* p = nullptr;
+                if (victim.steal(p))
+                {
+                    thrd.reset(p, false);    // do not addref!
+
+                    std::size_t count = 1;
+                    std::size_t const max_count =
+                        (std::min)(victim.size() / 2, max_steal_count);
+                    while (count <= max_count && victim.steal(p))
+                    {
+                        d.deque_.push(p);
+                        ++count;
+                    }
+
+                    this->queues_[idx]->increment_num_stolen_from_pending(
+                        count);
+                    this->queues_[num_thread]->increment_num_stolen_to_pending(
+                        count);
+                    return true;
+                }
+
+                // the queue of the victim might not exist yet
+                thread_queue_type* q = this->queues_[idx];
+                if (q != nullptr && q->get_next_thread(thrd, running))
+                {
+                    q->increment_num_stolen_from_pending();
+                    this->queues_[num_thread]
+                        ->increment_num_stolen_to_pending();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::size_t const num_workers_;
+        std::unique_ptr<util::cache_aligned_data<worker_data>[]> workers_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
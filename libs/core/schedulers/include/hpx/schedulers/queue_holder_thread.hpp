@@ -122,8 +122,6 @@ namespace hpx { namespace threads { namespace policies {
         // ----------------------------------------------------------------
         // ----------------------------------------------------------------
 
-        static util::internal_allocator<threads::thread_data> thread_alloc_;
-
         using task_description = thread_init_data;
 
         // -------------------------------------
@@ -571,9 +569,7 @@ namespace hpx { namespace threads { namespace policies {
         // ----------------------------------------------------------------
         static void deallocate(threads::thread_data* p)
         {
-            using threads::thread_data;
-            p->~thread_data();
-            thread_alloc_.deallocate(p, 1);
+            p->destroy();
         }
 
         // ----------------------------------------------------------------
@@ -1021,8 +1017,4 @@ namespace hpx { namespace threads { namespace policies {
             tq_deb.timed(deb_queues, prefix, queue_data_print(this));
         }
     };
-
-    template <typename QueueType>
-    util::internal_allocator<threads::thread_data>
-        queue_holder_thread<QueueType>::thread_alloc_;
 }}}    // namespace hpx::threads::policies
@@ -32,6 +32,13 @@ namespace hpx::serialization {
             char const* buffer, std::size_t size, std::size_t buffer_size) = 0;
         virtual void load(void* dst, std::size_t dst_count) = 0;
 
+        // Filters returning true receive all data of an archive, including
+        // arrays which would otherwise be sent as separate zero-copy chunks.
+        virtual bool disable_data_chunking() const noexcept
+        {
+            return false;
+        }
+
         template <typename T>
         void serialize(T& /*ar*/, unsigned)
         {
@@ -0,0 +1,63 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_EXPERIMENTAL_SIMD)
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <array>
+#include <cstddef>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+// The values are serialized element by element, the layout of the simd types
+// is implementation defined and may differ between the localities.
+namespace hpx { namespace serialization {
+
+    template <typename T, typename Abi>
+    void serialize(
+        input_archive& ar, std::experimental::simd<T, Abi>& v, unsigned)
+    {
+        std::array<T, std::experimental::simd<T, Abi>::size()> data;
+        ar& data;
+        v.copy_from(data.data(), std::experimental::element_aligned);
+    }
+
+    template <typename T, typename Abi>
+    void serialize(
+        input_archive& ar, std::experimental::simd_mask<T, Abi>& m, unsigned)
+    {
+        std::array<bool, std::experimental::simd_mask<T, Abi>::size()> data;
+        ar& data;
+        m.copy_from(data.data(), std::experimental::element_aligned);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    void serialize(
+        output_archive& ar, std::experimental::simd<T, Abi> const& v, unsigned)
+    {
+        std::array<T, std::experimental::simd<T, Abi>::size()> data;
+        v.copy_to(data.data(), std::experimental::element_aligned);
+        ar& data;
+    }
+
+    template <typename T, typename Abi>
+    void serialize(output_archive& ar,
+        std::experimental::simd_mask<T, Abi> const& m, unsigned)
+    {
+        std::array<bool, std::experimental::simd_mask<T, Abi>::size()> data;
+        m.copy_to(data.data(), std::experimental::element_aligned);
+        ar& data;
+    }
+}}    // namespace hpx::serialization
+
+#endif
@@ -0,0 +1,56 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/datapar.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <experimental/simd>
+
+namespace stdx = std::experimental;
+
+template <typename V>
+void test_simd()
+{
+    using value_type = typename V::value_type;
+
+    V ov([](std::size_t i) { return value_type(i * 3 + 1); });
+    typename V::mask_type omask = ov > value_type(4);
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << ov << omask;
+
+    V iv;
+    typename V::mask_type imask;
+
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive >> iv >> imask;
+
+    for (std::size_t i = 0; i != V::size(); ++i)
+    {
+        HPX_TEST_EQ(ov[i], iv[i]);
+        HPX_TEST_EQ(bool(omask[i]), bool(imask[i]));
+    }
+}
+
+int main()
+{
+    test_simd<stdx::native_simd<float>>();
+    test_simd<stdx::native_simd<double>>();
+    test_simd<stdx::native_simd<int>>();
+    test_simd<stdx::fixed_size_simd<double, 7>>();
+    test_simd<stdx::simd<int, stdx::simd_abi::scalar>>();
+
+    return hpx::util::report_errors();
+}
@@ -219,6 +219,39 @@ namespace hpx { namespace threads { namespace detail {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
 #endif
+        std::int64_t get_armed_timers_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_armed_timers_count(num, reset);
+        }
+
+        std::int64_t get_fired_timers_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_fired_timers_count(num, reset);
+        }
+
+        std::int64_t get_cancelled_timers_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_cancelled_timers_count(num, reset);
+        }
+
+        std::int64_t get_idle_park_count(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_count(num, reset);
+        }
+
+        std::int64_t get_idle_parked_time(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_parked_time(num, reset);
+        }
+
+        std::int64_t get_idle_wakeup_count(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_wakeup_count(num, reset);
+        }
+
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
         {
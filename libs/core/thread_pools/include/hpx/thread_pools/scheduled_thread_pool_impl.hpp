@@ -1911,6 +1911,9 @@ namespace hpx { namespace threads { namespace detail {
             state.store(oldstate);
         }
 
+        // make sure the virtual core notices the change if it is idling
+        sched_->Scheduler::do_some_work(virt_core);
+
         HPX_ASSERT(oldstate == state_starting || oldstate == state_running ||
             oldstate == state_stopping || oldstate == state_stopped ||
             oldstate == state_terminating);
@@ -1964,6 +1967,9 @@ namespace hpx { namespace threads { namespace detail {
         hpx::state expected = state_running;
         state.compare_exchange_strong(expected, state_pre_sleep);
 
+        // make sure the virtual core notices the change if it is idling
+        sched_->Scheduler::do_some_work(virt_core);
+
         l.unlock();
 
         HPX_ASSERT(expected == state_running || expected == state_pre_sleep ||
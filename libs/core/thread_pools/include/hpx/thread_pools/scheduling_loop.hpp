@@ -998,6 +998,13 @@ namespace hpx { namespace threads { namespace detail {
                 }
             }
 
+            // resume the threads whose timed suspension has expired, idle
+            // workers help with the timers of the other workers
+            if (scheduler.poll_timers(num_thread, idle_loop_count != 0) != 0)
+            {
+                idle_loop_count = 0;
+            }
+
             if (scheduler.custom_polling_function() ==
                 policies::detail::polling_status::busy)
             {
@@ -0,0 +1,91 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#if !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The idle_parker is an event count which allows one worker thread to
+    // block while there is no work, other threads wake it up once new work
+    // has been made available. On Linux the worker blocks on a futex, other
+    // platforms use a condition variable.
+    //
+    // Parking is a two step protocol which avoids lost wake-ups:
+    //
+    //   auto key = parker.prepare_park();
+    //   if (/* new work is available */)
+    //       parker.cancel_park();
+    //   else
+    //       parker.park(key, timeout);
+    //
+    // Any work which has been made available before notify() is called is
+    // either seen by the re-check or causes park() to return immediately.
+    class HPX_CORE_EXPORT idle_parker
+    {
+    public:
+        idle_parker();
+
+        idle_parker(idle_parker const&) = delete;
+        idle_parker& operator=(idle_parker const&) = delete;
+
+        // Announce that the worker is about to park, the returned key has to
+        // be passed to park().
+        std::uint32_t prepare_park() noexcept;
+
+        // Withdraw the announcement made by prepare_park().
+        void cancel_park() noexcept;
+
+        // Block until notify() has been called after prepare_park() or the
+        // timeout has expired. Returns true if the worker has been notified.
+        bool park(std::uint32_t key, std::chrono::nanoseconds timeout);
+
+        // Wake up the worker if it is parked (or about to park). Returns
+        // true if the worker has been woken up by this call.
+        bool notify() noexcept;
+
+        bool is_parked() const noexcept
+        {
+            return parked_.load(std::memory_order_relaxed);
+        }
+
+        // number of times the worker has parked
+        std::int64_t get_park_count(bool reset);
+
+        // accumulated time the worker has spent parked (in nanoseconds)
+        std::int64_t get_parked_time(bool reset);
+
+        // number of times the worker has been woken up by notify()
+        std::int64_t get_wakeup_count(bool reset);
+
+    private:
+        std::atomic<std::uint32_t> epoch_;
+        std::atomic<bool> parked_;
+
+#if !defined(__linux__)
+        std::mutex mtx_;
+        std::condition_variable cond_;
+#endif
+
+        std::atomic<std::int64_t> park_count_;
+        std::atomic<std::int64_t> parked_time_;
+        std::atomic<std::int64_t> wakeup_count_;
+    };
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,96 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The thread_data_allocator hands out equally sized memory blocks for the
+    // thread_data objects from slabs cached separately for each OS-thread.
+    //
+    // Blocks are returned to the slab cache of the OS-thread which allocated
+    // them. Blocks freed by another OS-thread are pushed onto a lock-free
+    // list of the owning cache, which is reclaimed as a whole once the local
+    // list of free blocks runs empty. The cache of an exiting OS-thread is
+    // handed over to the next OS-thread requiring one.
+    //
+    // Slabs all of whose blocks are free are returned to the system once
+    // enough free blocks have accumulated in a cache (one free slab is kept
+    // to absorb the next allocations), or when the owning OS-thread exits.
+    // The remaining memory is released once the allocator is destroyed.
+    class HPX_CORE_EXPORT thread_data_allocator
+    {
+    public:
+        struct slab_cache;
+
+        // block_size is the size of the objects to allocate, blocks_per_slab
+        // the number of blocks requested from the system at once
+        explicit thread_data_allocator(
+            std::size_t block_size, std::size_t blocks_per_slab = 64);
+        ~thread_data_allocator();
+
+        thread_data_allocator(thread_data_allocator const&) = delete;
+        thread_data_allocator& operator=(thread_data_allocator const&) = delete;
+
+        void* allocate();
+        void deallocate(void* p) noexcept;
+
+        // return the completely free slabs of the slab cache of the calling
+        // OS-thread to the system
+        void trim() noexcept;
+
+        // number of allocations served from a slab cache
+        std::int64_t get_hits(bool reset);
+
+        // number of allocations which required a new slab
+        std::int64_t get_misses(bool reset);
+
+        // number of blocks freed by an OS-thread other than the owner
+        std::int64_t get_remote_frees(bool reset);
+
+        // number of slabs currently allocated from the system
+        std::int64_t get_slabs();
+
+    private:
+        slab_cache& get_slab_cache();
+        slab_cache* create_slab_cache();
+        void release_slab_cache(slab_cache* cache) noexcept;
+        void refill(slab_cache& cache);
+        void trim(slab_cache& cache) noexcept;
+
+        template <typename F>
+        std::int64_t accumulate(F&& f);
+
+        friend struct thread_slab_caches;
+
+        std::size_t const id_;
+        std::size_t const stride_;
+        std::size_t const blocks_per_slab_;
+
+        std::mutex mtx_;
+        std::vector<slab_cache*> caches_;      // all caches ever created
+        std::vector<slab_cache*> orphaned_;    // caches of exited threads
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accumulated statistics of the allocators for all thread_data types.
+    HPX_CORE_EXPORT std::int64_t get_thread_data_allocator_hits(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_thread_data_allocator_misses(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_thread_data_allocator_remote_frees(
+        bool reset);
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
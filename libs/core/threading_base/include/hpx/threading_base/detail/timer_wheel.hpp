@@ -0,0 +1,196 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    class timer_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A timer_entry describes a thread which has to be set to the given state
+    // once the expiry time has been reached.
+    struct HPX_CORE_EXPORT timer_entry
+    {
+        enum class state : std::uint8_t
+        {
+            armed = 0,        // linked into a timer_wheel
+            firing = 1,       // expired, the thread is being resumed
+            fired = 2,        // expired, the thread has been resumed
+            cancelled = 3     // removed before it expired
+        };
+
+        timer_entry(std::chrono::steady_clock::time_point const& abs_time,
+            thread_id_ref_type thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex) noexcept;
+
+        timer_entry(timer_entry const&) = delete;
+        timer_entry& operator=(timer_entry const&) = delete;
+
+        std::chrono::steady_clock::time_point abs_time_;
+        thread_id_ref_type thrd_;
+        thread_schedule_state newstate_;
+        thread_restart_state newstate_ex_;
+
+        std::atomic<state> state_;
+
+        // set by the thread waiting for this timer once it has been resumed
+        std::atomic<bool> cancel_requested_;
+
+        // the wheel this timer has been added to
+        timer_wheel* get_wheel() const noexcept
+        {
+            return wheel_;
+        }
+
+    private:
+        friend class timer_wheel;
+
+        friend void intrusive_ptr_add_ref(timer_entry* p) noexcept
+        {
+            p->count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        friend void intrusive_ptr_release(timer_entry* p) noexcept
+        {
+            if (p->count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete p;
+        }
+
+        std::atomic<std::int32_t> count_;
+
+        // managed by the timer_wheel this entry is linked into
+        timer_wheel* wheel_;
+        std::uint64_t expiry_;    // in ticks
+        timer_entry** head_;
+        timer_entry* prev_;
+        timer_entry* next_;
+    };
+
+    using timer_handle = hpx::intrusive_ptr<timer_entry>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The timer_wheel is a hierarchical timing wheel holding the timers armed
+    // on one worker thread. Each level consists of num_slots slots, a slot on
+    // level n covers num_slots^n ticks. Timers are linked into the level
+    // determined by the highest bit their expiry differs from the current
+    // tick and are moved to lower levels as time advances. Adding and
+    // cancelling a timer is O(1), expiring timers is amortized O(1) per timer.
+    //
+    // Timers never expire early, their expiry is rounded up to the next tick.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        // one tick is 2^tick_bits nanoseconds (~65us)
+        static constexpr int tick_bits = 16;
+        static constexpr int slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr int num_levels = 6;
+
+        timer_wheel();
+        ~timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+
+        // Link the given timer into this wheel. The wheel holds a reference
+        // to the timer until it has expired or has been cancelled.
+        void add(timer_entry* e);
+
+        // Remove the given timer from this wheel, returns false if the timer
+        // has already expired.
+        bool cancel(timer_entry* e);
+
+        // Remove all timers which have expired at the given point in time,
+        // their state is set to firing. Returns the number of timers added
+        // to expired. If try_lock is true, the function returns immediately
+        // if the wheel is currently locked by another thread.
+        std::size_t expire(std::chrono::steady_clock::time_point const& now,
+            std::vector<timer_handle>& expired, bool try_lock = false);
+
+        // Re-add an expired timer which could not be fired yet, it will be
+        // returned again by the next call to expire.
+        void retry(timer_entry* e);
+
+        // Return whether a timer may have expired at the given point in
+        // time. This does not acquire the lock of the wheel and may return
+        // true even if no timer expires (e.g. after a timer was cancelled).
+        bool may_expire(
+            std::chrono::steady_clock::time_point const& now) const noexcept;
+
+        // Return the earliest point in time at which a timer may have to be
+        // expired, or time_point::max() if no timer is armed.
+        std::chrono::steady_clock::time_point next_expiry() const;
+
+        // Return a lower bound for next_expiry() without acquiring the lock
+        // of the wheel, or time_point::max() if no timer is armed.
+        std::chrono::steady_clock::time_point next_expiry_hint()
+            const noexcept;
+
+        bool empty() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed) == 0;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        // number of timers added to this wheel
+        std::int64_t get_armed_count(bool reset);
+
+        // number of timers which have expired
+        std::int64_t get_fired_count(bool reset);
+
+        // number of timers which have been cancelled
+        std::int64_t get_cancelled_count(bool reset);
+
+    private:
+        using mutex_type = hpx::util::spinlock;
+
+        void link(timer_entry* e) noexcept;
+        void link_all(timer_entry* list) noexcept;
+        void unlink(timer_entry* e) noexcept;
+        timer_entry* take_slot(int level, std::size_t slot) noexcept;
+        void collect(timer_entry*& list, std::vector<timer_handle>& expired);
+        std::uint64_t next_event() const noexcept;
+        std::size_t expire_locked(
+            std::uint64_t now, std::vector<timer_handle>& expired);
+
+        mutable mutex_type mtx_;
+        std::uint64_t current_;    // current tick
+        std::atomic<std::size_t> count_;
+
+        // lower bound for the tick at which expire has to be called next,
+        // updated whenever a timer is linked or expired
+        std::atomic<std::uint64_t> next_tick_;
+
+        timer_entry* slots_[num_levels][num_slots];
+        std::uint64_t occupied_[num_levels];    // bitmask of non-empty slots
+        timer_entry* overflow_;    // timers beyond the range of all levels
+        timer_entry* due_;         // timers which have expired already
+
+        std::atomic<std::int64_t> armed_;
+        std::atomic<std::int64_t> fired_;
+        std::atomic<std::int64_t> cancelled_;
+    };
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -12,6 +12,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/idle_parker.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +26,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -202,6 +205,38 @@ namespace hpx { namespace threads { namespace policies {
         // Queries whether a given core is idle
         virtual bool is_core_idle(std::size_t num_thread) const = 0;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Arm a timer on the timer wheel of the given worker thread. Once the
+        // timer expires, the (suspended) thread is set to the given state and
+        // is rescheduled directly from the scheduling loop.
+        threads::detail::timer_handle add_timer(std::size_t num_thread,
+            std::chrono::steady_clock::time_point const& abs_time,
+            thread_id_ref_type thrd,
+            thread_schedule_state newstate = thread_schedule_state::pending,
+            thread_restart_state newstate_ex = thread_restart_state::timeout);
+
+        // Cancel the given timer. Returns false if the timer has already
+        // fired. Once this function returns the timer will not resume its
+        // thread anymore.
+        static bool cancel_timer(threads::detail::timer_handle const& timer);
+
+        // Fire all expired timers of the given worker thread, if idle is true
+        // the timers of the other worker threads are processed as well.
+        // Returns the number of threads which have been resumed.
+        std::size_t poll_timers(std::size_t num_thread, bool idle);
+
+        // timer statistics, std::size_t(-1) accumulates all worker threads
+        std::int64_t get_armed_timers_count(std::size_t num_thread, bool reset);
+        std::int64_t get_fired_timers_count(std::size_t num_thread, bool reset);
+        std::int64_t get_cancelled_timers_count(
+            std::size_t num_thread, bool reset);
+
+        // idle parking statistics, std::size_t(-1) accumulates all worker
+        // threads
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_parked_time(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_wakeup_count(std::size_t num_thread, bool reset);
+
         // count active background threads
         std::int64_t get_background_thread_count();
         void increment_background_thread_count();
@@ -401,6 +436,22 @@ namespace hpx { namespace threads { namespace policies {
 
         std::atomic<std::int64_t> background_thread_count_;
 
+        // one timer wheel per worker thread
+        std::size_t num_timer_wheels_;
+        std::unique_ptr<
+            util::cache_aligned_data<threads::detail::timer_wheel>[]>
+            timer_wheels_;
+
+        // support for parking idle worker threads (one per worker thread)
+        void park(std::size_t num_thread);
+        bool wake_parked(std::size_t num_thread);
+        void wake_all_parked();
+
+        std::unique_ptr<
+            util::cache_aligned_data<threads::detail::idle_parker>[]>
+            idle_parkers_;
+        util::cache_line_data<std::atomic<std::size_t>> num_parked_;
+
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
         std::atomic<polling_work_count_function_ptr>
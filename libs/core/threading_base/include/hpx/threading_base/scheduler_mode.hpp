@@ -58,6 +58,10 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option lets idle worker threads block until new work has been
+        /// scheduled instead of spinning or backing off (takes precedence over
+        /// enable_idle_backoff)
+        enable_idle_parking = 0x1000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -83,7 +87,8 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            enable_idle_parking
         // clang-format on
     };
 }}}    // namespace hpx::threads::policies
@@ -9,11 +9,11 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/thread_data_allocator.hpp>
 #include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -53,7 +53,7 @@ namespace hpx { namespace threads {
             return this;
         }
 
-        static util::internal_allocator<thread_data_stackful> thread_alloc_;
+        static detail::thread_data_allocator thread_alloc_;
 
     public:
         HPX_FORCEINLINE coroutine_type::result_type call(
@@ -158,7 +158,7 @@ namespace hpx { namespace threads {
         void destroy() override
         {
             this->~thread_data_stackful();
-            thread_alloc_.deallocate(this, 1);
+            thread_alloc_.deallocate(this);
         }
 
     private:
@@ -170,9 +170,8 @@ namespace hpx { namespace threads {
     inline thread_data* thread_data_stackful::create(thread_init_data& data,
         void* queue, std::ptrdiff_t stacksize, thread_id_addref addref)
     {
-        thread_data* p = thread_alloc_.allocate(1);
-        new (p) thread_data_stackful(data, queue, stacksize, addref);
-        return p;
+        return new (thread_alloc_.allocate())
+            thread_data_stackful(data, queue, stacksize, addref);
     }
 }}    // namespace hpx::threads
 
@@ -9,12 +9,12 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/stackless_coroutine.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/thread_data_allocator.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -52,7 +52,7 @@ namespace hpx { namespace threads {
             return this;
         }
 
-        static util::internal_allocator<thread_data_stackless> thread_alloc_;
+        static detail::thread_data_allocator thread_alloc_;
 
     public:
         stackless_coroutine_type::result_type call()
@@ -149,7 +149,7 @@ namespace hpx { namespace threads {
         void destroy() override
         {
             this->~thread_data_stackless();
-            thread_alloc_.deallocate(this, 1);
+            thread_alloc_.deallocate(this);
         }
 
     private:
@@ -160,9 +160,8 @@ namespace hpx { namespace threads {
     inline thread_data* thread_data_stackless::create(thread_init_data& data,
         void* queue, std::ptrdiff_t stacksize, thread_id_addref addref)
     {
-        thread_data* p = thread_alloc_.allocate(1);
-        new (p) thread_data_stackless(data, queue, stacksize, addref);
-        return p;
+        return new (thread_alloc_.allocate())
+            thread_data_stackless(data, queue, stacksize, addref);
     }
 }}    // namespace hpx::threads
 
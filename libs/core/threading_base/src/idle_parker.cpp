@@ -0,0 +1,155 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/detail/idle_parker.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#if defined(__linux__)
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx { namespace threads { namespace detail {
+
+#if defined(__linux__)
+    namespace {
+
+        static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                sizeof(std::uint32_t),
+            "the futex word must have the size of std::uint32_t");
+
+        std::uint32_t* futex_word(std::atomic<std::uint32_t>& word) noexcept
+        {
+            return reinterpret_cast<std::uint32_t*>(&word);
+        }
+
+        void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t key,
+            std::chrono::nanoseconds timeout) noexcept
+        {
+            auto const secs =
+                std::chrono::duration_cast<std::chrono::seconds>(timeout);
+
+            timespec ts;
+            ts.tv_sec = static_cast<std::time_t>(secs.count());
+            ts.tv_nsec = static_cast<long>((timeout - secs).count());
+
+            // returns immediately if the word is not equal to the key anymore,
+            // spurious wake-ups are handled by the caller
+            syscall(SYS_futex, futex_word(word), FUTEX_WAIT_PRIVATE, key, &ts,
+                nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& word) noexcept
+        {
+            syscall(SYS_futex, futex_word(word), FUTEX_WAKE_PRIVATE, 1,
+                nullptr, nullptr, 0);
+        }
+    }    // namespace
+#endif
+
+    idle_parker::idle_parker()
+      : epoch_(0)
+      , parked_(false)
+      , park_count_(0)
+      , parked_time_(0)
+      , wakeup_count_(0)
+    {
+    }
+
+    std::uint32_t idle_parker::prepare_park() noexcept
+    {
+        // the flag has to be visible to notify() before the caller checks
+        // for new work
+        parked_.store(true, std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_seq_cst);
+    }
+
+    void idle_parker::cancel_park() noexcept
+    {
+        parked_.store(false, std::memory_order_relaxed);
+    }
+
+    bool idle_parker::park(
+        std::uint32_t key, std::chrono::nanoseconds timeout)
+    {
+        auto const start = std::chrono::steady_clock::now();
+
+#if defined(__linux__)
+        futex_wait(epoch_, key, timeout);
+#else
+        {
+            std::unique_lock<std::mutex> l(mtx_);
+            cond_.wait_for(l, timeout, [&]() {
+                return epoch_.load(std::memory_order_relaxed) != key;
+            });
+        }
+#endif
+
+        bool const notified = epoch_.load(std::memory_order_acquire) != key;
+        parked_.store(false, std::memory_order_relaxed);
+
+        auto const parked_for = std::chrono::steady_clock::now() - start;
+        park_count_.fetch_add(1, std::memory_order_relaxed);
+        parked_time_.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(parked_for)
+                .count(),
+            std::memory_order_relaxed);
+        if (notified)
+            wakeup_count_.fetch_add(1, std::memory_order_relaxed);
+
+        return notified;
+    }
+
+    bool idle_parker::notify() noexcept
+    {
+        // avoid writing to the cache line of a worker which is not parked
+        if (!parked_.load(std::memory_order_seq_cst) ||
+            !parked_.exchange(false, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+#if defined(__linux__)
+        epoch_.fetch_add(1, std::memory_order_release);
+        futex_wake(epoch_);
+#else
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            epoch_.fetch_add(1, std::memory_order_release);
+        }
+        cond_.notify_one();
+#endif
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t idle_parker::get_park_count(bool reset)
+    {
+        return reset ? park_count_.exchange(0, std::memory_order_relaxed) :
+                       park_count_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t idle_parker::get_parked_time(bool reset)
+    {
+        return reset ? parked_time_.exchange(0, std::memory_order_relaxed) :
+                       parked_time_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t idle_parker::get_wakeup_count(bool reset)
+    {
+        return reset ? wakeup_count_.exchange(0, std::memory_order_relaxed) :
+                       wakeup_count_.load(std::memory_order_relaxed);
+    }
+}}}    // namespace hpx::threads::detail
@@ -7,6 +7,8 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/idle_parker.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -46,11 +48,18 @@ namespace hpx { namespace threads { namespace policies {
       , thread_queue_init_(thread_queue_init)
       , parent_pool_(nullptr)
       , background_thread_count_(0)
+      , num_timer_wheels_(num_threads == 0 ? 1 : num_threads)
+      , timer_wheels_(new util::cache_aligned_data<
+            threads::detail::timer_wheel>[num_timer_wheels_])
+      , idle_parkers_(new util::cache_aligned_data<
+            threads::detail::idle_parker>[num_timer_wheels_])
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
       , polling_work_count_function_mpi_(&null_polling_work_count_function)
       , polling_work_count_function_cuda_(&null_polling_work_count_function)
     {
+        num_parked_.data_.store(0, std::memory_order_relaxed);
+
         set_scheduler_mode(mode);
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
@@ -70,6 +79,13 @@ namespace hpx { namespace threads { namespace policies {
 
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_idle_parking)
+        {
+            park(num_thread);
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
@@ -103,17 +119,138 @@ namespace hpx { namespace threads { namespace policies {
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_idle_parking)
+        {
+            wake_parked(num_thread);
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
         {
             cond_.notify_all();
         }
+#else
+        (void) num_thread;
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::park(std::size_t num_thread)
+    {
+        if (num_thread >= num_timer_wheels_ ||
+            get_polling_work_count() != 0)
+        {
+            return;
+        }
+
+        threads::detail::idle_parker& parker = idle_parkers_[num_thread].data_;
+
+        // announce that this thread is about to park before checking for
+        // work one last time, anybody adding work afterwards will wake it up
+        std::uint32_t const key = parker.prepare_park();
+        num_parked_.data_.fetch_add(1, std::memory_order_seq_cst);
+
+        bool has_work =
+            states_[num_thread].load(std::memory_order_seq_cst) !=
+                state_running ||
+            get_queue_length(num_thread) != 0 ||
+            (has_scheduler_mode(policies::enable_stealing) &&
+                get_queue_length() != 0);
+
+        // wake up in time for the next timer of any worker thread (idle
+        // threads help expiring the timers of busy ones), never park longer
+        // than the maximal idle back-off time
+        auto const now = std::chrono::steady_clock::now();
+        auto timeout =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::duration<double, std::milli>(
+                    thread_queue_init_.max_idle_backoff_time_));
+
+        auto const next_expiry =
+            timer_wheels_[num_thread].data_.next_expiry();
+        if (next_expiry <= now)
+        {
+            has_work = true;
+        }
+        else if (next_expiry - now < timeout)
+        {
+            timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                next_expiry - now);
+        }
+
+        // the timers of the other threads are bounded without locking their
+        // wheels, due timers were already handled by poll_timers before
+        // this thread became idle
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+        {
+            if (i == num_thread)
+                continue;
+
+            auto const expiry = timer_wheels_[i].data_.next_expiry_hint();
+            if (expiry > now && expiry - now < timeout)
+            {
+                timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    expiry - now);
+            }
+        }
+
+        if (has_work || timeout.count() <= 0)
+            parker.cancel_park();
+        else
+            parker.park(key, timeout);
+
+        num_parked_.data_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool scheduler_base::wake_parked(std::size_t num_thread)
+    {
+        // pairs with the announcement in park(), any work added before this
+        // call is visible to a thread which has not announced parking yet
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.data_.load(std::memory_order_relaxed) == 0)
+            return false;
+
+        if (num_thread < num_timer_wheels_)
+        {
+            if (idle_parkers_[num_thread].data_.notify())
+                return true;
+
+            // the work is taken by the targeted thread, unless it can be
+            // stolen by another (parked) thread
+            if (!has_scheduler_mode(policies::enable_stealing))
+                return false;
+        }
+        else
+        {
+            num_thread = 0;
+        }
+
+        for (std::size_t i = 1; i <= num_timer_wheels_; ++i)
+        {
+            if (idle_parkers_[(num_thread + i) % num_timer_wheels_]
+                    .data_.notify())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void scheduler_base::wake_all_parked()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.data_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            idle_parkers_[i].data_.notify();
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -260,6 +397,7 @@ namespace hpx { namespace threads { namespace policies {
         {
             state.store(s);
         }
+        wake_all_parked();
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -272,6 +410,7 @@ namespace hpx { namespace threads { namespace policies {
                 state.store(s);
             }
         }
+        wake_all_parked();
     }
 
     // return whether all states are at least at the given one
@@ -319,6 +458,9 @@ namespace hpx { namespace threads { namespace policies {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
         do_some_work(std::size_t(-1));
+
+        // parked threads have to re-evaluate the new mode
+        wake_all_parked();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
@@ -354,6 +496,224 @@ namespace hpx { namespace threads { namespace policies {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    threads::detail::timer_handle scheduler_base::add_timer(
+        std::size_t num_thread,
+        std::chrono::steady_clock::time_point const& abs_time,
+        thread_id_ref_type thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex)
+    {
+        if (num_thread >= num_timer_wheels_)
+            num_thread = 0;
+
+        threads::detail::timer_handle timer(new threads::detail::timer_entry(
+            abs_time, HPX_MOVE(thrd), newstate, newstate_ex));
+        timer_wheels_[num_thread].data_.add(timer.get());
+
+        // a parked worker thread has to account for the new timer
+        if (idle_parkers_[num_thread].data_.is_parked())
+            wake_parked(num_thread);
+        return timer;
+    }
+
+    bool scheduler_base::cancel_timer(
+        threads::detail::timer_handle const& timer)
+    {
+        using state = threads::detail::timer_entry::state;
+
+        if (!timer)
+            return false;
+
+        // a timer which expires from now on will not resume the thread
+        // anymore if it is still running
+        timer->cancel_requested_.store(true, std::memory_order_seq_cst);
+
+        while (!timer->get_wheel()->cancel(timer.get()))
+        {
+            if (timer->state_.load(std::memory_order_acquire) == state::fired)
+                return false;
+
+            // the timer is being fired concurrently, wait for this to finish
+            // (it may have been re-added to the wheel in the meantime)
+            hpx::util::yield_while(
+                [&]() {
+                    return timer->state_.load(std::memory_order_acquire) ==
+                        state::firing;
+                },
+                "scheduler_base::cancel_timer", false);
+        }
+        return true;
+    }
+
+    std::size_t scheduler_base::poll_timers(std::size_t num_thread, bool idle)
+    {
+        using state = threads::detail::timer_entry::state;
+
+        if (num_thread >= num_timer_wheels_)
+            return 0;
+
+        std::vector<threads::detail::timer_handle> expired;
+        auto now = std::chrono::steady_clock::time_point::min();
+
+        auto expire = [&](threads::detail::timer_wheel& wheel, bool try_lock) {
+            if (wheel.empty())
+                return;
+            if (now == std::chrono::steady_clock::time_point::min())
+                now = std::chrono::steady_clock::now();
+
+            // avoid locking the wheel if none of its timers is due yet
+            if (wheel.may_expire(now))
+                wheel.expire(now, expired, try_lock);
+        };
+
+        expire(timer_wheels_[num_thread].data_, false);
+
+        // help with the timers of the other worker threads while idling
+        if (idle)
+        {
+            for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            {
+                if (i != num_thread)
+                    expire(timer_wheels_[i].data_, true);
+            }
+        }
+
+        std::size_t resumed = 0;
+        for (threads::detail::timer_handle& timer : expired)
+        {
+            thread_id_ref_type const& thrd = timer->thrd_;
+            if (!thrd)
+            {
+                timer->state_.store(state::fired, std::memory_order_release);
+                continue;
+            }
+
+            auto* thrd_data = get_thread_id_data(thrd);
+            thread_state previous_state = thrd_data->get_state();
+            thread_schedule_state const previous_state_val =
+                previous_state.state();
+
+            if (previous_state_val == thread_schedule_state::suspended &&
+                thrd_data->restore_state(
+                    timer->newstate_, timer->newstate_ex_, previous_state))
+            {
+                if (timer->newstate_ == thread_schedule_state::pending ||
+                    timer->newstate_ == thread_schedule_state::pending_boost)
+                {
+                    auto* scheduler = thrd_data->get_scheduler_base();
+                    scheduler->schedule_thread(thrd,
+                        thread_schedule_hint(
+                            static_cast<std::int16_t>(num_thread)),
+                        false, thrd_data->get_priority());
+                    scheduler->do_some_work(num_thread);
+                }
+                ++resumed;
+            }
+            else if (previous_state_val == thread_schedule_state::active &&
+                !timer->cancel_requested_.load(std::memory_order_seq_cst))
+            {
+                // the thread has not suspended yet, try again later
+                timer->get_wheel()->retry(timer.get());
+                continue;
+            }
+
+            // the thread has been resumed by somebody else otherwise
+            timer->state_.store(state::fired, std::memory_order_release);
+        }
+        return resumed;
+    }
+
+    std::int64_t scheduler_base::get_armed_timers_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < num_timer_wheels_);
+            return timer_wheels_[num_thread].data_.get_armed_count(reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            result += timer_wheels_[i].data_.get_armed_count(reset);
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_fired_timers_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < num_timer_wheels_);
+            return timer_wheels_[num_thread].data_.get_fired_count(reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            result += timer_wheels_[i].data_.get_fired_count(reset);
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_cancelled_timers_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < num_timer_wheels_);
+            return timer_wheels_[num_thread].data_.get_cancelled_count(reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            result += timer_wheels_[i].data_.get_cancelled_count(reset);
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t scheduler_base::get_idle_park_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < num_timer_wheels_);
+            return idle_parkers_[num_thread].data_.get_park_count(reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            result += idle_parkers_[i].data_.get_park_count(reset);
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_idle_parked_time(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < num_timer_wheels_);
+            return idle_parkers_[num_thread].data_.get_parked_time(reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            result += idle_parkers_[i].data_.get_parked_time(reset);
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_idle_wakeup_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < num_timer_wheels_);
+            return idle_parkers_[num_thread].data_.get_wakeup_count(reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_timer_wheels_; ++i)
+            result += idle_parkers_[i].data_.get_wakeup_count(reset);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::int64_t scheduler_base::get_background_thread_count()
     {
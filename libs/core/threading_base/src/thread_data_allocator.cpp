@@ -0,0 +1,519 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/threading_base/detail/thread_data_allocator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    namespace {
+
+        // the maximal number of thread_data_allocator instances
+        constexpr std::size_t max_allocators = 8;
+
+        struct block_header
+        {
+            thread_data_allocator::slab_cache* owner_;
+            block_header* next_;
+        };
+
+        constexpr std::size_t round_up(std::size_t size) noexcept
+        {
+            constexpr std::size_t alignment = alignof(std::max_align_t);
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr std::size_t header_size = round_up(sizeof(block_header));
+
+        // a slab cache is trimmed once it holds at least this many slabs
+        // worth of free blocks
+        constexpr std::int64_t min_trim_slabs = 4;
+
+        void increment(std::atomic<std::int64_t>& counter) noexcept
+        {
+            // counters are modified by the owning thread only
+            counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+        }
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& counter, bool reset) noexcept
+        {
+            return reset ? counter.exchange(0, std::memory_order_relaxed) :
+                           counter.load(std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The slots of destroyed allocators are not reused as other threads
+        // may still refer to them through their thread local slab caches.
+        struct allocator_registry
+        {
+            std::mutex mtx_;
+            std::size_t count_ = 0;
+            thread_data_allocator* allocators_[max_allocators] = {};
+        };
+
+        allocator_registry& get_registry()
+        {
+            static allocator_registry registry;
+            return registry;
+        }
+
+        std::size_t register_allocator(thread_data_allocator* alloc)
+        {
+            allocator_registry& r = get_registry();
+            std::lock_guard<std::mutex> l(r.mtx_);
+            if (r.count_ == max_allocators)
+            {
+                HPX_ASSERT_MSG(
+                    false, "too many thread_data_allocator instances");
+                std::terminate();
+            }
+
+            r.allocators_[r.count_] = alloc;
+            return r.count_++;
+        }
+
+        void unregister_allocator(std::size_t id) noexcept
+        {
+            allocator_registry& r = get_registry();
+            std::lock_guard<std::mutex> l(r.mtx_);
+            r.allocators_[id] = nullptr;
+        }
+
+        template <typename F>
+        std::int64_t accumulate_all(F&& f)
+        {
+            allocator_registry& r = get_registry();
+            std::lock_guard<std::mutex> l(r.mtx_);
+
+            std::int64_t result = 0;
+            for (thread_data_allocator* alloc : r.allocators_)
+            {
+                if (alloc != nullptr)
+                {
+                    result += f(*alloc);
+                }
+            }
+            return result;
+        }
+
+        // Fast access to the slab caches of the current OS-thread, this is
+        // trivially destructible to avoid the overhead of checking whether
+        // the variable has been constructed already.
+        thread_local thread_data_allocator::slab_cache*
+            local_slab_caches[max_allocators] = {};
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct thread_data_allocator::slab_cache
+    {
+        // only accessed by the owning thread
+        block_header* free_ = nullptr;
+        std::vector<char*> slabs_;
+        std::atomic<std::int64_t> hits_{0};
+        std::atomic<std::int64_t> misses_{0};
+        std::atomic<std::int64_t> num_slabs_{0};
+
+        // (approximate) number of free blocks, the cache is trimmed once
+        // this reaches the threshold
+        std::int64_t free_count_ = 0;
+        std::int64_t trim_threshold_ = 0;
+
+        // blocks freed by other threads, 'pending_' counts the blocks not
+        // reclaimed yet while 'count_' is the statistics counter
+        struct remote_data
+        {
+            std::atomic<block_header*> head_{nullptr};
+            std::atomic<std::int64_t> pending_{0};
+            std::atomic<std::int64_t> count_{0};
+        };
+        util::cache_aligned_data<remote_data> remote_;
+    };
+
+    // Hands the slab caches of an exiting OS-thread over to their allocators.
+    struct thread_slab_caches
+    {
+        bool has_caches_ = false;
+
+        ~thread_slab_caches()
+        {
+            if (!has_caches_)
+            {
+                return;
+            }
+
+            allocator_registry& r = get_registry();
+            std::lock_guard<std::mutex> l(r.mtx_);
+            for (std::size_t i = 0; i != max_allocators; ++i)
+            {
+                // skip allocators which have been destroyed already
+                thread_data_allocator* alloc = r.allocators_[i];
+                if (alloc != nullptr && local_slab_caches[i] != nullptr)
+                {
+                    alloc->trim(*local_slab_caches[i]);
+                    alloc->release_slab_cache(local_slab_caches[i]);
+                }
+                local_slab_caches[i] = nullptr;
+            }
+        }
+    };
+
+    namespace {
+
+        thread_local thread_slab_caches slab_cache_owner;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    thread_data_allocator::thread_data_allocator(
+        std::size_t block_size, std::size_t blocks_per_slab)
+      : id_(register_allocator(this))
+      , stride_(header_size + round_up(block_size))
+      , blocks_per_slab_((std::max)(blocks_per_slab, std::size_t(1)))
+    {
+    }
+
+    thread_data_allocator::~thread_data_allocator()
+    {
+        unregister_allocator(id_);
+
+        util::internal_allocator<char> alloc;
+        for (slab_cache* cache : caches_)
+        {
+            for (char* slab : cache->slabs_)
+            {
+                alloc.deallocate(slab, stride_ * blocks_per_slab_);
+            }
+            delete cache;
+        }
+    }
+
+    void* thread_data_allocator::allocate()
+    {
+        slab_cache& cache = get_slab_cache();
+
+        block_header* b = cache.free_;
+        if (b == nullptr)
+        {
+            // reclaim all blocks freed by other threads at once
+            cache.free_count_ += cache.remote_.data_.pending_.exchange(
+                0, std::memory_order_relaxed);
+            b = cache.remote_.data_.head_.exchange(
+                nullptr, std::memory_order_acquire);
+            if (b == nullptr)
+            {
+                increment(cache.misses_);
+                refill(cache);
+                b = cache.free_;
+            }
+            else
+            {
+                increment(cache.hits_);
+            }
+        }
+        else
+        {
+            increment(cache.hits_);
+        }
+
+        HPX_ASSERT(b != nullptr && b->owner_ == &cache);
+        cache.free_ = b->next_;
+        --cache.free_count_;
+
+        return reinterpret_cast<char*>(b) + header_size;
+    }
+
+    void thread_data_allocator::deallocate(void* p) noexcept
+    {
+        block_header* b = reinterpret_cast<block_header*>(
+            static_cast<char*>(p) - header_size);
+        slab_cache* owner = b->owner_;
+
+        if (owner == local_slab_caches[id_])
+        {
+            b->next_ = owner->free_;
+            owner->free_ = b;
+
+            if (++owner->free_count_ >= owner->trim_threshold_)
+            {
+                trim(*owner);
+            }
+            return;
+        }
+
+        // push the block onto the list of remotely freed blocks of its owner
+        slab_cache::remote_data& remote = owner->remote_.data_;
+        block_header* head = remote.head_.load(std::memory_order_relaxed);
+        do
+        {
+            b->next_ = head;
+        } while (!remote.head_.compare_exchange_weak(head, b,
+            std::memory_order_release, std::memory_order_relaxed));
+
+        remote.pending_.fetch_add(1, std::memory_order_relaxed);
+        remote.count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void thread_data_allocator::trim() noexcept
+    {
+        slab_cache* cache = local_slab_caches[id_];
+        if (cache != nullptr)
+        {
+            trim(*cache);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    thread_data_allocator::slab_cache& thread_data_allocator::get_slab_cache()
+    {
+        slab_cache* cache = local_slab_caches[id_];
+        if (HPX_UNLIKELY(cache == nullptr))
+        {
+            cache = create_slab_cache();
+        }
+        return *cache;
+    }
+
+    thread_data_allocator::slab_cache*
+    thread_data_allocator::create_slab_cache()
+    {
+        slab_cache* cache = nullptr;
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (!orphaned_.empty())
+            {
+                // adopt the cache of an OS-thread which has exited
+                cache = orphaned_.back();
+                orphaned_.pop_back();
+            }
+            else
+            {
+                cache = new slab_cache;
+                cache->trim_threshold_ = min_trim_slabs *
+                    static_cast<std::int64_t>(blocks_per_slab_);
+                caches_.push_back(cache);
+            }
+        }
+
+        local_slab_caches[id_] = cache;
+        slab_cache_owner.has_caches_ = true;
+
+        return cache;
+    }
+
+    void thread_data_allocator::release_slab_cache(slab_cache* cache) noexcept
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        orphaned_.push_back(cache);
+    }
+
+    void thread_data_allocator::refill(slab_cache& cache)
+    {
+        char* slab = util::internal_allocator<char>().allocate(
+            stride_ * blocks_per_slab_);
+        try
+        {
+            cache.slabs_.push_back(slab);
+        }
+        catch (...)
+        {
+            util::internal_allocator<char>().deallocate(
+                slab, stride_ * blocks_per_slab_);
+            throw;
+        }
+        increment(cache.num_slabs_);
+        cache.free_count_ += static_cast<std::int64_t>(blocks_per_slab_);
+
+        for (std::size_t i = blocks_per_slab_; i != 0; --i)
+        {
+            cache.free_ = new (slab + (i - 1) * stride_)
+                block_header{&cache, cache.free_};
+        }
+    }
+
+    // Releases the slabs all blocks of which are free, except for one. This
+    // walks the list of free blocks, the next trim is therefore delayed until
+    // the number of free blocks has doubled, which keeps the overhead
+    // constant per deallocation even if the slabs are fragmented.
+    void thread_data_allocator::trim(slab_cache& cache) noexcept
+    {
+        std::int64_t const min_threshold =
+            min_trim_slabs * static_cast<std::int64_t>(blocks_per_slab_);
+
+        // collect the blocks freed by other threads as well
+        cache.remote_.data_.pending_.store(0, std::memory_order_relaxed);
+        block_header* remote = cache.remote_.data_.head_.exchange(
+            nullptr, std::memory_order_acquire);
+        if (remote != nullptr)
+        {
+            block_header* last = remote;
+            while (last->next_ != nullptr)
+            {
+                last = last->next_;
+            }
+            last->next_ = cache.free_;
+            cache.free_ = remote;
+        }
+
+        std::vector<char*>& slabs = cache.slabs_;
+        std::size_t const slab_size = stride_ * blocks_per_slab_;
+
+        try
+        {
+            std::sort(slabs.begin(), slabs.end(), std::less<char*>());
+            auto find_slab = [&](block_header* b) -> std::size_t {
+                auto it = std::upper_bound(slabs.begin(), slabs.end(),
+                    reinterpret_cast<char*>(b), std::less<char*>());
+                HPX_ASSERT(it != slabs.begin());
+                return static_cast<std::size_t>(it - slabs.begin()) - 1;
+            };
+
+            // count the free blocks of each slab
+            std::vector<std::size_t> free_blocks(slabs.size(), 0);
+            std::int64_t count = 0;
+            for (block_header* b = cache.free_; b != nullptr; b = b->next_)
+            {
+                ++free_blocks[find_slab(b)];
+                ++count;
+            }
+
+            // keep the first completely free slab
+            bool keep = true;
+            std::size_t released = 0;
+            for (std::size_t& blocks : free_blocks)
+            {
+                if (blocks == blocks_per_slab_ && !std::exchange(keep, false))
+                {
+                    blocks = std::size_t(-1);
+                    ++released;
+                }
+            }
+
+            if (released != 0)
+            {
+                // unlink the blocks of the released slabs
+                block_header** next = &cache.free_;
+                while (*next != nullptr)
+                {
+                    if (free_blocks[find_slab(*next)] == std::size_t(-1))
+                    {
+                        *next = (*next)->next_;
+                    }
+                    else
+                    {
+                        next = &(*next)->next_;
+                    }
+                }
+
+                std::size_t j = 0;
+                for (std::size_t i = 0; i != slabs.size(); ++i)
+                {
+                    if (free_blocks[i] == std::size_t(-1))
+                    {
+                        util::internal_allocator<char>().deallocate(
+                            slabs[i], slab_size);
+                    }
+                    else
+                    {
+                        slabs[j++] = slabs[i];
+                    }
+                }
+                slabs.resize(j);
+
+                count -= static_cast<std::int64_t>(released * blocks_per_slab_);
+                cache.num_slabs_.store(static_cast<std::int64_t>(slabs.size()),
+                    std::memory_order_relaxed);
+            }
+
+            cache.free_count_ = count;
+            cache.trim_threshold_ = (std::max)(min_threshold, 2 * count);
+        }
+        catch (...)
+        {
+            // the bookkeeping could not be allocated, try again later
+            cache.trim_threshold_ =
+                (std::max)(min_threshold, 2 * cache.free_count_);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename F>
+    std::int64_t thread_data_allocator::accumulate(F&& f)
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+
+        std::int64_t result = 0;
+        for (slab_cache* cache : caches_)
+        {
+            result += f(*cache);
+        }
+        return result;
+    }
+
+    std::int64_t thread_data_allocator::get_hits(bool reset)
+    {
+        return accumulate([reset](slab_cache& cache) {
+            return get_and_reset(cache.hits_, reset);
+        });
+    }
+
+    std::int64_t thread_data_allocator::get_misses(bool reset)
+    {
+        return accumulate([reset](slab_cache& cache) {
+            return get_and_reset(cache.misses_, reset);
+        });
+    }
+
+    std::int64_t thread_data_allocator::get_remote_frees(bool reset)
+    {
+        return accumulate([reset](slab_cache& cache) {
+            return get_and_reset(cache.remote_.data_.count_, reset);
+        });
+    }
+
+    std::int64_t thread_data_allocator::get_slabs()
+    {
+        return accumulate([](slab_cache& cache) {
+            return cache.num_slabs_.load(std::memory_order_relaxed);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_thread_data_allocator_hits(bool reset)
+    {
+        return accumulate_all([reset](thread_data_allocator& alloc) {
+            return alloc.get_hits(reset);
+        });
+    }
+
+    std::int64_t get_thread_data_allocator_misses(bool reset)
+    {
+        return accumulate_all([reset](thread_data_allocator& alloc) {
+            return alloc.get_misses(reset);
+        });
+    }
+
+    std::int64_t get_thread_data_allocator_remote_frees(bool reset)
+    {
+        return accumulate_all([reset](thread_data_allocator& alloc) {
+            return alloc.get_remote_frees(reset);
+        });
+    }
+}}}    // namespace hpx::threads::detail
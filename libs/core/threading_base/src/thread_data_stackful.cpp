@@ -5,15 +5,15 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/detail/thread_data_allocator.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads {
 
-    util::internal_allocator<thread_data_stackful>
-        thread_data_stackful::thread_alloc_;
+    detail::thread_data_allocator thread_data_stackful::thread_alloc_(
+        sizeof(thread_data_stackful));
 
     thread_data_stackful::~thread_data_stackful()
     {
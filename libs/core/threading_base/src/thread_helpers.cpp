@@ -15,11 +15,13 @@
 #endif
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/threading_base/detail/reset_lco_description.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -536,14 +538,13 @@ namespace hpx { namespace this_thread {
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             threads::detail::reset_backtrace bt(id, ec);
 #endif
-            std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::timeout,
-                    threads::thread_priority::boost, true, ec);
-            if (ec)
-                return threads::thread_restart_state::unknown;
+            // arm a timer on the timer wheel of the current worker thread,
+            // the scheduling loop resumes us directly once it expires
+            auto* scheduler = get_thread_id_data(id)->get_scheduler_base();
+            threads::detail::timer_handle timer = scheduler->add_timer(
+                hpx::get_local_worker_thread_num(), abs_time.value(), id,
+                threads::thread_schedule_state::pending,
+                threads::thread_restart_state::timeout);
 
             // We might need to dispatch 'nextid' to it's correct scheduler
             // only if our current scheduler is the same, we should yield the id
@@ -566,19 +567,8 @@ namespace hpx { namespace this_thread {
                     HPX_MOVE(nextid)));
             }
 
-            if (statex != threads::thread_restart_state::timeout)
-            {
-                HPX_ASSERT(statex == threads::thread_restart_state::abort ||
-                    statex == threads::thread_restart_state::signaled);
-                error_code ec1(lightweight);    // do not throw
-                hpx::util::yield_while(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
-            }
+            // make sure the timer will not resume us later on
+            scheduler->cancel_timer(timer);
         }
 
         // handle interruption, if needed
@@ -0,0 +1,465 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_entry::timer_entry(
+        std::chrono::steady_clock::time_point const& abs_time,
+        thread_id_ref_type thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex) noexcept
+      : abs_time_(abs_time)
+      , thrd_(HPX_MOVE(thrd))
+      , newstate_(newstate)
+      , newstate_ex_(newstate_ex)
+      , state_(state::armed)
+      , cancel_requested_(false)
+      , count_(0)
+      , wheel_(nullptr)
+      , expiry_(0)
+      , head_(nullptr)
+      , prev_(nullptr)
+      , next_(nullptr)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::uint64_t get_nanoseconds(
+            std::chrono::steady_clock::time_point const& t) noexcept
+        {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                t.time_since_epoch())
+                          .count();
+            return ns < 0 ? 0 : static_cast<std::uint64_t>(ns);
+        }
+
+        // the tick at (or after) which a timer for the given time expires
+        std::uint64_t get_expiry_tick(
+            std::chrono::steady_clock::time_point const& t) noexcept
+        {
+            constexpr std::uint64_t mask =
+                (std::uint64_t(1) << timer_wheel::tick_bits) - 1;
+
+            std::uint64_t const ns = get_nanoseconds(t);
+            return (ns >> timer_wheel::tick_bits) + ((ns & mask) != 0 ? 1 : 0);
+        }
+
+        // the last tick which has completely passed at the given time
+        std::uint64_t get_current_tick(
+            std::chrono::steady_clock::time_point const& t) noexcept
+        {
+            return get_nanoseconds(t) >> timer_wheel::tick_bits;
+        }
+
+        std::chrono::steady_clock::time_point get_time_point(
+            std::uint64_t tick) noexcept
+        {
+            if (tick == (std::numeric_limits<std::uint64_t>::max)())
+                return (std::chrono::steady_clock::time_point::max)();
+
+            return std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<
+                    std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(tick << timer_wheel::tick_bits)));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel()
+      : current_(get_current_tick(std::chrono::steady_clock::now()))
+      , count_(0)
+      , next_tick_((std::numeric_limits<std::uint64_t>::max)())
+      , overflow_(nullptr)
+      , due_(nullptr)
+      , armed_(0)
+      , fired_(0)
+      , cancelled_(0)
+    {
+        for (auto& level : slots_)
+        {
+            for (timer_entry*& slot : level)
+                slot = nullptr;
+        }
+        for (std::uint64_t& occupied : occupied_)
+            occupied = 0;
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        // release the references held for the remaining timers
+        auto release_all = [](timer_entry* list) {
+            while (list != nullptr)
+            {
+                timer_entry* next = list->next_;
+                list->head_ = nullptr;
+                list->prev_ = list->next_ = nullptr;
+                intrusive_ptr_release(list);
+                list = next;
+            }
+        };
+
+        for (auto& level : slots_)
+        {
+            for (timer_entry* slot : level)
+                release_all(slot);
+        }
+        release_all(overflow_);
+        release_all(due_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel::link(timer_entry* e) noexcept
+    {
+        // the tick at which the wheel has to look at the new timer, this is
+        // earlier than its expiry if it is linked to a higher level
+        std::uint64_t tick = e->expiry_;
+
+        timer_entry** head = nullptr;
+        if (e->expiry_ <= current_)
+        {
+            head = &due_;
+        }
+        else
+        {
+            // find the level based on the highest bit the expiry differs
+            // from the current tick
+            std::uint64_t const diff = e->expiry_ ^ current_;
+
+            int level = 0;
+            while (level != num_levels &&
+                (diff >> ((level + 1) * slot_bits)) != 0)
+            {
+                ++level;
+            }
+
+            if (level == num_levels)
+            {
+                constexpr int shift = num_levels * slot_bits;
+                tick = (current_ | ((std::uint64_t(1) << shift) - 1)) + 1;
+                head = &overflow_;
+            }
+            else
+            {
+                int const shift = level * slot_bits;
+                std::size_t const slot = static_cast<std::size_t>(
+                    (e->expiry_ >> shift) & (num_slots - 1));
+                tick = e->expiry_ & ~((std::uint64_t(1) << shift) - 1);
+                head = &slots_[level][slot];
+                occupied_[level] |= std::uint64_t(1) << slot;
+            }
+        }
+
+        if (tick < next_tick_.load(std::memory_order_relaxed))
+            next_tick_.store(tick, std::memory_order_relaxed);
+
+        e->head_ = head;
+        e->prev_ = nullptr;
+        e->next_ = *head;
+        if (*head != nullptr)
+            (*head)->prev_ = e;
+        *head = e;
+    }
+
+    void timer_wheel::link_all(timer_entry* list) noexcept
+    {
+        while (list != nullptr)
+        {
+            timer_entry* next = list->next_;
+            link(list);
+            list = next;
+        }
+    }
+
+    void timer_wheel::unlink(timer_entry* e) noexcept
+    {
+        HPX_ASSERT(e->head_ != nullptr);
+
+        timer_entry** head = e->head_;
+        if (e->prev_ != nullptr)
+            e->prev_->next_ = e->next_;
+        else
+            *head = e->next_;
+        if (e->next_ != nullptr)
+            e->next_->prev_ = e->prev_;
+
+        e->head_ = nullptr;
+        e->prev_ = e->next_ = nullptr;
+
+        // mark the slot as empty, if needed
+        std::ptrdiff_t const index = head - &slots_[0][0];
+        if (*head == nullptr && index >= 0 &&
+            index < static_cast<std::ptrdiff_t>(num_levels * num_slots))
+        {
+            occupied_[index / num_slots] &=
+                ~(std::uint64_t(1) << (index % num_slots));
+        }
+    }
+
+    timer_entry* timer_wheel::take_slot(int level, std::size_t slot) noexcept
+    {
+        timer_entry* list = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+        occupied_[level] &= ~(std::uint64_t(1) << slot);
+        return list;
+    }
+
+    void timer_wheel::collect(
+        timer_entry*& list, std::vector<timer_handle>& expired)
+    {
+        while (list != nullptr)
+        {
+            timer_entry* e = list;
+            list = e->next_;
+
+            e->head_ = nullptr;
+            e->prev_ = e->next_ = nullptr;
+            e->state_.store(
+                timer_entry::state::firing, std::memory_order_release);
+
+            // hand the reference held by the wheel over to the caller
+            expired.emplace_back(e, false);
+            count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel::add(timer_entry* e)
+    {
+        HPX_ASSERT(e->wheel_ == nullptr && e->head_ == nullptr);
+
+        e->wheel_ = this;
+        e->expiry_ = get_expiry_tick(e->abs_time_);
+        intrusive_ptr_add_ref(e);
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            e->state_.store(
+                timer_entry::state::armed, std::memory_order_relaxed);
+            link(e);
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        armed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool timer_wheel::cancel(timer_entry* e)
+    {
+        HPX_ASSERT(e->wheel_ == this);
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (e->state_.load(std::memory_order_relaxed) !=
+                timer_entry::state::armed)
+            {
+                return false;
+            }
+
+            unlink(e);
+            e->state_.store(
+                timer_entry::state::cancelled, std::memory_order_release);
+            count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        cancelled_.fetch_add(1, std::memory_order_relaxed);
+
+        // release the reference held by the wheel
+        intrusive_ptr_release(e);
+        return true;
+    }
+
+    void timer_wheel::retry(timer_entry* e)
+    {
+        HPX_ASSERT(e->wheel_ == this && e->head_ == nullptr);
+
+        intrusive_ptr_add_ref(e);
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            e->state_.store(
+                timer_entry::state::armed, std::memory_order_relaxed);
+            link(e);
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // the timer will be counted again once it expires
+        fired_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t timer_wheel::next_event() const noexcept
+    {
+        // Each occupied slot on level n is processed once the current tick
+        // reaches the start of the range covered by this slot (the timers on
+        // level 0 expire at that tick, all others are moved to lower levels).
+        std::uint64_t next = (std::numeric_limits<std::uint64_t>::max)();
+        for (int level = 0; level != num_levels; ++level)
+        {
+            int const shift = level * slot_bits;
+            std::uint64_t const digit = (current_ >> shift) & (num_slots - 1);
+            std::uint64_t const later = digit == num_slots - 1 ?
+                0 :
+                occupied_[level] & (~std::uint64_t(0) << (digit + 1));
+            if (later == 0)
+                continue;
+
+            std::uint64_t slot = 0;
+            while ((later & (std::uint64_t(1) << slot)) == 0)
+                ++slot;
+
+            std::uint64_t const base =
+                current_ & ~((std::uint64_t(1) << (shift + slot_bits)) - 1);
+            std::uint64_t const tick = base + (slot << shift);
+            if (tick < next)
+                next = tick;
+        }
+
+        // the overflow list is processed once all levels have wrapped
+        if (overflow_ != nullptr)
+        {
+            constexpr int shift = num_levels * slot_bits;
+            std::uint64_t const tick =
+                (current_ | ((std::uint64_t(1) << shift) - 1)) + 1;
+            if (tick < next)
+                next = tick;
+        }
+        return next;
+    }
+
+    std::chrono::steady_clock::time_point timer_wheel::next_expiry() const
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (due_ != nullptr)
+            return (std::chrono::steady_clock::time_point::min)();
+
+        // the next event may only move timers to a lower level, which is
+        // still a valid lower bound for the next expiry
+        return get_time_point(next_event());
+    }
+
+    std::chrono::steady_clock::time_point timer_wheel::next_expiry_hint()
+        const noexcept
+    {
+        return get_time_point(next_tick_.load(std::memory_order_relaxed));
+    }
+
+    std::size_t timer_wheel::expire_locked(
+        std::uint64_t now, std::vector<timer_handle>& expired)
+    {
+        std::size_t const size = expired.size();
+
+        while (current_ < now)
+        {
+            // skip all ticks which have no timers associated
+            std::uint64_t const next = next_event();
+            if (next > now)
+            {
+                current_ = now;
+                break;
+            }
+            current_ = next;
+
+            // all timers on the levels whose range starts at the current
+            // tick are moved to the lower levels
+            int level = 1;
+            for (/**/; level != num_levels; ++level)
+            {
+                std::uint64_t const mask =
+                    (std::uint64_t(1) << (level * slot_bits)) - 1;
+                if ((current_ & mask) != 0)
+                    break;
+
+                link_all(take_slot(level,
+                    static_cast<std::size_t>(
+                        (current_ >> (level * slot_bits)) & (num_slots - 1))));
+            }
+
+            if (level == num_levels &&
+                (current_ & ((std::uint64_t(1) << (level * slot_bits)) - 1)) ==
+                    0)
+            {
+                timer_entry* list = overflow_;
+                overflow_ = nullptr;
+                link_all(list);
+            }
+
+            // the timers in the current slot of the lowest level expire now
+            timer_entry* list = take_slot(
+                0, static_cast<std::size_t>(current_ & (num_slots - 1)));
+            collect(list, expired);
+        }
+
+        collect(due_, expired);
+        next_tick_.store(next_event(), std::memory_order_relaxed);
+
+        return expired.size() - size;
+    }
+
+    bool timer_wheel::may_expire(
+        std::chrono::steady_clock::time_point const& now) const noexcept
+    {
+        return next_tick_.load(std::memory_order_relaxed) <=
+            get_current_tick(now);
+    }
+
+    std::size_t timer_wheel::expire(
+        std::chrono::steady_clock::time_point const& now,
+        std::vector<timer_handle>& expired, bool try_lock)
+    {
+        std::uint64_t const current = get_current_tick(now);
+
+        std::unique_lock<mutex_type> l(mtx_, std::defer_lock);
+        if (try_lock)
+        {
+            if (!l.try_lock())
+                return 0;
+        }
+        else
+        {
+            l.lock();
+        }
+
+        std::size_t const result = expire_locked(current, expired);
+        l.unlock();
+
+        fired_.fetch_add(
+            static_cast<std::int64_t>(result), std::memory_order_relaxed);
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t timer_wheel::get_armed_count(bool reset)
+    {
+        return reset ? armed_.exchange(0, std::memory_order_relaxed) :
+                       armed_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t timer_wheel::get_fired_count(bool reset)
+    {
+        return reset ? fired_.exchange(0, std::memory_order_relaxed) :
+                       fired_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t timer_wheel::get_cancelled_count(bool reset)
+    {
+        return reset ? cancelled_.exchange(0, std::memory_order_relaxed) :
+                       cancelled_.load(std::memory_order_relaxed);
+    }
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,102 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/idle_parker.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using hpx::threads::detail::idle_parker;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_timeout()
+{
+    idle_parker parker;
+
+    // notifying a worker which is not parked has no effect
+    HPX_TEST(!parker.is_parked());
+    HPX_TEST(!parker.notify());
+
+    // cancelling does not count as having parked
+    parker.prepare_park();
+    HPX_TEST(parker.is_parked());
+    parker.cancel_park();
+    HPX_TEST(!parker.is_parked());
+    HPX_TEST_EQ(parker.get_park_count(false), std::int64_t(0));
+
+    std::uint32_t const key = parker.prepare_park();
+    HPX_TEST(!parker.park(key, std::chrono::milliseconds(10)));
+    HPX_TEST(!parker.is_parked());
+
+    HPX_TEST_EQ(parker.get_park_count(true), std::int64_t(1));
+    HPX_TEST_EQ(parker.get_park_count(false), std::int64_t(0));
+    HPX_TEST_EQ(parker.get_wakeup_count(false), std::int64_t(0));
+    HPX_TEST(parker.get_parked_time(true) > 0);
+    HPX_TEST_EQ(parker.get_parked_time(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_notify_before_park()
+{
+    idle_parker parker;
+
+    // a notification which arrives between announcing and parking is not
+    // lost, park() returns immediately
+    std::uint32_t const key = parker.prepare_park();
+    HPX_TEST(parker.notify());
+    HPX_TEST(!parker.notify());
+
+    HPX_TEST(parker.park(key, std::chrono::hours(1)));
+    HPX_TEST_EQ(parker.get_wakeup_count(false), std::int64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_notify()
+{
+    constexpr int num_rounds = 1000;
+
+    idle_parker parker;
+    std::atomic<int> woken(0);
+
+    std::thread worker([&]() {
+        for (int i = 0; i != num_rounds; ++i)
+        {
+            // park until notified, re-park after spurious wake-ups
+            for (;;)
+            {
+                std::uint32_t const key = parker.prepare_park();
+                if (parker.park(key, std::chrono::hours(1)))
+                    break;
+            }
+            ++woken;
+        }
+    });
+
+    for (int i = 0; i != num_rounds; ++i)
+    {
+        while (!parker.notify())
+            std::this_thread::yield();
+
+        while (woken.load() != i + 1)
+            std::this_thread::yield();
+    }
+    worker.join();
+
+    HPX_TEST_EQ(parker.get_wakeup_count(false), std::int64_t(num_rounds));
+    HPX_TEST(parker.get_park_count(false) >= std::int64_t(num_rounds));
+}
+
+int main()
+{
+    test_timeout();
+    test_notify_before_park();
+    test_notify();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,187 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/thread_data_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+using hpx::threads::detail::thread_data_allocator;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_local_reuse()
+{
+    thread_data_allocator alloc(128, 16);
+
+    // the first allocation requests a new slab, all others are served from it
+    std::vector<void*> blocks;
+    for (int i = 0; i != 16; ++i)
+    {
+        void* p = alloc.allocate();
+        std::memset(p, 0xff, 128);
+        blocks.push_back(p);
+    }
+    HPX_TEST_EQ(std::set<void*>(blocks.begin(), blocks.end()).size(),
+        std::size_t(16));
+    HPX_TEST_EQ(alloc.get_misses(false), std::int64_t(1));
+    HPX_TEST_EQ(alloc.get_hits(false), std::int64_t(15));
+
+    // freed blocks are handed out again
+    void* p = blocks.back();
+    alloc.deallocate(p);
+    HPX_TEST_EQ(alloc.allocate(), p);
+    HPX_TEST_EQ(alloc.get_misses(false), std::int64_t(1));
+
+    for (void* b : blocks)
+    {
+        alloc.deallocate(b);
+    }
+    HPX_TEST_EQ(alloc.get_remote_frees(false), std::int64_t(0));
+
+    HPX_TEST_EQ(alloc.get_hits(true), std::int64_t(16));
+    HPX_TEST_EQ(alloc.get_hits(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_free()
+{
+    thread_data_allocator alloc(64, 8);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i != 8; ++i)
+    {
+        blocks.push_back(alloc.allocate());
+    }
+
+    // free all blocks from another thread
+    std::thread([&]() {
+        for (void* b : blocks)
+        {
+            alloc.deallocate(b);
+        }
+    }).join();
+    HPX_TEST_EQ(alloc.get_remote_frees(false), std::int64_t(8));
+
+    // the remotely freed blocks are reclaimed by the owning thread
+    std::set<void*> reused;
+    for (int i = 0; i != 8; ++i)
+    {
+        reused.insert(alloc.allocate());
+    }
+    HPX_TEST(reused == std::set<void*>(blocks.begin(), blocks.end()));
+    HPX_TEST_EQ(alloc.get_misses(false), std::int64_t(1));
+
+    for (void* b : reused)
+    {
+        alloc.deallocate(b);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_trim()
+{
+    thread_data_allocator alloc(64, 8);
+
+    // a transient peak of allocations
+    std::vector<void*> blocks;
+    for (int i = 0; i != 800; ++i)
+    {
+        blocks.push_back(alloc.allocate());
+    }
+    HPX_TEST_EQ(alloc.get_slabs(), std::int64_t(100));
+
+    // the slabs are returned while the blocks are freed
+    for (void* b : blocks)
+    {
+        alloc.deallocate(b);
+    }
+    HPX_TEST(alloc.get_slabs() < std::int64_t(100));
+
+    // one free slab is kept
+    alloc.trim();
+    HPX_TEST_EQ(alloc.get_slabs(), std::int64_t(1));
+
+    std::int64_t const misses = alloc.get_misses(false);
+    blocks.clear();
+    for (int i = 0; i != 8; ++i)
+    {
+        blocks.push_back(alloc.allocate());
+    }
+    HPX_TEST_EQ(alloc.get_misses(false), misses);
+
+    // slabs with blocks in use are not released
+    alloc.trim();
+    HPX_TEST_EQ(alloc.get_slabs(), std::int64_t(1));
+
+    for (void* b : blocks)
+    {
+        alloc.deallocate(b);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent()
+{
+    thread_data_allocator alloc(256);
+
+    std::size_t const num_threads = 4;
+    std::size_t const num_blocks = 10000;
+
+    // each thread allocates blocks which are freed by its neighbor
+    std::vector<std::vector<void*>> blocks(num_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                void* p = alloc.allocate();
+                std::memset(p, static_cast<int>(t), 256);
+                blocks[t].push_back(p);
+            }
+        });
+    }
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (void* p : blocks[(t + 1) % num_threads])
+            {
+                alloc.deallocate(p);
+            }
+        });
+    }
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(alloc.get_remote_frees(false),
+        static_cast<std::int64_t>(num_threads * num_blocks));
+    HPX_TEST_EQ(alloc.get_hits(false) + alloc.get_misses(false),
+        static_cast<std::int64_t>(num_threads * num_blocks));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_local_reuse();
+    test_remote_free();
+    test_trim();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,244 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+using hpx::threads::detail::timer_entry;
+using hpx::threads::detail::timer_handle;
+using hpx::threads::detail::timer_wheel;
+
+using time_point = std::chrono::steady_clock::time_point;
+
+// timers expire at most one tick late
+constexpr std::chrono::nanoseconds tick(
+    std::int64_t(1) << timer_wheel::tick_bits);
+
+timer_handle make_timer(time_point abs_time)
+{
+    return timer_handle(new timer_entry(abs_time,
+        hpx::threads::thread_id_ref_type(),
+        hpx::threads::thread_schedule_state::pending,
+        hpx::threads::thread_restart_state::timeout));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_expire_in_order()
+{
+    timer_wheel wheel;
+    time_point const now = std::chrono::steady_clock::now();
+
+    // cover all levels of the wheel and the overflow list
+    std::vector<std::chrono::nanoseconds> delays = {
+        std::chrono::nanoseconds(1), std::chrono::microseconds(100),
+        std::chrono::milliseconds(5), std::chrono::milliseconds(300),
+        std::chrono::seconds(10), std::chrono::hours(1),
+        std::chrono::hours(24 * 100)};
+
+    std::mt19937_64 gen(42);
+    for (int i = 0; i != 1000; ++i)
+    {
+        delays.emplace_back(
+            static_cast<std::int64_t>(gen() % 4000000000000ull) >>
+            (gen() % 40));
+    }
+
+    std::vector<std::pair<time_point, timer_handle>> timers;
+    for (auto const& delay : delays)
+    {
+        timer_handle timer = make_timer(now + delay);
+        wheel.add(timer.get());
+        timers.emplace_back(now + delay, timer);
+    }
+    HPX_TEST_EQ(wheel.size(), timers.size());
+
+    std::sort(timers.begin(), timers.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    std::vector<timer_handle> expired;
+    for (auto const& t : timers)
+    {
+        // no timer expires early
+        expired.clear();
+        wheel.expire(t.first - std::chrono::nanoseconds(1), expired);
+        for (timer_handle const& e : expired)
+        {
+            HPX_TEST(e->abs_time_ < t.first);
+        }
+
+        // the timer has expired one tick later at the latest
+        expired.clear();
+        wheel.expire(t.first + tick, expired);
+        for (timer_handle const& e : expired)
+        {
+            HPX_TEST(e->abs_time_ <= t.first + tick);
+        }
+        HPX_TEST(t.second->state_.load() == timer_entry::state::firing);
+    }
+
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(
+        wheel.get_armed_count(false), static_cast<std::int64_t>(delays.size()));
+    HPX_TEST_EQ(
+        wheel.get_fired_count(false), static_cast<std::int64_t>(delays.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cancel()
+{
+    timer_wheel wheel;
+    time_point const now = std::chrono::steady_clock::now();
+
+    std::vector<timer_handle> timers;
+    for (int i = 0; i != 100; ++i)
+    {
+        timers.push_back(make_timer(now + std::chrono::milliseconds(i)));
+        wheel.add(timers.back().get());
+    }
+
+    // cancel every other timer
+    for (std::size_t i = 0; i != timers.size(); i += 2)
+    {
+        HPX_TEST(wheel.cancel(timers[i].get()));
+        HPX_TEST(timers[i]->state_.load() == timer_entry::state::cancelled);
+    }
+    HPX_TEST_EQ(wheel.size(), std::size_t(50));
+
+    // cancelling a timer twice fails
+    HPX_TEST(!wheel.cancel(timers[0].get()));
+
+    std::vector<timer_handle> expired;
+    HPX_TEST_EQ(wheel.expire(now + std::chrono::seconds(1), expired),
+        std::size_t(50));
+    for (timer_handle const& e : expired)
+    {
+        HPX_TEST(e->state_.load() == timer_entry::state::firing);
+    }
+
+    // expired timers can't be cancelled anymore
+    HPX_TEST(!wheel.cancel(timers[1].get()));
+
+    HPX_TEST_EQ(wheel.get_cancelled_count(true), std::int64_t(50));
+    HPX_TEST_EQ(wheel.get_cancelled_count(false), std::int64_t(0));
+    HPX_TEST_EQ(wheel.get_fired_count(false), std::int64_t(50));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_retry()
+{
+    timer_wheel wheel;
+    time_point const now = std::chrono::steady_clock::now();
+
+    timer_handle timer = make_timer(now + std::chrono::milliseconds(1));
+    wheel.add(timer.get());
+
+    std::vector<timer_handle> expired;
+    HPX_TEST_EQ(wheel.expire(now + std::chrono::milliseconds(2), expired),
+        std::size_t(1));
+
+    // a retried timer is returned by the next call to expire
+    wheel.retry(timer.get());
+    HPX_TEST(timer->state_.load() == timer_entry::state::armed);
+    HPX_TEST_EQ(wheel.size(), std::size_t(1));
+
+    expired.clear();
+    HPX_TEST_EQ(wheel.expire(now + std::chrono::milliseconds(2), expired),
+        std::size_t(1));
+    HPX_TEST(expired[0] == timer);
+    HPX_TEST_EQ(wheel.get_fired_count(false), std::int64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_next_expiry()
+{
+    timer_wheel wheel;
+    time_point const now = std::chrono::steady_clock::now();
+
+    HPX_TEST(wheel.next_expiry() == (time_point::max)());
+
+    // the next expiry never lies beyond the earliest armed timer
+    timer_handle t1 = make_timer(now + std::chrono::hours(24 * 100));
+    wheel.add(t1.get());
+    timer_handle t2 = make_timer(now + std::chrono::hours(1));
+    wheel.add(t2.get());
+    HPX_TEST(wheel.next_expiry() <= now + std::chrono::hours(1));
+
+    timer_handle t3 = make_timer(now + std::chrono::milliseconds(10));
+    wheel.add(t3.get());
+    HPX_TEST(wheel.next_expiry() <= now + std::chrono::milliseconds(10));
+
+    std::vector<timer_handle> expired;
+    HPX_TEST_EQ(
+        wheel.expire(now + std::chrono::milliseconds(10) + tick, expired),
+        std::size_t(1));
+    HPX_TEST(wheel.next_expiry() > now + std::chrono::milliseconds(10));
+    HPX_TEST(wheel.next_expiry() <= now + std::chrono::hours(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_may_expire()
+{
+    timer_wheel wheel;
+    time_point const now = std::chrono::steady_clock::now();
+
+    HPX_TEST(!wheel.may_expire(now + std::chrono::hours(24 * 1000)));
+    HPX_TEST(wheel.next_expiry_hint() == time_point::max());
+
+    timer_handle t1 = make_timer(now + std::chrono::hours(1));
+    wheel.add(t1.get());
+    timer_handle t2 = make_timer(now + std::chrono::milliseconds(10));
+    wheel.add(t2.get());
+
+    // the wheel has to be polled no later than its earliest timer expires
+    HPX_TEST(!wheel.may_expire(now));
+    HPX_TEST(wheel.may_expire(now + std::chrono::milliseconds(10) + tick));
+    HPX_TEST(wheel.next_expiry_hint() <= wheel.next_expiry());
+    HPX_TEST(wheel.next_expiry_hint() <= now + std::chrono::milliseconds(10));
+
+    std::vector<timer_handle> expired;
+    HPX_TEST_EQ(
+        wheel.expire(now + std::chrono::milliseconds(10) + tick, expired),
+        std::size_t(1));
+    HPX_TEST(!wheel.may_expire(now + std::chrono::milliseconds(10) + tick));
+    HPX_TEST(wheel.may_expire(now + std::chrono::hours(1) + tick));
+
+    // a timer which could not be fired has to be expired again immediately
+    wheel.retry(expired[0].get());
+    HPX_TEST(wheel.may_expire(now + std::chrono::milliseconds(10) + tick));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_destroy_armed()
+{
+    // the wheel releases the timers which are still armed on destruction
+    timer_handle timer =
+        make_timer(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    {
+        timer_wheel wheel;
+        wheel.add(timer.get());
+    }
+    HPX_TEST(timer->state_.load() == timer_entry::state::armed);
+}
+
+int main()
+{
+    test_expire_in_order();
+    test_cancel();
+    test_retry();
+    test_next_expiry();
+    test_may_expire();
+    test_destroy_armed();
+
+    return hpx::util::report_errors();
+}
@@ -392,6 +392,14 @@ namespace hpx { namespace threads {
         std::int64_t get_num_stolen_to_staged(bool reset);
 #endif
 
+        std::int64_t get_armed_timers_count(bool reset);
+        std::int64_t get_fired_timers_count(bool reset);
+        std::int64_t get_cancelled_timers_count(bool reset);
+
+        std::int64_t get_idle_park_count(bool reset);
+        std::int64_t get_idle_parked_time(bool reset);
+        std::int64_t get_idle_wakeup_count(bool reset);
+
     private:
         mutable mutex_type mtx_;    // mutex protecting the members
 
@@ -507,6 +507,34 @@ namespace hpx { namespace threads {
                 pools_.push_back(HPX_MOVE(pool));
                 break;
             }
+
+            case resource::local_workstealing:
+            {
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_workstealing_scheduler<>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, thread_queue_init,
+                    "core-local_workstealing_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -1007,6 +1035,54 @@ namespace hpx { namespace threads {
     }
 #endif
 
+    std::int64_t threadmanager::get_armed_timers_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_armed_timers_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_fired_timers_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_fired_timers_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_cancelled_timers_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_cancelled_timers_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_park_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_park_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_parked_time(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_parked_time(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_wakeup_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_wakeup_count(all_threads, reset);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool threadmanager::run()
     {
@@ -77,13 +77,16 @@ namespace hpx { namespace actions {
         primary_namespace_allocate_action_id,
         primary_namespace_begin_migration_action_id,
         primary_namespace_bind_gid_action_id,
+        primary_namespace_bind_gids_action_id,
         primary_namespace_colocate_action_id,
         primary_namespace_decrement_credit_action_id,
         primary_namespace_end_migration_action_id,
         primary_namespace_increment_credit_action_id,
+        primary_namespace_increment_credits_action_id,
         primary_namespace_resolve_gid_action_id,
         primary_namespace_route_action_id,
         primary_namespace_unbind_gid_action_id,
+        primary_namespace_unbind_gids_action_id,
         primary_namespace_statistics_counter_action_id,
         remove_from_connection_cache_action_id,
         set_value_action_agas_bool_response_type_id,
@@ -175,6 +178,8 @@ namespace hpx { namespace actions {
         base_lco_with_value_parcelset_endpoints_set,
         base_lco_with_value_vector_compute_host_target_get,
         base_lco_with_value_vector_compute_host_target_set,
+        base_lco_with_value_vector_naming_address_get,
+        base_lco_with_value_vector_naming_address_set,
 
         // typed continuations...
         typed_continuation_hpx_agas_response,
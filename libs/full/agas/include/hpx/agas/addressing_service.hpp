@@ -12,15 +12,19 @@
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
 #include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/modules/agas_base.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <boost/dynamic_bitset.hpp>
@@ -62,16 +66,28 @@ namespace hpx { namespace agas {
 
         using mutex_type = hpx::lcos::local::spinlock;
 
-        // gva cache
+        // gva cache, the entries are distributed over independently locked
+        // shards to avoid contention between concurrent address resolutions
         struct gva_cache_key;
+        struct gva_cache_sharder;
 
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_type = hpx::util::cache::sharded_cache<
+            hpx::util::cache::lru_cache<gva_cache_key, gva,
+                hpx::util::cache::statistics::local_full_statistics>,
+            mutex_type, gva_cache_sharder>;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
+        // lower id, number of ids, base address, and offset of a range of
+        // global ids to bind
+        using bind_range_request_type = hpx::tuple<naming::gid_type,
+            std::uint64_t, naming::address, std::uint64_t>;
+
+        // lower id and number of ids of a range of global ids to unbind
+        using unbind_range_request_type =
+            hpx::tuple<naming::gid_type, std::uint64_t>;
+
         std::shared_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
@@ -82,12 +98,41 @@ namespace hpx { namespace agas {
 
         std::size_t const max_refcnt_requests_;
 
+        // time (in milliseconds) after which buffered decref requests are
+        // sent even if max_refcnt_requests_ was not reached, 0 disables this
+        std::size_t const max_refcnt_delay_;
+
         mutex_type refcnt_requests_mtx_;
         std::size_t refcnt_requests_count_;
         bool enable_refcnt_caching_;
+        bool refcnt_timer_started_;
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // periodically sends the buffered decref requests, started when a
+        // request is buffered and stopped once the buffer stays empty
+        hpx::util::interval_timer refcnt_timer_;
+
+        // incref requests for remote AGAS service instances which are
+        // waiting to be sent, all requests issued for the same instance
+        // until the first of them is sent are combined into one message
+        struct pending_incref
+        {
+            std::int64_t credits_;
+            naming::gid_type gid_;
+            hpx::lcos::local::promise<std::int64_t> result_;
+        };
+        using pending_increfs_type =
+            std::map<naming::gid_type, std::vector<pending_incref>>;
+
+        mutex_type pending_increfs_mtx_;
+        pending_increfs_type pending_increfs_;
+
+        // number of decref requests merged into the buffer and number of
+        // decrement_credit messages sent for them
+        std::atomic<std::int64_t> refcnt_requests_aggregated_;
+        std::atomic<std::int64_t> refcnt_requests_sent_;
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
@@ -112,15 +157,16 @@ namespace hpx { namespace agas {
 
         explicit addressing_service(util::runtime_configuration const& ini_);
 
-#if defined(HPX_HAVE_NETWORKING)
         ~addressing_service()
         {
+            // the timer must not access this object anymore
+            refcnt_timer_.stop(true);
+
+#if defined(HPX_HAVE_NETWORKING)
             // TODO: Free the future pools?
             destroy_big_boot_barrier();
-        }
-#else
-        ~addressing_service() = default;
 #endif
+        }
 
         void bootstrap(parcelset::endpoints_type const& endpoints,
             util::runtime_configuration& rtcfg);
@@ -225,6 +271,7 @@ namespace hpx { namespace agas {
             future<primary_namespace::resolved_type> f);
         bool bind_postproc(
             naming::gid_type const& id, gva const& g, future<bool> f);
+        void cache_bound_range(naming::gid_type const& id, gva const& g);
 
         /// Maintain list of migrated objects
         bool was_object_migrated_locked(naming::gid_type const& id);
@@ -234,6 +281,22 @@ namespace hpx { namespace agas {
         void send_refcnt_requests(
             std::unique_lock<mutex_type>& l, error_code& ec = throws);
 
+        /// Make sure the buffered decref requests are sent after at most
+        /// max_refcnt_delay_ milliseconds. Assumes that
+        /// \a refcnt_requests_mtx_ is locked.
+        void schedule_refcnt_requests(std::unique_lock<mutex_type>& l);
+
+        /// Invoked by refcnt_timer_, sends the buffered decref requests
+        bool send_delayed_refcnt_requests();
+
+        /// Send an incref request, requests for remote AGAS service
+        /// instances are combined with other requests issued concurrently.
+        hpx::future<std::int64_t> send_incref_request(
+            std::int64_t credits, naming::gid_type const& gid);
+
+        /// Send all pending incref requests for the given service instance
+        void send_pending_increfs(naming::gid_type const& service);
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
             std::unique_lock<mutex_type>& l, error_code& ec);
@@ -264,6 +327,10 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset);
         std::uint64_t get_cache_erase_entry_time(bool reset);
 
+        // Helper functions to access the decref aggregation statistics
+        std::int64_t get_refcnt_aggregated_count(bool reset);
+        std::int64_t get_refcnt_sent_count(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
@@ -756,6 +823,36 @@ namespace hpx { namespace agas {
         hpx::future<naming::address> unbind_range_async(
             naming::gid_type const& lower_id, std::uint64_t count = 1);
 
+        /// \brief Bind several ranges of global ids at once
+        ///
+        /// This is equivalent to calling \a bind_range_async for each of
+        /// the given ranges, except that all ranges handled by the same AGAS
+        /// service instance are bound using a single request.
+        ///
+        /// \param ranges     [in] The lower id, the number of ids, the base
+        ///                   address, and the offset of each range to bind.
+        ///                   Each range is bound to the locality its lower
+        ///                   id belongs to.
+        ///
+        /// \returns          A future holding whether each of the ranges was
+        ///                   successfully bound (in the order of \a ranges).
+        hpx::future<std::vector<bool>> bind_ranges_async(
+            std::vector<bind_range_request_type> ranges);
+
+        /// \brief Unbind several ranges of global ids at once
+        ///
+        /// This is equivalent to calling \a unbind_range_async for each of
+        /// the given ranges, except that all ranges handled by the same AGAS
+        /// service instance are unbound using a single request.
+        ///
+        /// \param ranges     [in] The lower id and the number of ids of each
+        ///                   range to unbind.
+        ///
+        /// \returns          A future holding the local addresses the ranges
+        ///                   were bound to (in the order of \a ranges).
+        hpx::future<std::vector<naming::address>> unbind_ranges_async(
+            std::vector<unbind_range_request_type> ranges);
+
         /// \brief Test whether the given address refers to a local object.
         ///
         /// This function will test whether the given address refers to an object
@@ -33,11 +33,13 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
@@ -116,14 +118,60 @@ namespace hpx { namespace agas {
         }
     };    // }}}
 
+    // Consecutive ids are grouped into blocks, each block is assigned to a
+    // shard of the cache. A key covering a range of ids is stored in all
+    // shards its blocks map to, which guarantees that any id inside the range
+    // finds the entry in the shard it maps to.
+    struct addressing_service::gva_cache_sharder
+    {
+        static constexpr int block_bits = 6;
+
+        std::pair<std::size_t, std::size_t> operator()(
+            gva_cache_key const& key, std::size_t num_shards) const
+        {
+            naming::gid_type const& first = key.get_gid();
+
+            std::uint64_t const first_block = first.get_lsb() >> block_bits;
+            std::uint64_t const last_lsb = first.get_lsb() + key.get_count();
+
+            std::size_t const shard = static_cast<std::size_t>(
+                (std::hash<std::uint64_t>()(first.get_msb()) + first_block) %
+                num_shards);
+
+            // the range wraps around into the next msb
+            if (last_lsb < first.get_lsb())
+            {
+                return std::make_pair(shard, num_shards);
+            }
+
+            std::uint64_t const num_blocks =
+                (last_lsb >> block_bits) - first_block + 1;
+            return std::make_pair(shard,
+                num_blocks < num_shards ? static_cast<std::size_t>(num_blocks) :
+                                          num_shards);
+        }
+    };
+
+    // number of independently locked shards of the gva cache
+    constexpr std::size_t gva_cache_num_shards = 32;
+
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
-      : gva_cache_(new gva_cache_type)
+      : gva_cache_(new gva_cache_type(gva_cache_num_shards))
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
+      , max_refcnt_delay_(ini_.get_agas_max_pending_refcnt_delay())
       , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
+      , refcnt_timer_started_(false)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_timer_(
+            util::bind_front(
+                &addressing_service::send_delayed_refcnt_requests, this),
+            static_cast<std::int64_t>(max_refcnt_delay_) * 1000,
+            "addressing_service::send_delayed_refcnt_requests")
+      , refcnt_requests_aggregated_(0)
+      , refcnt_requests_sent_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -667,7 +715,13 @@ namespace hpx { namespace agas {
         naming::gid_type const& lower_id, gva const& g, future<bool> f)
     {
         f.get();
+        cache_bound_range(lower_id, g);
+        return true;
+    }
 
+    void addressing_service::cache_bound_range(
+        naming::gid_type const& lower_id, gva const& g)
+    {
         if (range_caching_)
         {
             // Put the range into the cache.
@@ -679,8 +733,6 @@ namespace hpx { namespace agas {
             gva const first_g = g.resolve(lower_id, lower_id);
             update_cache_entry(lower_id, first_g);
         }
-
-        return true;
     }
 
     hpx::future<bool> addressing_service::bind_range_async(
@@ -711,6 +763,143 @@ namespace hpx { namespace agas {
         return primary_ns_.unbind_gid_async(count, lower_id);
     }
 
+    namespace detail {
+
+        // Put the results of the batched requests sent to the different
+        // service instances back into the order of the original requests.
+        template <typename T>
+        std::vector<T> gather_batched_results(std::size_t size,
+            std::vector<hpx::future<std::vector<T>>>& results,
+            std::vector<std::vector<std::size_t>> const& positions)
+        {
+            std::vector<T> gathered(size);
+            for (std::size_t i = 0; i != results.size(); ++i)
+            {
+                std::vector<T> result = results[i].get();    // rethrow errors
+                HPX_ASSERT(result.size() == positions[i].size());
+
+                for (std::size_t j = 0; j != result.size(); ++j)
+                {
+                    gathered[positions[i][j]] = result[j];
+                }
+            }
+            return gathered;
+        }
+    }    // namespace detail
+
+    hpx::future<std::vector<bool>> addressing_service::bind_ranges_async(
+        std::vector<bind_range_request_type> ranges)
+    {
+        // collect the requests for each service instance, together with the
+        // positions of the corresponding ranges
+        using requests_type = std::map<naming::gid_type,
+            std::pair<
+                std::vector<server::primary_namespace::bind_gid_request_type>,
+                std::vector<std::size_t>>>;
+        requests_type requests;
+
+        std::vector<hpx::tuple<naming::gid_type, gva>> bindings;
+        bindings.reserve(ranges.size());
+
+        for (std::size_t i = 0; i != ranges.size(); ++i)
+        {
+            bind_range_request_type const& range = ranges[i];
+            naming::address const& baseaddr = hpx::get<2>(range);
+
+            naming::gid_type id(naming::detail::
+                    get_stripped_gid_except_dont_cache(hpx::get<0>(range)));
+            gva const g(baseaddr.locality_, baseaddr.type_,
+                hpx::get<1>(range), baseaddr.address_, hpx::get<3>(range));
+
+            auto& request =
+                requests[primary_namespace::get_service_instance(id)];
+            request.first.push_back(
+                hpx::make_tuple(g, id, naming::get_locality_from_gid(id)));
+            request.second.push_back(i);
+
+            bindings.push_back(hpx::make_tuple(id, g));
+        }
+
+        std::vector<hpx::future<std::vector<bool>>> results;
+        std::vector<std::vector<std::size_t>> positions;
+        results.reserve(requests.size());
+        positions.reserve(requests.size());
+
+        for (auto& request : requests)
+        {
+            results.push_back(
+                primary_ns_.bind_gids_async(HPX_MOVE(request.second.first)));
+            positions.push_back(HPX_MOVE(request.second.second));
+        }
+
+        return hpx::when_all(HPX_MOVE(results)).then(hpx::launch::sync,
+            [this, bindings = HPX_MOVE(bindings),
+                positions = HPX_MOVE(positions)](
+                hpx::future<std::vector<hpx::future<std::vector<bool>>>>&& f)
+                -> std::vector<bool> {
+                std::vector<hpx::future<std::vector<bool>>> results = f.get();
+                std::vector<bool> bound = detail::gather_batched_results(
+                    bindings.size(), results, positions);
+
+                for (std::size_t i = 0; i != bound.size(); ++i)
+                {
+                    if (bound[i])
+                    {
+                        cache_bound_range(
+                            hpx::get<0>(bindings[i]), hpx::get<1>(bindings[i]));
+                    }
+                }
+                return bound;
+            });
+    }
+
+    hpx::future<std::vector<naming::address>>
+    addressing_service::unbind_ranges_async(
+        std::vector<unbind_range_request_type> ranges)
+    {
+        // collect the requests for each service instance, together with the
+        // positions of the corresponding ranges
+        using requests_type = std::map<naming::gid_type,
+            std::pair<
+                std::vector<server::primary_namespace::unbind_gid_request_type>,
+                std::vector<std::size_t>>>;
+        requests_type requests;
+
+        for (std::size_t i = 0; i != ranges.size(); ++i)
+        {
+            naming::gid_type const& id = hpx::get<0>(ranges[i]);
+
+            auto& request =
+                requests[primary_namespace::get_service_instance(id)];
+            request.first.push_back(
+                hpx::make_tuple(hpx::get<1>(ranges[i]), id));
+            request.second.push_back(i);
+        }
+
+        std::vector<hpx::future<std::vector<naming::address>>> results;
+        std::vector<std::vector<std::size_t>> positions;
+        results.reserve(requests.size());
+        positions.reserve(requests.size());
+
+        for (auto& request : requests)
+        {
+            results.push_back(
+                primary_ns_.unbind_gids_async(HPX_MOVE(request.second.first)));
+            positions.push_back(HPX_MOVE(request.second.second));
+        }
+
+        std::size_t const size = ranges.size();
+        return hpx::when_all(HPX_MOVE(results)).then(hpx::launch::sync,
+            [size, positions = HPX_MOVE(positions)](
+                hpx::future<
+                    std::vector<hpx::future<std::vector<naming::address>>>>&& f)
+                -> std::vector<naming::address> {
+                std::vector<hpx::future<std::vector<naming::address>>> results =
+                    f.get();
+                return detail::gather_batched_results(size, results, positions);
+            });
+    }
+
     bool addressing_service::unbind_range_local(
         naming::gid_type const& lower_id, std::uint64_t count,
         naming::address& addr, error_code& ec)
@@ -1351,8 +1540,8 @@ namespace hpx { namespace agas {
 
         naming::gid_type const e_lower = pending_incref.first;
 
-        hpx::future<std::int64_t> f = primary_ns_.increment_credit(
-            pending_incref.second, e_lower, e_lower);
+        hpx::future<std::int64_t> f =
+            send_incref_request(pending_incref.second, e_lower);
 
         // pass the amount of compensated decrefs to the callback
         using util::placeholders::_1;
@@ -1362,6 +1551,93 @@ namespace hpx { namespace agas {
                     this, _1, keep_alive, pending_decrefs)));
     }    // }}}
 
+    hpx::future<std::int64_t> addressing_service::send_incref_request(
+        std::int64_t credits, naming::gid_type const& gid)
+    {
+        naming::gid_type const service =
+            primary_namespace::get_service_instance(gid);
+
+        if (!enable_refcnt_caching_ ||
+            naming::get_locality_id_from_gid(service) ==
+                naming::get_locality_id_from_gid(get_local_locality()))
+        {
+            return primary_ns_.increment_credit(credits, gid, gid);
+        }
+
+        pending_incref request{credits, gid, {}};
+        hpx::future<std::int64_t> f = request.result_.get_future();
+
+        bool first_request = false;
+        {
+            std::lock_guard<mutex_type> l(pending_increfs_mtx_);
+
+            std::vector<pending_incref>& requests = pending_increfs_[service];
+            first_request = requests.empty();
+            requests.push_back(HPX_MOVE(request));
+        }
+
+        // the requests issued until the new thread runs are sent along
+        if (first_request)
+        {
+            hpx::apply(
+                &addressing_service::send_pending_increfs, this, service);
+        }
+        return f;
+    }
+
+    void addressing_service::send_pending_increfs(
+        naming::gid_type const& service)
+    {
+        std::vector<pending_incref> requests;
+        {
+            std::lock_guard<mutex_type> l(pending_increfs_mtx_);
+
+            pending_increfs_type::iterator it = pending_increfs_.find(service);
+            if (it == pending_increfs_.end())
+                return;
+
+            requests = HPX_MOVE(it->second);
+            pending_increfs_.erase(it);
+        }
+
+        std::vector<server::primary_namespace::credit_request_type> credits;
+        credits.reserve(requests.size());
+        for (pending_incref const& request : requests)
+        {
+            credits.push_back(hpx::make_tuple(
+                request.credits_, request.gid_, request.gid_));
+        }
+
+        LAGAS_(info).format(
+            "addressing_service::send_pending_increfs, requests({1})",
+            requests.size());
+
+        // hand the results to the waiting requests once they arrive, without
+        // blocking this thread for the round trip
+        primary_ns_.increment_credits(HPX_MOVE(credits))
+            .then(hpx::launch::sync,
+                [requests = HPX_MOVE(requests)](
+                    hpx::future<std::vector<std::int64_t>>&& f) mutable {
+                    if (f.has_exception())
+                    {
+                        std::exception_ptr const e = f.get_exception_ptr();
+                        for (pending_incref& request : requests)
+                        {
+                            request.result_.set_exception(e);
+                        }
+                        return;
+                    }
+
+                    std::vector<std::int64_t> results = f.get();
+                    HPX_ASSERT(results.size() == requests.size());
+
+                    for (std::size_t i = 0; i != requests.size(); ++i)
+                    {
+                        requests[i].result_.set_value(results[i]);
+                    }
+                });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void addressing_service::decref(
         naming::gid_type const& gid, std::int64_t credit, error_code& ec)
@@ -1399,6 +1675,8 @@ namespace hpx { namespace agas {
             using iterator = refcnt_requests_type::iterator;
             using mapping = refcnt_requests_type::value_type;
 
+            ++refcnt_requests_aggregated_;
+
             iterator matches = refcnt_requests_->find(raw);
             if (matches != refcnt_requests_->end())
             {
@@ -1653,27 +1931,17 @@ namespace hpx { namespace agas {
 
             const gva_cache_key key(gid, count);
 
+            if (!gva_cache_->update_if(key, g, check_for_collisions))
             {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
+                if (LAGAS_ENABLED(warning))
                 {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
+                    // Figure out who we collided with. The colliding entry
+                    // may have been evicted concurrently in the meantime.
+                    addressing_service::gva_cache_key idbase;
+                    addressing_service::gva_cache_type::entry_type e;
 
+                    if (gva_cache_->get_entry(key, idbase, e))
+                    {
                         LAGAS_(warning).format(
                             "addressing_service::update_cache_entry, aborting "
                             "update due to key collision in cache, "
@@ -1704,7 +1972,6 @@ namespace hpx { namespace agas {
         gva_cache_key k(gid);
         gva_cache_key idbase_key;
 
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
         if (gva_cache_->get_entry(k, idbase_key, gva))
         {
             const std::uint64_t id_msb =
@@ -1712,7 +1979,6 @@ namespace hpx { namespace agas {
 
             if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
@@ -1741,8 +2007,6 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1788,8 +2052,6 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
                 return gid == p.first.get_gid();
             });
@@ -1819,82 +2081,92 @@ namespace hpx { namespace agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.hits(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.misses(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.evictions(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.insertions(reset); });
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_get_entry_count(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_insert_entry_count(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_update_entry_count(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_erase_entry_count(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_get_entry_time(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_insert_entry_time(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_update_entry_time(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return gva_cache_->accumulate_statistics(
+            [reset](auto& s) { return s.get_erase_entry_time(reset); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t addressing_service::get_refcnt_aggregated_count(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_requests_aggregated_, reset);
+    }
+
+    std::int64_t addressing_service::get_refcnt_sent_count(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_requests_sent_, reset);
     }
 
     void addressing_service::register_server_instances()
@@ -1939,12 +2211,52 @@ namespace hpx { namespace agas {
 
         if (!enable_refcnt_caching_ ||
             max_refcnt_requests_ == ++refcnt_requests_count_)
+        {
             send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        // make sure the buffered requests are not delayed indefinitely
+        schedule_refcnt_requests(l);
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
+    void addressing_service::schedule_refcnt_requests(
+        std::unique_lock<addressing_service::mutex_type>& l)
+    {
+        HPX_ASSERT(l.owns_lock());
+
+        if (refcnt_timer_started_ || max_refcnt_delay_ == 0)
+            return;
+
+        // the timer keeps running while requests are buffered, it is
+        // stopped once it finds nothing to send
+        refcnt_timer_started_ = true;
+
+        util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+        refcnt_timer_.start(false);
+    }
+
+    bool addressing_service::send_delayed_refcnt_requests()
+    {
+        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+        if (refcnt_requests_->empty())
+        {
+            // stop the timer while holding the lock, schedule_refcnt_requests
+            // restarts it for the next buffered request (returning false
+            // would terminate the timer for good)
+            refcnt_timer_started_ = false;
+            refcnt_timer_.stop();
+            return true;
+        }
+
+        error_code ec(lightweight);
+        send_refcnt_requests_non_blocking(l, ec);
+        return true;
+    }
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l,
@@ -2024,6 +2336,8 @@ namespace hpx { namespace agas {
             }
 
             // send requests to all locality
+            refcnt_requests_sent_ += static_cast<std::int64_t>(requests.size());
+
             requests_type::iterator end = requests.end();
             for (requests_type::iterator it = requests.begin(); it != end; ++it)
             {
@@ -2097,6 +2411,8 @@ namespace hpx { namespace agas {
         }
 
         // send requests to all locality
+        refcnt_requests_sent_ += static_cast<std::int64_t>(requests.size());
+
         requests_type::iterator end = requests.end();
         for (requests_type::iterator it = requests.begin(); it != end; ++it)
         {
@@ -2241,7 +2557,31 @@ namespace hpx { namespace agas {
 
         naming::gid_type gid(naming::detail::get_stripped_gid(id.get_gid()));
 
-        return primary_ns_.begin_migration(gid);
+        // the buffered decref requests have to be handled before the object
+        // is migrated
+        std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
+        if (caching_)
+        {
+            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+            lazy_results = send_refcnt_requests_async(l);
+        }
+
+        if (lazy_results.empty())
+        {
+            return primary_ns_.begin_migration(gid);
+        }
+
+        return hpx::when_all(lazy_results)
+            .then(hpx::launch::sync,
+                [this, gid](hpx::future<std::vector<
+                        hpx::future<std::vector<std::int64_t>>>>&& f) {
+                    // re throw possible errors
+                    for (auto&& result : f.get())
+                    {
+                        result.get();
+                    }
+                    return primary_ns_.begin_migration(gid);
+                });
     }
 
     bool addressing_service::end_migration(naming::id_type const& id)
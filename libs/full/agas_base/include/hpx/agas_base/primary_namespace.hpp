@@ -85,6 +85,18 @@ namespace hpx { namespace agas {
         future<std::int64_t> increment_credit(std::int64_t credits,
             naming::gid_type lower, naming::gid_type upper);
 
+        // Batched versions of bind_gid_async, unbind_gid_async, and
+        // increment_credit. All requests are sent to the service instance
+        // responsible for the first gid in the list.
+        future<std::vector<bool>> bind_gids_async(std::vector<
+            hpx::tuple<gva, naming::gid_type, naming::gid_type>>&& requests);
+        future<std::vector<naming::address>> unbind_gids_async(
+            std::vector<hpx::tuple<std::uint64_t, naming::gid_type>>&&
+                requests);
+        future<std::vector<std::int64_t>> increment_credits(
+            std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+                naming::gid_type>>&& requests);
+
         std::pair<naming::gid_type, naming::gid_type> allocate(
             std::uint64_t count);
 
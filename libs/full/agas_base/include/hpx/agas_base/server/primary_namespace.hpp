@@ -19,6 +19,7 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
@@ -126,22 +127,40 @@ namespace hpx::agas::server {
         using resolved_type =
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
-    private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
+        using bind_gid_request_type =
+            hpx::tuple<gva, naming::gid_type, naming::gid_type>;
+        using unbind_gid_request_type =
+            hpx::tuple<std::uint64_t, naming::gid_type>;
+        using credit_request_type =
+            hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>;
 
+    private:
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+        // The tables are split into independently locked shards. Consecutive
+        // gids are grouped into blocks of 2^block_bits ids, each block is
+        // assigned to a shard. A gva table entry covering a range of gids is
+        // stored in all shards the blocks of the range map to, which makes
+        // sure that all gids in the range are resolved by their own shard.
+        struct shard
+        {
+            mutex_type mutex_;
+            gva_table_type gvas_;
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+        using shard_type = util::cache_aligned_data<shard>;
+
+        static constexpr std::size_t num_shards = 32;
+        static constexpr int block_bits = 6;
+
+        std::unique_ptr<shard_type[]> shards_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
         struct update_time_on_exit;
 
@@ -226,14 +245,25 @@ namespace hpx::agas::server {
 
     private:
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        /// Dump the credit counts of all matching ranges. Expects that \p l
-        /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
+        /// Dump the credit counts of all matching ranges stored in the shard
+        /// of \p lower. Expects that \p l is locked.
+        void dump_refcnt_matches(naming::gid_type const& lower,
             naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
             const char* func_name);
 #endif
 
+        // Return the shard responsible for the given gid
+        shard& get_shard(naming::gid_type const& id) noexcept;
+
+        // Return the (sorted) indices of all shards the range of count gids
+        // starting at id maps to
+        std::vector<std::size_t> get_shard_indices(
+            naming::gid_type const& id, std::uint64_t count) const;
+
+        // Lock the shards with the given (sorted) indices
+        std::vector<std::unique_lock<mutex_type>> lock_shards(
+            std::vector<std::size_t> const& indices);
+
         // helper function
         void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
             naming::gid_type const& id, error_code& ec);
@@ -241,7 +271,7 @@ namespace hpx::agas::server {
     public:
         primary_namespace()
           : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
-          , mutex_()
+          , shards_(new shard_type[num_shards])
           , instance_name_()
           , next_id_(naming::invalid_gid)
           , locality_(naming::invalid_gid)
@@ -269,6 +299,9 @@ namespace hpx::agas::server {
         bool bind_gid(gva const& g, naming::gid_type id,
             naming::gid_type const& locality);
 
+        // Return the lock protecting the entries for the given gid
+        std::unique_lock<mutex_type> lock_shard(naming::gid_type const& id);
+
         // API
         std::pair<naming::id_type, naming::address> begin_migration(
             naming::gid_type id);
@@ -290,10 +323,22 @@ namespace hpx::agas::server {
         std::pair<naming::gid_type, naming::gid_type> allocate(
             std::uint64_t count);
 
-    private:
+        // batched versions of bind_gid, unbind_gid, and increment_credit
+        std::vector<bool> bind_gids(
+            std::vector<bind_gid_request_type> const& requests);
+
+        std::vector<naming::address> unbind_gids(
+            std::vector<unbind_gid_request_type> const& requests);
+
+        std::vector<std::int64_t> increment_credits(
+            std::vector<credit_request_type> const& requests);
+
+        // Resolve the given gid, expects that l holds the lock returned by
+        // lock_shard(gid).
         resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
             naming::gid_type const& gid, error_code& ec);
 
+    private:
         void increment(naming::gid_type const& lower,
             naming::gid_type const& upper, std::int64_t& credits,
             error_code& ec);
@@ -318,11 +363,12 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
-            free_entry_list_type& free_entry_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec);
+        // Resolve the object referred to by gid, whose credit count dropped
+        // to zero, and remove it from the refcnt table of its shard. Expects
+        // that l holds the lock of that shard.
+        void resolve_free_entry(std::unique_lock<mutex_type>& l,
+            naming::gid_type const& gid,
+            free_entry_list_type& free_entry_list, error_code& ec);
 
         void decrement_sweep(free_entry_list_type& free_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
@@ -335,13 +381,16 @@ namespace hpx::agas::server {
     public:
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gids)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, colocate)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, begin_migration)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, end_migration)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credits)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gids)
 #if defined(HPX_HAVE_NETWORKING)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route)
 #endif
@@ -362,6 +411,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::bind_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::begin_migration_action)
 
@@ -390,6 +446,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::increment_credit_action,
     primary_namespace_increment_credit_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::increment_credits_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::increment_credits_action,
+    primary_namespace_increment_credits_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::resolve_gid_action)
 
@@ -411,6 +474,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::unbind_gid_action,
     primary_namespace_unbind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::unbind_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::unbind_gids_action,
+    primary_namespace_unbind_gids_action)
+
 #if defined(HPX_HAVE_NETWORKING)
 HPX_ACTION_USES_MEDIUM_STACK(hpx::agas::server::primary_namespace::route_action)
 
@@ -434,6 +504,8 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
     std_pair_gid_type, std_pair_gid_type)
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
     std::vector<std::int64_t>, vector_std_int64_type)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    std::vector<hpx::naming::address>, vector_naming_address_type)
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE) && defined(HPX_HAVE_NETWORKING)
 namespace hpx::traits {
@@ -41,6 +41,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action,
     hpx::actions::primary_namespace_bind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action,
+    hpx::actions::primary_namespace_bind_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::begin_migration_action,
     primary_namespace_begin_migration_action,
     hpx::actions::primary_namespace_begin_migration_action_id)
@@ -57,6 +61,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::increment_credit_action,
     primary_namespace_increment_credit_action,
     hpx::actions::primary_namespace_increment_credit_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::increment_credits_action,
+    primary_namespace_increment_credits_action,
+    hpx::actions::primary_namespace_increment_credits_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
@@ -69,6 +77,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::unbind_gid_action,
     primary_namespace_unbind_gid_action,
     hpx::actions::primary_namespace_unbind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::unbind_gids_action,
+    primary_namespace_unbind_gids_action,
+    hpx::actions::primary_namespace_unbind_gids_action_id)
+
 #if defined(HPX_HAVE_NETWORKING)
 HPX_REGISTER_ACTION_ID(primary_namespace::route_action,
     primary_namespace_route_action,
@@ -92,6 +104,10 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std::vector<std::int64_t>,
     vector_std_int64_type,
     hpx::actions::base_lco_with_value_vector_std_int64_get,
     hpx::actions::base_lco_with_value_vector_std_int64_set)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std::vector<hpx::naming::address>,
+    vector_naming_address_type,
+    hpx::actions::base_lco_with_value_vector_naming_address_get,
+    hpx::actions::base_lco_with_value_vector_naming_address_set)
 
 namespace hpx { namespace agas {
 
@@ -336,6 +352,91 @@ namespace hpx { namespace agas {
 #endif
     }
 
+    future<std::vector<bool>> primary_namespace::bind_gids_async(
+        std::vector<server::primary_namespace::bind_gid_request_type>&&
+            requests)
+    {
+        if (requests.empty())
+        {
+            return hpx::make_ready_future(std::vector<bool>());
+        }
+
+        naming::id_type dest =
+            naming::id_type(get_service_instance(hpx::get<1>(requests[0])),
+                naming::id_type::unmanaged);
+
+        if (naming::get_locality_id_from_id(dest) == agas::get_locality_id())
+        {
+            return hpx::make_ready_future(server_->bind_gids(requests));
+        }
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::bind_gids_action action;
+        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(requests));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<bool>());
+#endif
+    }
+
+    future<std::vector<naming::address>> primary_namespace::unbind_gids_async(
+        std::vector<server::primary_namespace::unbind_gid_request_type>&&
+            requests)
+    {
+        if (requests.empty())
+        {
+            return hpx::make_ready_future(std::vector<naming::address>());
+        }
+
+        naming::id_type dest =
+            naming::id_type(get_service_instance(hpx::get<1>(requests[0])),
+                naming::id_type::unmanaged);
+
+        for (auto& req : requests)
+        {
+            hpx::get<1>(req) =
+                naming::detail::get_stripped_gid(hpx::get<1>(req));
+        }
+
+        if (naming::get_locality_id_from_id(dest) == agas::get_locality_id())
+        {
+            return hpx::make_ready_future(server_->unbind_gids(requests));
+        }
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::unbind_gids_action action;
+        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(requests));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<naming::address>());
+#endif
+    }
+
+    future<std::vector<std::int64_t>> primary_namespace::increment_credits(
+        std::vector<server::primary_namespace::credit_request_type>&&
+            requests)
+    {
+        if (requests.empty())
+        {
+            return hpx::make_ready_future(std::vector<std::int64_t>());
+        }
+
+        naming::id_type dest =
+            naming::id_type(get_service_instance(hpx::get<1>(requests[0])),
+                naming::id_type::unmanaged);
+
+        if (naming::get_locality_id_from_id(dest) == agas::get_locality_id())
+        {
+            return hpx::make_ready_future(
+                server_->increment_credits(requests));
+        }
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::increment_credits_action action;
+        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(requests));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<std::int64_t>());
+#endif
+    }
+
     std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
         std::uint64_t count)
     {
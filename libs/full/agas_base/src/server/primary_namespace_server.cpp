@@ -22,9 +22,11 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -84,6 +86,77 @@ namespace hpx { namespace agas { namespace server {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::size_t get_shard_index(naming::gid_type const& id,
+            int block_bits, std::size_t num_shards) noexcept
+        {
+            return static_cast<std::size_t>(
+                (std::hash<std::uint64_t>()(id.get_msb()) +
+                    (id.get_lsb() >> block_bits)) %
+                num_shards);
+        }
+    }    // namespace
+
+    primary_namespace::shard& primary_namespace::get_shard(
+        naming::gid_type const& id) noexcept
+    {
+        return shards_[get_shard_index(naming::detail::get_stripped_gid(id),
+                           block_bits, num_shards)]
+            .data_;
+    }
+
+    std::vector<std::size_t> primary_namespace::get_shard_indices(
+        naming::gid_type const& id, std::uint64_t count) const
+    {
+        naming::gid_type const first = naming::detail::get_stripped_gid(id);
+        std::size_t const first_index =
+            get_shard_index(first, block_bits, num_shards);
+
+        std::uint64_t const first_lsb = first.get_lsb();
+        std::uint64_t const last_lsb = first_lsb + (count != 0 ? count - 1 : 0);
+
+        // the range wraps around into the next msb
+        std::uint64_t num_blocks = num_shards;
+        if (last_lsb >= first_lsb)
+        {
+            num_blocks =
+                (last_lsb >> block_bits) - (first_lsb >> block_bits) + 1;
+        }
+
+        std::size_t const n = num_blocks < num_shards ?
+            static_cast<std::size_t>(num_blocks) :
+            num_shards;
+
+        std::vector<std::size_t> indices;
+        indices.reserve(n);
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            indices.push_back((first_index + i) % num_shards);
+        }
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    std::vector<std::unique_lock<primary_namespace::mutex_type>>
+    primary_namespace::lock_shards(std::vector<std::size_t> const& indices)
+    {
+        std::vector<std::unique_lock<mutex_type>> locks;
+        locks.reserve(indices.size());
+        for (std::size_t i : indices)
+        {
+            locks.emplace_back(shards_[i].data_.mutex_);
+        }
+        return locks;
+    }
+
+    std::unique_lock<primary_namespace::mutex_type>
+    primary_namespace::lock_shard(naming::gid_type const& id)
+    {
+        return std::unique_lock<mutex_type>(get_shard(id).mutex_);
+    }
+
     // start migration of the given object
     std::pair<naming::id_type, naming::address>
     primary_namespace::begin_migration(naming::gid_type id)
@@ -94,7 +167,8 @@ namespace hpx { namespace agas { namespace server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         wait_for_migration_locked(l, id, hpx::throws);
         resolved_type r = resolve_gid_locked(l, id, hpx::throws);
@@ -109,11 +183,11 @@ namespace hpx { namespace agas { namespace server {
             return std::make_pair(naming::invalid_id, naming::address());
         }
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it == s.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                s.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -140,12 +214,13 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -155,7 +230,7 @@ namespace hpx { namespace agas { namespace server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
 
@@ -171,8 +246,11 @@ namespace hpx { namespace agas { namespace server {
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type& migrating_objects =
+            get_shard(id).migrating_objects_;
+
+        migration_table_type::iterator it = migrating_objects.find(id);
+        if (it != migrating_objects.end())
         {
             if (get<0>(it->second))
             {
@@ -181,13 +259,13 @@ namespace hpx { namespace agas { namespace server {
                 get<2>(it->second).wait(l, ec);
 
                 if (--get<1>(it->second) == 0)
-                    migrating_objects_.erase(it);
+                    migrating_objects.erase(it);
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    migrating_objects.erase(it);
                 }
             }
         }
@@ -204,10 +282,15 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // the entry is stored in all shards overlapping with its range, the
+        // checks below only need to look at the shard of the first gid
+        std::vector<std::size_t> const indices =
+            get_shard_indices(id, g.count);
+        std::vector<std::unique_lock<mutex_type>> locks = lock_shards(indices);
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        gva_table_type& gvas = get_shard(id).gvas_;
+        gva_table_type::iterator it = gvas.lower_bound(id),
+                                 begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -219,7 +302,7 @@ namespace hpx { namespace agas { namespace server {
                 if (naming::refers_to_local_lva(gid) &&
                     !naming::refers_to_virtual_memory(gid))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -236,7 +319,7 @@ namespace hpx { namespace agas { namespace server {
                 if (HPX_UNLIKELY(gaddr.count != g.count))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -245,7 +328,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(components::component_invalid == g.type))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -256,7 +339,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(!locality))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -273,7 +356,12 @@ namespace hpx { namespace agas { namespace server {
                 gaddr.offset = g.offset;
                 loc = locality;
 
-                l.unlock();
+                for (std::size_t i : indices)
+                {
+                    shards_[i].data_.gvas_[id] = it->second;
+                }
+
+                locks.clear();
 
                 LAGAS_(info).format(
                     "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -293,7 +381,7 @@ namespace hpx { namespace agas { namespace server {
                 if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -302,7 +390,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
@@ -310,7 +398,7 @@ namespace hpx { namespace agas { namespace server {
             if ((it->first + it->second.first.count) > id)
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::bind_gid",
@@ -334,7 +422,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(internal_server_error,
                 "primary_namespace::bind_gid",
@@ -343,7 +431,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
                 "attempt to insert a GVA with an invalid type, "
@@ -351,19 +439,23 @@ namespace hpx { namespace agas { namespace server {
                 id, g, locality);
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+        // Insert a GID -> GVA entry into the GVA tables.
+        for (std::size_t i : indices)
         {
-            l.unlock();
+            gva_table_type& shard_gvas = shards_[i].data_.gvas_;
+            if (HPX_UNLIKELY(!util::insert_checked(shard_gvas.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
+            {
+                locks.clear();
 
-            HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
-                id, g, locality);
+                HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
+                    "GVA table insertion failed due to a locking error or "
+                    "memory corruption, gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
+            }
         }
 
-        l.unlock();
+        locks.clear();
 
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -384,7 +476,7 @@ namespace hpx { namespace agas { namespace server {
         resolved_type r;
 
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            std::unique_lock<mutex_type> l = lock_shard(id);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
@@ -430,15 +522,17 @@ namespace hpx { namespace agas { namespace server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        std::vector<std::size_t> const indices = get_shard_indices(id, count);
+        std::vector<std::unique_lock<mutex_type>> locks = lock_shards(indices);
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        gva_table_type& gvas = get_shard(id).gvas_;
+        gva_table_type::iterator it = gvas.find(id), end = gvas.end();
 
         if (it != end)
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::unbind_gid", "block sizes must match");
@@ -446,9 +540,12 @@ namespace hpx { namespace agas { namespace server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            for (std::size_t i : indices)
+            {
+                shards_[i].data_.gvas_.erase(id);
+            }
 
-            l.unlock();
+            locks.clear();
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
@@ -475,7 +572,7 @@ namespace hpx { namespace agas { namespace server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
-        l.unlock();
+        locks.clear();
 
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
@@ -560,6 +657,48 @@ namespace hpx { namespace agas { namespace server {
         return res_credits;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<bool> primary_namespace::bind_gids(
+        std::vector<bind_gid_request_type> const& requests)
+    {
+        std::vector<bool> result;
+        result.reserve(requests.size());
+
+        for (auto const& req : requests)
+        {
+            result.push_back(bind_gid(
+                hpx::get<0>(req), hpx::get<1>(req), hpx::get<2>(req)));
+        }
+        return result;
+    }
+
+    std::vector<naming::address> primary_namespace::unbind_gids(
+        std::vector<unbind_gid_request_type> const& requests)
+    {
+        std::vector<naming::address> result;
+        result.reserve(requests.size());
+
+        for (auto const& req : requests)
+        {
+            result.push_back(unbind_gid(hpx::get<0>(req), hpx::get<1>(req)));
+        }
+        return result;
+    }
+
+    std::vector<std::int64_t> primary_namespace::increment_credits(
+        std::vector<credit_request_type> const& requests)
+    {
+        std::vector<std::int64_t> result;
+        result.reserve(requests.size());
+
+        for (auto const& req : requests)
+        {
+            result.push_back(increment_credit(
+                hpx::get<0>(req), hpx::get<1>(req), hpx::get<2>(req)));
+        }
+        return result;
+    }
+
     std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
         std::uint64_t count)
     {    // {{{ allocate implementation
@@ -623,15 +762,28 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
+    void primary_namespace::dump_refcnt_matches(naming::gid_type const& lower,
         naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
         const char* func_name)
     {    // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        refcnt_table_type& refcnts = get_shard(lower).refcnts_;
+
+        // Find the mappings that we're about to touch.
+        refcnt_table_type::iterator lower_it = refcnts.find(lower);
+        refcnt_table_type::iterator upper_it;
+        if (lower != upper)
+        {
+            upper_it = refcnts.find(upper);
+        }
+        else
+        {
+            upper_it = lower_it;
+            ++upper_it;
+        }
+
+        if (lower_it == refcnts.end() && upper_it == refcnts.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -657,28 +809,12 @@ namespace hpx { namespace agas { namespace server {
     void primary_namespace::increment(naming::gid_type const& lower,
         naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
         {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
+            std::unique_lock<mutex_type> l = lock_shard(lower);
+            dump_refcnt_matches(
+                lower, upper, l, "primary_namespace::increment");
         }
 #endif
 
@@ -692,38 +828,50 @@ namespace hpx { namespace agas { namespace server {
         // allocate/bind them, so if a GID is not in the refcnt table, we know that
         // it's global reference count is the initial global reference count.
 
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        // Each gid is counted in its own shard. Consecutive gids belonging
+        // to the same block share their shard, its lock is acquired only
+        // once for all of them.
+        naming::gid_type raw = lower;
+        while (raw != upper)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
-            {
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+            shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
+            do
+            {
+                refcnt_table_type::iterator it = s.refcnts_.find(raw);
+                if (it == s.refcnts_.end())
                 {
-                    l.unlock();
+                    std::int64_t count =
+                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
-                    HPX_THROWS_IF(ec, invalid_data,
-                        "primary_namespace::increment",
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count);
-                    return;
+                    std::pair<refcnt_table_type::iterator, bool> p =
+                        s.refcnts_.emplace(raw, count);
+                    if (!p.second)
+                    {
+                        l.unlock();
+
+                        HPX_THROWS_IF(ec, invalid_data,
+                            "primary_namespace::increment",
+                            "couldn't create entry in reference count table, "
+                            "raw({1}), ref-count({2})",
+                            raw, count);
+                        return;
+                    }
+
+                    it = p.first;
+                }
+                else
+                {
+                    it->second += credits;
                 }
 
-                it = p.first;
-            }
-            else
-            {
-                it->second += credits;
-            }
+                LAGAS_(info).format(
+                    "primary_namespace::increment, raw({1}), refcnt({2})",
+                    raw, it->second);
 
-            LAGAS_(info).format(
-                "primary_namespace::increment, raw({1}), refcnt({2})", lower,
-                it->second);
+                ++raw;
+            } while (raw != upper && &get_shard(raw) == &s);
         }
 
         if (&ec != &throws)
@@ -731,91 +879,80 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
-        free_entry_list_type& free_entry_list,
-        naming::gid_type const& /* lower */,
-        naming::gid_type const& /* upper */, error_code& ec)
+    void primary_namespace::resolve_free_entry(std::unique_lock<mutex_type>& l,
+        naming::gid_type const& gid, free_entry_list_type& free_entry_list,
+        error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(l);
 
         using hpx::get;
 
-        typedef refcnt_table_type::iterator iterator;
-
-        for (iterator const& it : free_list)
+        if (naming::detail::is_migratable(gid))
         {
-            typedef refcnt_table_type::key_type key_type;
+            // wait for any migration to be completed
+            wait_for_migration_locked(l, gid, ec);
+        }
 
-            // The mapping's key space.
-            key_type gid = it->first;
+        // Resolve the query GID.
+        resolved_type r = resolve_gid_locked(l, gid, ec);
+        if (ec)
+            return;
 
-            if (naming::detail::is_migratable(gid))
-            {
-                // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-            }
+        naming::gid_type& raw = get<0>(r);
+        if (raw == naming::invalid_gid)
+        {
+            l.unlock();
 
-            // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
-            if (ec)
-                return;
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "primary_namespace::resolve_free_entry, failed to resolve "
+                "gid, gid({1})",
+                gid);
+            return;    // couldn't resolve this one
+        }
 
-            naming::gid_type& raw = get<0>(r);
-            if (raw == naming::invalid_gid)
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "primary_namespace::resolve_free_list, failed to resolve "
-                    "gid, gid({1})",
-                    gid);
-                return;    // couldn't resolve this one
-            }
+        // Make sure the GVA is valid.
+        gva& g = get<1>(r);
 
-            // Make sure the GVA is valid.
-            gva& g = get<1>(r);
+        // REVIEW: Should we do more to make sure the GVA is valid?
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
+        {
+            l.unlock();
 
-            // REVIEW: Should we do more to make sure the GVA is valid?
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with an invalid type while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
-            else if (HPX_UNLIKELY(0 == g.count))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with a count of zero while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "encountered a GVA with an invalid type while performing a "
+                "decrement, gid({1}), gva({2})",
+                gid, g);
+            return;
+        }
+        else if (HPX_UNLIKELY(0 == g.count))
+        {
+            l.unlock();
 
-            LAGAS_(info).format(
-                "primary_namespace::resolve_free_list, resolved match, "
-                "gid({1}), gva({2})",
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "encountered a GVA with a count of zero while performing a "
+                "decrement, gid({1}), gva({2})",
                 gid, g);
+            return;
+        }
+
+        LAGAS_(info).format(
+            "primary_namespace::resolve_free_entry, resolved match, "
+            "gid({1}), gva({2})",
+            gid, g);
 
-            // Fully resolve the range.
-            gva const resolved = g.resolve(gid, raw);
+        // Fully resolve the range.
+        gva const resolved = g.resolve(gid, raw);
 
-            // Add the information needed to destroy these components to the
-            // free list.
-            free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
+        // Add the information needed to destroy these components to the
+        // free list.
+        free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
-            // remove this entry from the refcnt table
-            refcnts_.erase(it);
-        }
+        // remove this entry from the refcnt table, waiting for a migration
+        // may have released the lock in between, so erase it by key
+        get_shard(gid).refcnts_.erase(gid);
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -830,46 +967,38 @@ namespace hpx { namespace agas { namespace server {
 
         free_entry_list.clear();
 
-        {
-            std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
-
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
-
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
+        if (LAGAS_ENABLED(debug))
+        {
+            std::unique_lock<mutex_type> l = lock_shard(lower);
+            dump_refcnt_matches(
+                lower, upper, l, "primary_namespace::decrement_sweep");
+        }
 #endif
 
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
+        ///////////////////////////////////////////////////////////////////////
+        // Apply the decrement across the entire key space (e.g. [lower, upper]).
+
+        // The third parameter we pass here is the default data to use in case
+        // the key is not mapped. We don't insert GIDs into the refcnt table
+        // when we allocate/bind them, so if a GID is not in the refcnt table,
+        // we know that it's global reference count is the initial global
+        // reference count.
+
+        // Each gid is counted (and resolved, if it has to be freed) under the
+        // lock of its own shard only. Consecutive gids belonging to the same
+        // block share their shard, its lock is acquired only once for all of
+        // them.
+        naming::gid_type raw = lower;
+        while (raw != upper)
+        {
+            shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
-            std::list<refcnt_table_type::iterator> free_list;
-            for (naming::gid_type raw = lower; raw != upper; ++raw)
+            do
             {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                refcnt_table_type::iterator it = s.refcnts_.find(raw);
+                if (it == s.refcnts_.end())
                 {
                     if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                     {
@@ -888,8 +1017,7 @@ namespace hpx { namespace agas { namespace server {
                         std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
                     std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
-                            refcnt_table_type::value_type(raw, count));
+                        s.refcnts_.emplace(raw, count);
                     if (!p.second)
                     {
                         l.unlock();
@@ -922,15 +1050,17 @@ namespace hpx { namespace agas { namespace server {
                     return;
                 }
 
-                // this objects needs to be deleted
+                // this objects needs to be deleted, resolve it
                 if (it->second == 0)
-                    free_list.push_back(it);
-            }
-
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+                {
+                    resolve_free_entry(l, raw, free_entry_list, ec);
+                    if (ec)
+                        return;
+                }
 
-        }    // Unlock the mutex.
+                ++raw;
+            } while (raw != upper && &get_shard(raw) == &s);
+        }
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -1012,8 +1142,9 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
+        gva_table_type const& gvas = get_shard(id).gvas_;
+        gva_table_type::const_iterator it = gvas.lower_bound(id),
+                                       begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -1057,7 +1188,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
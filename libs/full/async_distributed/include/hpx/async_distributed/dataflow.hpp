@@ -9,7 +9,6 @@
 #include <hpx/config.hpp>
 #include <hpx/actions_base/basic_action_fwd.hpp>
 #include <hpx/actions_base/traits/extract_action.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_base/traits/is_launch_policy.hpp>
 #include <hpx/async_local/dataflow.hpp>
@@ -19,6 +18,7 @@
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke_fused.hpp>
 #include <hpx/functional/traits/is_action.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/futures/detail/future_transforms.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
@@ -132,11 +132,11 @@ namespace hpx {
             typename std::enable_if<traits::is_action<Action>::value>::type>
     HPX_FORCEINLINE auto dataflow(T0&& t0, Ts&&... ts)
         -> decltype(lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T0, t0),
+            lcos::detail::future_data_pool_allocator<>{}, HPX_FORWARD(T0, t0),
             HPX_FORWARD(Ts, ts)...))
     {
         return lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T0, t0),
+            lcos::detail::future_data_pool_allocator<>{}, HPX_FORWARD(T0, t0),
             HPX_FORWARD(Ts, ts)...);
     }
 
@@ -0,0 +1,211 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the save_checkpoint_file function and the
+/// mapped_checkpoint type. Save_checkpoint_file serializes one or more objects
+/// directly into a file without collecting the byte stream in memory first.
+/// A mapped_checkpoint maps such a file into memory, which allows to restore
+/// the objects without reading the whole file up front.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_client.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint/detail/checkpoint_file_writer.hpp>
+#include <hpx/checkpoint/mapped_checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/is_future.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/type_support/unwrap_ref.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // Objects passed as lvalues are referenced by the dataflow instead of
+        // being copied, this avoids holding a second copy of the state in
+        // memory while it is written.
+        template <typename T>
+        decltype(auto) prepare_file_arg(T&& t)
+        {
+            using type = std::decay_t<T>;
+            if constexpr (std::is_lvalue_reference_v<T> &&
+                !hpx::traits::is_future_v<type> &&
+                !hpx::traits::is_client_v<type>)
+            {
+                return std::cref(t);
+            }
+            else
+            {
+                return prepare_client(HPX_FORWARD(T, t));
+            }
+        }
+
+        struct save_file_funct_obj
+        {
+            template <typename... Ts>
+            std::size_t operator()(std::string const& filename,
+                checkpoint_file_options const& options, Ts&&... ts) const
+            {
+                checkpoint_file_writer writer(filename, options);
+                {
+                    hpx::serialization::output_archive ar(
+                        writer, 0U, writer.chunks());
+
+                    // force check-pointing flag to be created in the archive,
+                    // the serialization of id_type's checks for it
+                    ar.get_extra_data<checkpointing_tag>();
+
+                    int const sequencer[] = {
+                        0, (ar << hpx::util::unwrap_ref(ts), 0)...};
+                    (void) sequencer;    // Suppress unused param. warnings
+                }
+                return writer.finish();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file
+    ///
+    /// \tparam T            Containers passed to save_checkpoint_file to be
+    ///                      serialized into the file.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_file
+    ///                      to be serialized into the file.
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///                      An existing file is overwritten.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// Save_checkpoint_file serializes the given objects directly into a
+    /// file. The data is not collected in memory first: it is serialized
+    /// into one of two buffers while the other one is being written, and
+    /// large arrays are written straight from the memory of the objects. The
+    /// file has the same format as a checkpoint written using operator<<, it
+    /// can be read either using operator>> or through a mapped_checkpoint.
+    ///
+    /// \note Objects passed as lvalues are not copied, they must not be
+    ///       modified or destroyed before the returned future becomes ready.
+    ///
+    /// \returns Save_checkpoint_file returns a future to the number of bytes
+    ///          written to the file.
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            !std::is_same<typename std::decay<T>::type,
+                checkpoint_file_options>::value>::type>
+    hpx::future<std::size_t> save_checkpoint_file(
+        std::string const& filename, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_file_funct_obj{}, filename,
+            checkpoint_file_options{},
+            detail::prepare_file_arg(HPX_FORWARD(T, t)),
+            detail::prepare_file_arg(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file - Use the given options
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///
+    /// \param options       Options controlling the buffering of the data.
+    ///
+    /// \param ts            The containers to save.
+    ///
+    /// \returns Save_checkpoint_file returns a future to the number of bytes
+    ///          written to the file.
+    template <typename... Ts>
+    hpx::future<std::size_t> save_checkpoint_file(std::string const& filename,
+        checkpoint_file_options const& options, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_file_funct_obj{}, filename, options,
+            detail::prepare_file_arg(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file - Sync_policy
+    ///
+    /// \param sync_p        hpx::launch::sync
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// \returns Save_checkpoint_file returns the number of bytes written to
+    ///          the file.
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            !std::is_same<typename std::decay<T>::type,
+                checkpoint_file_options>::value>::type>
+    std::size_t save_checkpoint_file(hpx::launch::sync_policy sync_p,
+        std::string const& filename, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(sync_p, detail::save_file_funct_obj{}, filename,
+            checkpoint_file_options{},
+            detail::prepare_file_arg(HPX_FORWARD(T, t)),
+            detail::prepare_file_arg(HPX_FORWARD(Ts, ts))...)
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file - Sync_policy, use the given options
+    ///
+    /// \param sync_p        hpx::launch::sync
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///
+    /// \param options       Options controlling the buffering of the data.
+    ///
+    /// \param ts            The containers to save.
+    ///
+    /// \returns Save_checkpoint_file returns the number of bytes written to
+    ///          the file.
+    template <typename... Ts>
+    std::size_t save_checkpoint_file(hpx::launch::sync_policy sync_p,
+        std::string const& filename, checkpoint_file_options const& options,
+        Ts&&... ts)
+    {
+        return hpx::dataflow(sync_p, detail::save_file_funct_obj{}, filename,
+            options, detail::prepare_file_arg(HPX_FORWARD(Ts, ts))...)
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint - Read from a mapped file
+    ///
+    /// \param c             The mapped_checkpoint to restore from.
+    ///
+    /// \param t             A container to restore.
+    ///
+    /// \param ts            Other containers to restore. Containers
+    ///                      must be in the same order that they were
+    ///                      inserted into the checkpoint.
+    ///
+    /// Restore_checkpoint deserializes the objects directly from the memory
+    /// mapped file.
+    template <typename T, typename... Ts>
+    void restore_checkpoint(mapped_checkpoint const& c, T& t, Ts&... ts)
+    {
+        hpx::util::restore_checkpoint_data_func(
+            c, detail::restore_impl{}, t, ts...);
+    }
+}}    // namespace hpx::util
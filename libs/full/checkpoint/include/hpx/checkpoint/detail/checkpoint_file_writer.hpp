@@ -0,0 +1,135 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Options controlling how save_checkpoint_file writes a checkpoint
+    struct checkpoint_file_options
+    {
+        /// The size of the two buffers the serialized data is collected in.
+        /// While the contents of one buffer are written to the file, the
+        /// next part of the data is serialized into the other one.
+        std::size_t buffer_size = 16 * 1024 * 1024;
+
+        /// Bypass the page cache of the operating system (O_DIRECT), if
+        /// supported by the file system. Large arrays are copied into the
+        /// (aligned) buffers in this case instead of being written directly
+        /// from the memory of the objects being saved.
+        bool direct_io = false;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container writing the data of an archive to a file.
+        // Large arrays are recorded by the archive as pointer chunks, those
+        // are written directly from the memory of the serialized objects.
+        class HPX_EXPORT checkpoint_file_writer
+        {
+        public:
+            checkpoint_file_writer(std::string const& filename,
+                checkpoint_file_options const& options);
+            ~checkpoint_file_writer();
+
+            checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+            checkpoint_file_writer& operator=(
+                checkpoint_file_writer const&) = delete;
+
+            // the chunks to be filled by the serialization archive, this is
+            // nullptr if all data has to go through the buffers
+            std::vector<serialization::serialization_chunk>* chunks() noexcept
+            {
+                return direct_io_ ? nullptr : &chunks_;
+            }
+
+            // number of bytes handed to the writer by the archive
+            std::size_t size() const noexcept
+            {
+                return archive_size_;
+            }
+
+            void write(void const* address, std::size_t count)
+            {
+                // pointer chunks recorded since the last call precede the
+                // new data
+                if (chunks_.size() != chunks_seen_)
+                {
+                    write_chunks();
+                }
+
+                archive_size_ += count;
+                if (count <= capacity_ - used_)
+                {
+                    std::memcpy(buffer_ + used_, address, count);
+                    used_ += count;
+                    return;
+                }
+                write_overflow(static_cast<char const*>(address), count);
+            }
+
+            // write all outstanding data and the header of the file, returns
+            // the size of the file
+            std::size_t finish();
+
+        private:
+            struct file;
+
+            void write_chunks();
+            void write_overflow(char const* address, std::size_t count);
+            void add_segment(void const* address, std::size_t count);
+            void submit();
+
+            std::unique_ptr<file> file_;
+            bool direct_io_;
+
+            char* buffer_ = nullptr;    // the buffer currently being filled
+            std::size_t capacity_ = 0;
+            std::size_t used_ = 0;
+            std::size_t submitted_ = 0;    // start of data not yet submitted
+
+            std::size_t archive_size_ = 0;
+            std::vector<serialization::serialization_chunk> chunks_;
+            std::size_t chunks_seen_ = 0;
+        };
+    }    // namespace detail
+}}    // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_file_writer>
+      : default_serialization_access_data<util::detail::checkpoint_file_writer>
+    {
+        using writer_type = util::detail::checkpoint_file_writer;
+
+        static std::size_t size(writer_type const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        // the writer grows while data is written
+        static constexpr void resize(writer_type&, std::size_t) noexcept {}
+
+        static void write(writer_type& cont, std::size_t count,
+            std::size_t /* current */, void const* address)
+        {
+            cont.write(address, count);
+        }
+    };
+}}    // namespace hpx::traits
@@ -0,0 +1,76 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint/mapped_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Mapped_checkpoint
+    ///
+    /// A read-only view of a checkpoint stored in a file (as written by
+    /// save_checkpoint_file or operator<<). The file is mapped into memory,
+    /// the objects are deserialized directly from the mapping and only the
+    /// parts of the file that are accessed are read.
+    class HPX_EXPORT mapped_checkpoint
+    {
+    public:
+        explicit mapped_checkpoint(std::string const& filename);
+        ~mapped_checkpoint();
+
+        mapped_checkpoint(mapped_checkpoint&& rhs) noexcept;
+        mapped_checkpoint& operator=(mapped_checkpoint&& rhs) noexcept;
+
+        mapped_checkpoint(mapped_checkpoint const&) = delete;
+        mapped_checkpoint& operator=(mapped_checkpoint const&) = delete;
+
+        using const_iterator = char const*;
+
+        const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+        const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        char const& operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+    private:
+        void release() noexcept;
+
+        void* mapping_ = nullptr;
+        std::size_t mapping_size_ = 0;
+
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+
+        // holds the data on platforms without support for memory mapping
+        std::vector<char> buffer_;
+    };
+}}    // namespace hpx::util
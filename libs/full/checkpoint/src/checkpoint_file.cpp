@@ -0,0 +1,572 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/detail/checkpoint_file_writer.hpp>
+#include <hpx/checkpoint/mapped_checkpoint.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <cstdio>
+#include <fstream>
+#else
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // O_DIRECT requires the buffers, the sizes, and the file offsets of
+        // all writes to be aligned
+        constexpr std::size_t checkpoint_file_alignment = 4096;
+
+        // the size of the checkpoint precedes the data in the file
+        constexpr std::size_t checkpoint_file_header = sizeof(std::int64_t);
+
+        [[noreturn]] static void throw_checkpoint_file_error(
+            char const* function, char const* what, std::string const& filename)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error, function,
+                hpx::util::format(
+                    "{} '{}': {}", what, filename, std::strerror(errno)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct checkpoint_file_writer::file
+        {
+            struct segment
+            {
+                void const* data;
+                std::size_t size;
+            };
+
+            file(std::string const& filename, bool& direct_io)
+              : filename_(filename)
+            {
+#if defined(HPX_WINDOWS)
+                direct_io = false;
+                handle_ = std::fopen(filename_.c_str(), "wb");
+                if (handle_ == nullptr)
+                {
+                    throw_checkpoint_file_error(
+                        "hpx::util::save_checkpoint_file",
+                        "could not open file", filename_);
+                }
+#else
+                int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#if defined(O_DIRECT)
+                if (direct_io)
+                {
+                    handle_ = ::open(filename_.c_str(), flags | O_DIRECT, 0644);
+
+                    // not all file systems support O_DIRECT, fall back to
+                    // using the page cache
+                    if (handle_ < 0 && errno != EINVAL)
+                    {
+                        throw_checkpoint_file_error(
+                            "hpx::util::save_checkpoint_file",
+                            "could not open file", filename_);
+                    }
+                }
+#endif
+                if (handle_ < 0)
+                {
+                    direct_io = false;
+                    handle_ = ::open(filename_.c_str(), flags, 0644);
+                    if (handle_ < 0)
+                    {
+                        throw_checkpoint_file_error(
+                            "hpx::util::save_checkpoint_file",
+                            "could not open file", filename_);
+                    }
+                }
+#endif
+                direct_io_ = direct_io;
+            }
+
+            ~file()
+            {
+                if (pending_.valid())
+                {
+                    pending_.wait();
+                }
+                close();
+
+                __aligned_free(buffers_[0]);
+                __aligned_free(buffers_[1]);
+            }
+
+            void add(void const* data, std::size_t size)
+            {
+                segments_.push_back(segment{data, size});
+                total_ += size;
+            }
+
+            // write the given segments one after the other at the current
+            // position of the file
+            void write_segments(std::vector<segment> const& segments)
+            {
+#if defined(HPX_WINDOWS)
+                for (segment const& s : segments)
+                {
+                    if (std::fwrite(s.data, 1, s.size, handle_) != s.size)
+                    {
+                        throw_checkpoint_file_error(
+                            "hpx::util::save_checkpoint_file",
+                            "could not write to file", filename_);
+                    }
+                }
+#else
+#if defined(IOV_MAX)
+                constexpr std::size_t max_iov = IOV_MAX;
+#else
+                constexpr std::size_t max_iov = 1024;
+#endif
+                std::vector<iovec> iov;
+                iov.reserve(segments.size());
+                for (segment const& s : segments)
+                {
+                    iov.push_back(iovec{const_cast<void*>(s.data), s.size});
+                }
+
+                std::size_t first = 0;
+                while (first != iov.size())
+                {
+                    std::size_t const count =
+                        (std::min)(iov.size() - first, max_iov);
+                    ssize_t written =
+                        ::writev(handle_, &iov[first], static_cast<int>(count));
+                    if (written <= 0)
+                    {
+                        if (written < 0 && errno == EINTR)
+                        {
+                            continue;
+                        }
+                        throw_checkpoint_file_error(
+                            "hpx::util::save_checkpoint_file",
+                            "could not write to file", filename_);
+                    }
+
+                    // skip the segments written completely and continue with
+                    // the remainder of a partially written one
+                    std::size_t remaining = static_cast<std::size_t>(written);
+                    while (first != iov.size() &&
+                        remaining >= iov[first].iov_len)
+                    {
+                        remaining -= iov[first].iov_len;
+                        ++first;
+                    }
+                    if (remaining != 0)
+                    {
+                        iov[first].iov_base =
+                            static_cast<char*>(iov[first].iov_base) + remaining;
+                        iov[first].iov_len -= remaining;
+                    }
+                }
+#endif
+            }
+
+            // hand the collected segments to an OS thread, the write
+            // overlaps with serializing the next part of the data
+            void launch()
+            {
+                HPX_ASSERT(!pending_.valid());
+                if (segments_.empty())
+                {
+                    return;
+                }
+
+                std::vector<segment> segments;
+                segments.swap(segments_);
+
+                if (threads::get_self_ptr() == nullptr)
+                {
+                    write_segments(segments);
+                    return;
+                }
+
+                pending_ = threads::run_as_os_thread(
+                    [this, segments = std::move(segments)]() {
+                        write_segments(segments);
+                    });
+            }
+
+            // wait for the outstanding write, rethrows its errors
+            void wait()
+            {
+                if (pending_.valid())
+                {
+                    pending_.get();
+                }
+            }
+
+            void write_header(std::int64_t size)
+            {
+#if defined(HPX_WINDOWS)
+                if (std::fseek(handle_, 0, SEEK_SET) != 0 ||
+                    std::fwrite(&size, sizeof(size), 1, handle_) != 1)
+                {
+                    throw_checkpoint_file_error(
+                        "hpx::util::save_checkpoint_file",
+                        "could not write to file", filename_);
+                }
+#else
+                if (::pwrite(handle_, &size, sizeof(size), 0) !=
+                    static_cast<ssize_t>(sizeof(size)))
+                {
+                    throw_checkpoint_file_error(
+                        "hpx::util::save_checkpoint_file",
+                        "could not write to file", filename_);
+                }
+#endif
+            }
+
+            void disable_direct_io()
+            {
+#if !defined(HPX_WINDOWS) && defined(O_DIRECT)
+                if (direct_io_)
+                {
+                    int flags = ::fcntl(handle_, F_GETFL);
+                    if (flags < 0 ||
+                        ::fcntl(handle_, F_SETFL, flags & ~O_DIRECT) < 0)
+                    {
+                        throw_checkpoint_file_error(
+                            "hpx::util::save_checkpoint_file",
+                            "could not reset O_DIRECT for file", filename_);
+                    }
+                    direct_io_ = false;
+                }
+#endif
+            }
+
+            bool close() noexcept
+            {
+#if defined(HPX_WINDOWS)
+                bool result = handle_ == nullptr || std::fclose(handle_) == 0;
+                handle_ = nullptr;
+#else
+                bool result = handle_ < 0 || ::close(handle_) == 0;
+                handle_ = -1;
+#endif
+                return result;
+            }
+
+            std::string filename_;
+#if defined(HPX_WINDOWS)
+            std::FILE* handle_ = nullptr;
+#else
+            int handle_ = -1;
+#endif
+            bool direct_io_ = false;
+
+            char* buffers_[2] = {nullptr, nullptr};
+            std::size_t current_ = 0;    // index of the buffer being filled
+
+            std::vector<segment> segments_;    // not yet submitted
+            std::size_t external_ = 0;    // bytes in pointer segments
+            std::size_t total_ = 0;    // bytes submitted so far
+
+            hpx::future<void> pending_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        checkpoint_file_writer::checkpoint_file_writer(
+            std::string const& filename, checkpoint_file_options const& options)
+          : direct_io_(options.direct_io)
+        {
+            file_.reset(new file(filename, direct_io_));
+
+            capacity_ = (std::max)(options.buffer_size,
+                checkpoint_file_alignment + checkpoint_file_header);
+            capacity_ = (capacity_ + checkpoint_file_alignment - 1) &
+                ~(checkpoint_file_alignment - 1);
+
+            for (char*& buffer : file_->buffers_)
+            {
+                buffer = static_cast<char*>(
+                    __aligned_alloc(checkpoint_file_alignment, capacity_));
+                if (buffer == nullptr)
+                {
+                    HPX_THROW_EXCEPTION(out_of_memory,
+                        "hpx::util::save_checkpoint_file",
+                        "could not allocate the buffers for writing the "
+                        "checkpoint");
+                }
+            }
+            buffer_ = file_->buffers_[0];
+
+            // reserve the space for the size of the checkpoint, this is
+            // written once all data is known
+            std::memset(buffer_, 0, checkpoint_file_header);
+            used_ = checkpoint_file_header;
+        }
+
+        checkpoint_file_writer::~checkpoint_file_writer() = default;
+
+        void checkpoint_file_writer::write_chunks()
+        {
+            for (/**/; chunks_seen_ != chunks_.size(); ++chunks_seen_)
+            {
+                serialization::serialization_chunk const& chunk =
+                    chunks_[chunks_seen_];
+
+                // index chunks describe data already written to the buffers
+                if (chunk.type_ ==
+                    serialization::chunk_type::chunk_type_pointer)
+                {
+                    add_segment(chunk.data_.cpos_, chunk.size_);
+                }
+            }
+        }
+
+        void checkpoint_file_writer::write_overflow(
+            char const* address, std::size_t count)
+        {
+            while (count != 0)
+            {
+                if (used_ == capacity_)
+                {
+                    submit();
+                }
+
+                std::size_t const n = (std::min)(count, capacity_ - used_);
+                std::memcpy(buffer_ + used_, address, n);
+
+                used_ += n;
+                address += n;
+                count -= n;
+            }
+        }
+
+        void checkpoint_file_writer::add_segment(
+            void const* address, std::size_t count)
+        {
+            // the buffered data precedes the external data in the file
+            if (used_ != submitted_)
+            {
+                file_->add(buffer_ + submitted_, used_ - submitted_);
+                submitted_ = used_;
+            }
+
+            file_->add(address, count);
+            file_->external_ += count;
+
+            if (file_->external_ >= capacity_)
+            {
+                submit();
+            }
+        }
+
+        void checkpoint_file_writer::submit()
+        {
+            if (used_ != submitted_)
+            {
+                file_->add(buffer_ + submitted_, used_ - submitted_);
+            }
+
+            // the other buffer is available once the previous write has
+            // finished
+            file_->wait();
+            file_->launch();
+            file_->external_ = 0;
+
+            file_->current_ ^= 1;
+            buffer_ = file_->buffers_[file_->current_];
+            used_ = 0;
+            submitted_ = 0;
+        }
+
+        std::size_t checkpoint_file_writer::finish()
+        {
+            write_chunks();
+            if (used_ != submitted_)
+            {
+                file_->add(buffer_ + submitted_, used_ - submitted_);
+                submitted_ = used_;
+            }
+
+            // the last part of the data is usually not aligned
+            file_->wait();
+            file_->disable_direct_io();
+
+            std::vector<file::segment> segments;
+            segments.swap(file_->segments_);
+            file_->write_segments(segments);
+
+            std::size_t const total = file_->total_;
+            file_->write_header(
+                static_cast<std::int64_t>(total - checkpoint_file_header));
+
+            if (!file_->close())
+            {
+                throw_checkpoint_file_error("hpx::util::save_checkpoint_file",
+                    "could not close file", file_->filename_);
+            }
+            return total;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_checkpoint::mapped_checkpoint(std::string const& filename)
+    {
+        char const* base = nullptr;
+#if defined(HPX_WINDOWS)
+        std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+        if (!ifs)
+        {
+            detail::throw_checkpoint_file_error("hpx::util::mapped_checkpoint",
+                "could not open file", filename);
+        }
+
+        buffer_.resize(static_cast<std::size_t>(ifs.tellg()));
+        ifs.seekg(0);
+        if (!ifs.read(buffer_.data(), buffer_.size()))
+        {
+            detail::throw_checkpoint_file_error("hpx::util::mapped_checkpoint",
+                "could not read from file", filename);
+        }
+
+        base = buffer_.data();
+        mapping_size_ = buffer_.size();
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            detail::throw_checkpoint_file_error("hpx::util::mapped_checkpoint",
+                "could not open file", filename);
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            detail::throw_checkpoint_file_error("hpx::util::mapped_checkpoint",
+                "could not stat file", filename);
+        }
+        mapping_size_ = static_cast<std::size_t>(st.st_size);
+
+        if (mapping_size_ != 0)
+        {
+            mapping_ =
+                ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        ::close(fd);
+
+        if (mapping_ == MAP_FAILED)
+        {
+            mapping_ = nullptr;
+            detail::throw_checkpoint_file_error(
+                "hpx::util::mapped_checkpoint", "could not map file", filename);
+        }
+
+        // the objects are restored front to back
+#if defined(MADV_SEQUENTIAL)
+        if (mapping_ != nullptr)
+        {
+            ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+        }
+#endif
+        base = static_cast<char const*>(mapping_);
+#endif
+
+        std::int64_t size = 0;
+        if (mapping_size_ >= detail::checkpoint_file_header)
+        {
+            std::memcpy(&size, base, sizeof(size));
+        }
+
+        if (mapping_size_ < detail::checkpoint_file_header || size < 0 ||
+            static_cast<std::uint64_t>(size) >
+                mapping_size_ - detail::checkpoint_file_header)
+        {
+            release();
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                hpx::util::format(
+                    "file '{}' does not contain a valid checkpoint", filename));
+        }
+
+        data_ = base + detail::checkpoint_file_header;
+        size_ = static_cast<std::size_t>(size);
+    }
+
+    mapped_checkpoint::mapped_checkpoint(mapped_checkpoint&& rhs) noexcept
+      : mapping_(rhs.mapping_)
+      , mapping_size_(rhs.mapping_size_)
+      , data_(rhs.data_)
+      , size_(rhs.size_)
+      , buffer_(std::move(rhs.buffer_))
+    {
+        rhs.mapping_ = nullptr;
+        rhs.mapping_size_ = 0;
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+    }
+
+    mapped_checkpoint& mapped_checkpoint::operator=(
+        mapped_checkpoint&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            release();
+
+            mapping_ = rhs.mapping_;
+            mapping_size_ = rhs.mapping_size_;
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+            buffer_ = std::move(rhs.buffer_);
+
+            rhs.mapping_ = nullptr;
+            rhs.mapping_size_ = 0;
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    mapped_checkpoint::~mapped_checkpoint()
+    {
+        release();
+    }
+
+    void mapped_checkpoint::release() noexcept
+    {
+#if !defined(HPX_WINDOWS)
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mapping_size_);
+        }
+#endif
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+        data_ = nullptr;
+        size_ = 0;
+        buffer_.clear();
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,168 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of writing a large state to a checkpoint file and of
+// restoring it, either by streaming it to the file (save_checkpoint_file and
+// mapped_checkpoint) or by collecting it in memory first (save_checkpoint and
+// operator<<). The peak resident set size is reported for the whole process,
+// run each method separately to compare them, for instance:
+//
+//     checkpoint_file_performance --state_size=16 --method=stream
+//     checkpoint_file_performance --state_size=16 --method=memory
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <sys/resource.h>
+#endif
+
+// peak resident set size of the process in MB
+double peak_rss()
+{
+#if !defined(HPX_WINDOWS)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        return static_cast<double>(usage.ru_maxrss) / (1024. * 1024.);
+#else
+        return static_cast<double>(usage.ru_maxrss) / 1024.;
+#endif
+    }
+#endif
+    return 0.;
+}
+
+void print(char const* operation, std::string const& method, double size_gb,
+    double elapsed, bool csv)
+{
+    if (csv)
+    {
+        std::cout << operation << "," << method << "," << size_gb << ","
+                  << size_gb / elapsed << "," << peak_rss() << std::endl;
+    }
+    else
+    {
+        std::cout << operation << " (" << method << ", " << size_gb
+                  << " GB): " << size_gb / elapsed << " [GB/s], peak RSS "
+                  << peak_rss() << " [MB]" << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    double const state_size = vm["state_size"].as<double>();
+    std::string const method = vm["method"].as<std::string>();
+    std::string const filename = vm["file"].as<std::string>();
+    bool const csv = vm.count("csv_output") != 0;
+
+    std::size_t const count = static_cast<std::size_t>(
+        state_size * 1024. * 1024. * 1024. / sizeof(double));
+
+    std::vector<double> state(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        state[i] = static_cast<double>(i);
+    }
+    double const size_gb =
+        static_cast<double>(count * sizeof(double)) / (1024. * 1024. * 1024.);
+
+    std::vector<double> restored;
+    if (method == "stream")
+    {
+        hpx::util::checkpoint_file_options options;
+        options.buffer_size = vm["buffer_size"].as<std::size_t>();
+        options.direct_io = vm.count("direct_io") != 0;
+
+        hpx::chrono::high_resolution_timer t;
+        hpx::util::save_checkpoint_file(
+            hpx::launch::sync, filename, options, state);
+        print("save", method, size_gb, t.elapsed(), csv);
+
+        // release the state to measure the memory needed for restoring it
+        state = std::vector<double>();
+
+        t.restart();
+        {
+            hpx::util::mapped_checkpoint c(filename);
+            hpx::util::restore_checkpoint(c, restored);
+        }
+        print("restore", method, size_gb, t.elapsed(), csv);
+    }
+    else if (method == "memory")
+    {
+        hpx::chrono::high_resolution_timer t;
+        {
+            std::ofstream ofs(filename, std::ios::binary);
+            ofs << hpx::util::save_checkpoint(hpx::launch::sync, state);
+        }
+        print("save", method, size_gb, t.elapsed(), csv);
+
+        state = std::vector<double>();
+
+        t.restart();
+        {
+            std::ifstream ifs(filename, std::ios::binary);
+            hpx::util::checkpoint c;
+            ifs >> c;
+            hpx::util::restore_checkpoint(c, restored);
+        }
+        print("restore", method, size_gb, t.elapsed(), csv);
+    }
+    else
+    {
+        std::cerr << "unknown method: " << method << std::endl;
+    }
+
+    std::remove(filename.c_str());
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("state_size",
+            value<double>()->default_value(1.0),
+            "size of the state to checkpoint in GB (default: 1)")
+        ("method",
+            value<std::string>()->default_value("stream"),
+            "stream: save_checkpoint_file and mapped_checkpoint, memory: "
+            "save_checkpoint and operator<< (default: stream)")
+        ("file",
+            value<std::string>()->default_value(
+                "checkpoint_file_performance.chk"),
+            "name of the checkpoint file")
+        ("buffer_size",
+            value<std::size_t>()->default_value(16 * 1024 * 1024),
+            "size of the buffers used for streaming (default: 16MB)")
+        ("direct_io", "bypass the page cache while streaming")
+        ("csv_output", "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
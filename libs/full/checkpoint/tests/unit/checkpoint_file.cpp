@@ -0,0 +1,167 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint_file and
+// restoring checkpoints from a mapped_checkpoint.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::checkpoint_file_options;
+using hpx::util::mapped_checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+using hpx::util::save_checkpoint_file;
+
+struct state
+{
+    char character = 'd';
+    int integer = 10;
+    float flt = 10.01f;
+    std::string str = "I am a string of characters";
+    std::vector<int> small{1, 2, 3, 4, 5};
+
+    // large enough to be written without copying it
+    std::vector<double> large = std::vector<double>(1000000);
+
+    state()
+    {
+        for (std::size_t i = 0; i != large.size(); ++i)
+        {
+            large[i] = static_cast<double>(i) * 0.5;
+        }
+    }
+};
+
+void test_restored(state const& s, mapped_checkpoint const& c)
+{
+    state r;
+    r.character = 'a';
+    r.integer = 0;
+    r.flt = 0.0f;
+    r.str.clear();
+    r.small.clear();
+    r.large.clear();
+
+    restore_checkpoint(
+        c, r.character, r.integer, r.flt, r.str, r.small, r.large, r.large);
+
+    HPX_TEST_EQ(s.character, r.character);
+    HPX_TEST_EQ(s.integer, r.integer);
+    HPX_TEST_EQ(s.flt, r.flt);
+    HPX_TEST_EQ(s.str, r.str);
+    HPX_TEST(s.small == r.small);
+    HPX_TEST(s.large == r.large);
+}
+
+void test_save_restore(
+    state const& s, checkpoint_file_options const& options, char const* name)
+{
+    // the large vector is saved twice to have data between and after it
+    hpx::future<std::size_t> f = save_checkpoint_file(name, options,
+        s.character, s.integer, s.flt, s.str, s.small, s.large, s.large);
+    std::size_t size = f.get();
+
+    mapped_checkpoint c(name);
+    HPX_TEST_EQ(c.size() + sizeof(std::int64_t), size);
+    HPX_TEST(c.size() > 2 * s.large.size() * sizeof(double));
+
+    test_restored(s, c);
+}
+
+// Main
+int main()
+{
+    state s;
+
+    // Test 1
+    //  test basic functionality
+    {
+        //[check_file_test_1
+        std::size_t size = save_checkpoint_file(hpx::launch::sync,
+            "test_file_1.chk", s.character, s.integer, s.flt, s.str, s.small,
+            s.large, s.large);
+
+        mapped_checkpoint c("test_file_1.chk");
+        //]
+
+        HPX_TEST_EQ(c.size() + sizeof(std::int64_t), size);
+        test_restored(s, c);
+        std::remove("test_file_1.chk");
+    }
+
+    // Test 2
+    //  test buffers being written while the next part is serialized
+    {
+        checkpoint_file_options options;
+        options.buffer_size = 1024;
+        test_save_restore(s, options, "test_file_2.chk");
+        std::remove("test_file_2.chk");
+    }
+
+    // Test 3
+    //  test bypassing the page cache (if supported)
+    {
+        checkpoint_file_options options;
+        options.buffer_size = 64 * 1024;
+        options.direct_io = true;
+        test_save_restore(s, options, "test_file_3.chk");
+        std::remove("test_file_3.chk");
+    }
+
+    // Test 4
+    //  test the file format being compatible with operator<< and operator>>
+    {
+        save_checkpoint_file(hpx::launch::sync, "test_file_4.chk", s.character,
+            s.integer, s.flt, s.str, s.small, s.large, s.large);
+
+        std::ifstream ifs("test_file_4.chk", std::ios::binary);
+        checkpoint archive;
+        ifs >> archive;
+        ifs.close();
+
+        state r;
+        restore_checkpoint(archive, r.character, r.integer, r.flt, r.str,
+            r.small, r.large, r.large);
+        HPX_TEST_EQ(s.str, r.str);
+        HPX_TEST(s.large == r.large);
+
+        std::ofstream ofs("test_file_4.chk", std::ios::binary);
+        ofs << save_checkpoint(hpx::launch::sync, s.character, s.integer,
+            s.flt, s.str, s.small, s.large, s.large);
+        ofs.close();
+
+        mapped_checkpoint c("test_file_4.chk");
+        HPX_TEST_EQ(c.size(), archive.size());
+        test_restored(s, c);
+        std::remove("test_file_4.chk");
+    }
+
+    // Test 5
+    //  test reading files not containing a checkpoint
+    {
+        std::ofstream ofs("test_file_5.chk", std::ios::binary);
+        ofs << "abc";
+        ofs.close();
+
+        HPX_TEST_THROW(mapped_checkpoint("test_file_5.chk"), hpx::exception);
+        HPX_TEST_THROW(mapped_checkpoint("test_file_6.chk"), hpx::exception);
+        std::remove("test_file_5.chk");
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file delta_tracker.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_delta
+    ///
+    /// The blocks of a contiguous range of bytes which have changed since the
+    /// previous checkpoint_delta was created for the same range. A delta with
+    /// the generation zero contains all blocks of the range. All other deltas
+    /// can be applied only on top of the delta with the preceding generation.
+    struct checkpoint_delta
+    {
+        std::uint64_t generation = 0;
+        std::uint64_t size = 0;          // size of the whole range (bytes)
+        std::uint64_t block_size = 0;    // the last block may be shorter
+
+        // The indices of the blocks contained in this delta, followed by the
+        // contents of these blocks
+        std::vector<std::uint64_t> blocks;
+        std::vector<char> data;
+
+        bool is_full() const noexcept
+        {
+            return generation == 0;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & generation & size & block_size & blocks & data;
+            // clang-format on
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// delta_tracker
+    ///
+    /// Records a hash of each block of a range of bytes whenever a delta of
+    /// the range is created or applied. The next delta contains only the
+    /// blocks whose hash has changed since. As the hashes are computed from
+    /// the data itself, any modification of the range is detected, regardless
+    /// of how it was done.
+    ///
+    /// \note The blocks are compared by their 64-bit hash only. A modified
+    ///       block whose hash collides with the recorded one is not included
+    ///       in the next delta. The probability of this is about 2^-64 per
+    ///       modified block, which is far below the rate of undetected memory
+    ///       or transmission errors. Applications which can not accept this
+    ///       have to create deltas containing all blocks (by calling
+    ///       \a reset before \a save).
+    ///
+    /// A delta_tracker is not thread safe, concurrent calls to \a save,
+    /// \a restore or \a reset have to be synchronized by the caller.
+    class HPX_EXPORT delta_tracker
+    {
+    public:
+        static constexpr std::size_t default_block_size = 64 * 1024;
+
+        explicit delta_tracker(
+            std::size_t block_size = default_block_size) noexcept;
+
+        std::size_t block_size() const noexcept
+        {
+            return block_size_;
+        }
+
+        /// The generation of the next delta created by this tracker
+        std::uint64_t generation() const noexcept
+        {
+            return generation_;
+        }
+
+        /// Create the delta of the given range relative to the range seen by
+        /// the previous call to save or restore. The first delta, and the
+        /// first one after the size of the range has changed, contains all
+        /// blocks.
+        checkpoint_delta save(void const* data, std::size_t size);
+
+        template <typename T, typename Allocator>
+        checkpoint_delta save(std::vector<T, Allocator> const& v)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                "the elements of the vector have to be trivially copyable");
+            return save(v.data(), v.size() * sizeof(T));
+        }
+
+        /// Apply the given delta to the range. The range has to hold the data
+        /// the delta was created from (unless the delta contains all
+        /// blocks), its size has to match the size stored in the delta.
+        void restore(
+            checkpoint_delta const& delta, void* data, std::size_t size);
+
+        template <typename T, typename Allocator>
+        void restore(
+            checkpoint_delta const& delta, std::vector<T, Allocator>& v)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                "the elements of the vector have to be trivially copyable");
+            if (delta.is_full())
+            {
+                v.resize(static_cast<std::size_t>(delta.size / sizeof(T)));
+            }
+            restore(delta, v.data(), v.size() * sizeof(T));
+        }
+
+        /// Forget the recorded hashes, the next delta will contain all blocks
+        void reset() noexcept;
+
+    private:
+        std::size_t block_size_;
+        std::uint64_t generation_ = 0;
+        std::size_t size_ = 0;
+        std::vector<std::uint64_t> hashes_;
+    };
+}}    // namespace hpx::util
@@ -0,0 +1,166 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint_base/delta_tracker.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace {
+
+        constexpr std::uint64_t hash_multiplier = 0x9e3779b97f4a7c15ull;
+
+        inline std::uint64_t mix(std::uint64_t h) noexcept
+        {
+            h ^= h >> 31;
+            h *= 0xbf58476d1ce4e5b9ull;
+            h ^= h >> 29;
+            return h;
+        }
+
+        // A simple multiplicative hash over four independent lanes, which
+        // keeps up with the memory bandwidth of a single core.
+        std::uint64_t hash_block(char const* data, std::size_t size) noexcept
+        {
+            std::uint64_t lanes[4] = {size, hash_multiplier, ~size, 0};
+
+            std::size_t i = 0;
+            for (/**/; i + 32 <= size; i += 32)
+            {
+                for (std::size_t lane = 0; lane != 4; ++lane)
+                {
+                    std::uint64_t word;
+                    std::memcpy(&word, data + i + 8 * lane, sizeof(word));
+                    lanes[lane] = (lanes[lane] ^ word) * hash_multiplier;
+                    lanes[lane] ^= lanes[lane] >> 32;
+                }
+            }
+
+            std::uint64_t h = lanes[0] ^ mix(lanes[1]) ^ mix(mix(lanes[2])) ^
+                (lanes[3] * hash_multiplier);
+            for (/**/; i != size; ++i)
+            {
+                h = (h ^ static_cast<unsigned char>(data[i])) * hash_multiplier;
+            }
+            return mix(h);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    delta_tracker::delta_tracker(std::size_t block_size) noexcept
+      : block_size_(block_size != 0 ? block_size : default_block_size)
+    {
+    }
+
+    void delta_tracker::reset() noexcept
+    {
+        generation_ = 0;
+        size_ = 0;
+        hashes_.clear();
+    }
+
+    checkpoint_delta delta_tracker::save(void const* data, std::size_t size)
+    {
+        char const* bytes = static_cast<char const*>(data);
+        std::size_t const num_blocks = (size + block_size_ - 1) / block_size_;
+
+        checkpoint_delta delta;
+        delta.size = size;
+        delta.block_size = block_size_;
+
+        // start over if nothing was recorded yet or if the size has changed
+        if (generation_ == 0 || size != size_)
+        {
+            generation_ = 0;
+            size_ = size;
+            hashes_.assign(num_blocks, 0);
+        }
+        delta.generation = generation_++;
+
+        for (std::size_t block = 0; block != num_blocks; ++block)
+        {
+            std::size_t const offset = block * block_size_;
+            std::size_t const count = (std::min)(block_size_, size - offset);
+
+            std::uint64_t const hash = hash_block(bytes + offset, count);
+            if (delta.is_full() || hash != hashes_[block])
+            {
+                hashes_[block] = hash;
+                delta.blocks.push_back(block);
+                delta.data.insert(
+                    delta.data.end(), bytes + offset, bytes + offset + count);
+            }
+        }
+        return delta;
+    }
+
+    void delta_tracker::restore(
+        checkpoint_delta const& delta, void* data, std::size_t size)
+    {
+        if (delta.size != size || delta.block_size == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::util::delta_tracker::restore",
+                hpx::util::format("the size of the range ({}) does not match "
+                                  "the size stored in the delta ({})",
+                    size, delta.size));
+        }
+
+        if (!delta.is_full() &&
+            (delta.generation != generation_ || size != size_ ||
+                delta.block_size != block_size_))
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::util::delta_tracker::restore",
+                hpx::util::format("the delta (generation {}) does not follow "
+                                  "the previously restored data (generation "
+                                  "{})",
+                    delta.generation, generation_));
+        }
+
+        // the blocks of the delta decide the layout of the recorded hashes
+        block_size_ = static_cast<std::size_t>(delta.block_size);
+        std::size_t const num_blocks = (size + block_size_ - 1) / block_size_;
+        if (delta.is_full())
+        {
+            size_ = size;
+            hashes_.assign(num_blocks, 0);
+        }
+
+        char* bytes = static_cast<char*>(data);
+        std::size_t pos = 0;
+        for (std::uint64_t block : delta.blocks)
+        {
+            std::size_t const offset = block * block_size_;
+            std::size_t const count = block < num_blocks ?
+                (std::min)(block_size_, size - offset) :
+                0;
+
+            if (count == 0 || delta.data.size() - pos < count)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::util::delta_tracker::restore",
+                    "the delta is corrupted");
+            }
+
+            std::memcpy(bytes + offset, delta.data.data() + pos, count);
+            hashes_[block] = hash_block(bytes + offset, count);
+            pos += count;
+        }
+        HPX_ASSERT(pos == delta.data.size());
+
+        generation_ = delta.generation + 1;
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,97 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint_base.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::util::checkpoint_delta;
+using hpx::util::delta_tracker;
+
+int main()
+{
+    std::size_t const block_size = 1024;
+    std::size_t const num_blocks = 100;
+
+    // the last block is shorter than the others
+    std::vector<std::uint32_t> data(num_blocks * block_size / 4 - 10);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = static_cast<std::uint32_t>(i);
+    }
+
+    delta_tracker saver(block_size);
+    std::vector<checkpoint_delta> deltas;
+
+    // the first delta contains all blocks
+    deltas.push_back(saver.save(data));
+    HPX_TEST(deltas.back().is_full());
+    HPX_TEST_EQ(deltas.back().blocks.size(), num_blocks);
+    HPX_TEST_EQ(deltas.back().data.size(), data.size() * sizeof(data[0]));
+
+    // nothing has changed
+    deltas.push_back(saver.save(data));
+    HPX_TEST_EQ(deltas.back().generation, std::uint64_t(1));
+    HPX_TEST(deltas.back().blocks.empty());
+
+    // modify two blocks, including the last (short) one
+    data[3 * block_size / 4] = 42;
+    data.back() = 43;
+    deltas.push_back(saver.save(data));
+    HPX_TEST_EQ(deltas.back().generation, std::uint64_t(2));
+    HPX_TEST_EQ(deltas.back().blocks.size(), std::size_t(2));
+    HPX_TEST_EQ(deltas.back().blocks[0], std::uint64_t(3));
+    HPX_TEST_EQ(deltas.back().blocks[1], std::uint64_t(num_blocks - 1));
+
+    data[0] = 44;
+    deltas.push_back(saver.save(data));
+    HPX_TEST_EQ(deltas.back().blocks.size(), std::size_t(1));
+
+    // replay the deltas after sending them through the serialization layer
+    std::vector<char> archive;
+    hpx::util::save_checkpoint_data(archive, deltas);
+
+    std::vector<checkpoint_delta> restored_deltas;
+    hpx::util::restore_checkpoint_data(archive, restored_deltas);
+    HPX_TEST_EQ(restored_deltas.size(), deltas.size());
+
+    delta_tracker restorer;
+    std::vector<std::uint32_t> restored;
+    for (checkpoint_delta const& delta : restored_deltas)
+    {
+        restorer.restore(delta, restored);
+    }
+    HPX_TEST(data == restored);
+
+    // the restored tracker continues the sequence of deltas
+    data[1] = 45;
+    checkpoint_delta next = saver.save(data);
+    restorer.restore(next, restored);
+    HPX_TEST(data == restored);
+
+    restored[2] = 46;
+    HPX_TEST_EQ(restorer.save(restored).blocks.size(), std::size_t(1));
+
+    // deltas have to be applied in sequence
+    delta_tracker other;
+    std::vector<std::uint32_t> other_data;
+    HPX_TEST_THROW(other.restore(deltas[2], other_data), hpx::exception);
+
+    other.restore(deltas[0], other_data);
+    HPX_TEST_THROW(other.restore(deltas[2], other_data), hpx::exception);
+
+    // a change of the size leads to a full delta
+    data.push_back(47);
+    HPX_TEST(saver.save(data).is_full());
+
+    return hpx::util::report_errors();
+}
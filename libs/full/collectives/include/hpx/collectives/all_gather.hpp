@@ -132,11 +132,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<std::vector<arg_type>> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, on_ready);
 
-            communicator_.gate_.synchronize(1, l);
-
             auto& data = communicator_.template access_data<arg_type>(l);
             data[which] = HPX_FORWARD(T, t);
 
@@ -69,6 +69,30 @@ namespace hpx { namespace collectives {
     hpx::future<std::decay_t<T>>
     all_reduce(communicator comm,
         T&& result, F&& op, this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a set of values from different call sites along a tree
+    ///
+    /// This function receives the result of applying the given operator on
+    /// the values supplied from all call sites of the given hierarchical
+    /// communicator. If the number of sites is a power of two, the values are
+    /// combined using recursive doubling (log2(num_sites) rounds of pairwise
+    /// exchanges), otherwise the values are reduced towards the root of the
+    /// tree and the result is broadcast back down.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator.
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///             It will become ready once the all_reduce operation has been
+    ///             completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        hierarchical_communicator const& comm, T&& local_result, F&& op);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -80,9 +104,15 @@ namespace hpx { namespace collectives {
 
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/collectives/all_gather.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/broadcast.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
+#include <hpx/collectives/reduce.hpp>
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -148,11 +178,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<arg_type> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             auto& data = communicator_.template access_data<arg_type>(l);
             data[which] = HPX_FORWARD(T, t);
 
@@ -219,6 +247,66 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_reduce plain values using a hierarchical communicator
+    namespace detail {
+
+        // In each round the partial results are exchanged with the site
+        // differing in the bit corresponding to the round.
+        template <typename T, typename F>
+        hpx::future<T> all_reduce_recursive_doubling(
+            hierarchical_communicator const& comm, std::size_t round, T value,
+            F const& op)
+        {
+            if (round == comm.num_rounds())
+            {
+                return hpx::make_ready_future(HPX_MOVE(value));
+            }
+
+            std::size_t const which = (comm.this_site() >> round) & 1;
+            return all_gather(comm.get_partner(round), HPX_MOVE(value),
+                this_site_arg(which))
+                .then(hpx::launch::sync,
+                    [comm, round, op](hpx::future<std::vector<T>>&& f) {
+                        // both partners combine the values in the same order
+                        std::vector<T> values = f.get();
+                        return all_reduce_recursive_doubling(comm, round + 1,
+                            T(HPX_INVOKE(
+                                op, HPX_MOVE(values[0]), HPX_MOVE(values[1]))),
+                            op);
+                    });
+        }
+    }    // namespace detail
+
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        hierarchical_communicator const& comm, T&& local_result, F&& op)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (comm.num_rounds() != 0)
+        {
+            return detail::all_reduce_recursive_doubling(
+                comm, 0, arg_type(HPX_FORWARD(T, local_result)), op);
+        }
+
+        // reduce towards the root and broadcast the result back down the tree
+        if (comm.is_root())
+        {
+            return reduce_here(comm, HPX_FORWARD(T, local_result), op)
+                .then(hpx::launch::sync,
+                    [comm](hpx::future<arg_type>&& f) {
+                        return broadcast_to(comm, f.get());
+                    });
+        }
+
+        return reduce_there(comm, HPX_FORWARD(T, local_result), op)
+            .then(hpx::launch::sync, [comm](hpx::future<void>&& f) {
+                f.get();    // propagate exceptions
+                return broadcast_from<arg_type>(comm);
+            });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +125,28 @@ namespace hpx { namespace collectives {
         std::size_t root_site_;
     };
 
+    struct arity_arg
+    {
+        explicit constexpr arity_arg(
+            std::size_t arity = std::size_t(-1)) noexcept
+          : arity_(arity)
+        {
+        }
+
+        constexpr arity_arg& operator=(std::size_t arity) noexcept
+        {
+            arity_ = arity;
+            return *this;
+        }
+
+        constexpr operator std::size_t() const noexcept
+        {
+            return arity_;
+        }
+
+        std::size_t arity_;
+    };
+
     struct tag_arg
     {
         explicit constexpr tag_arg(std::size_t tag = std::size_t(0)) noexcept
@@ -100,6 +100,40 @@ namespace hpx { namespace collectives {
     template <typename T>
     hpx::future<T> broadcast_from(communicator comm,
         this_site_arg this_site = this_site_arg());
+
+    /// Broadcast a value to different call sites along a tree
+    ///
+    /// This function sends the given value to all call sites of the given
+    /// hierarchical communicator. Each group leader of the tree forwards the
+    /// value to the members of its groups, which limits the number of
+    /// messages any site has to send to the arity of the tree.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator. This has to be
+    ///                     the root site of the communicator.
+    /// \param  local_result A value to transmit to all participating sites
+    ///                     from this call site.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become ready once
+    ///             the value has been passed on to all children of this site.
+    ///
+    template <typename T>
+    hpx::future<decay_t<T>> broadcast_to(
+        hierarchical_communicator const& comm, T&& local_result);
+
+    /// Receive a value that was broadcast to different call sites along a
+    /// tree
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become ready once
+    ///             the value has been passed on to all children of this site.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from(hierarchical_communicator const& comm);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -112,9 +146,11 @@ namespace hpx { namespace collectives {
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/argument_types.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -170,11 +206,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<arg_type> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             if (communicator_.gate_.set(which, HPX_MOVE(l)))
             {
                 l = lock_type(communicator_.mtx_);
@@ -208,11 +242,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<arg_type> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             auto& data = communicator_.template access_data<arg_type>(l, 1);
             data[0] = HPX_FORWARD(T, t);
 
@@ -318,6 +350,66 @@ namespace hpx { namespace collectives {
                                      this_site, generation, root_site),
             this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast plain values along the tree of a hierarchical communicator
+    namespace detail {
+
+        // Send the value to the groups this site leads on the tree levels
+        // [0, last), all of these groups are served concurrently.
+        template <typename T>
+        hpx::future<T> broadcast_down(
+            hierarchical_communicator const& comm, std::size_t last, T value)
+        {
+            if (last == 0)
+            {
+                return hpx::make_ready_future(HPX_MOVE(value));
+            }
+
+            std::vector<hpx::future<T>> sent;
+            sent.reserve(last);
+            for (std::size_t i = 0; i != last; ++i)
+            {
+                auto const& l = comm.get_level(i);
+                HPX_ASSERT(l.this_site == 0);
+                sent.push_back(broadcast_to(l.comm, value, this_site_arg(0)));
+            }
+
+            return hpx::when_all(HPX_MOVE(sent))
+                .then(hpx::launch::sync,
+                    [](hpx::future<std::vector<hpx::future<T>>>&& f) -> T {
+                        std::vector<hpx::future<T>> results = f.get();
+                        for (std::size_t i = 1; i != results.size(); ++i)
+                        {
+                            results[i].get();    // propagate exceptions
+                        }
+                        return results[0].get();
+                    });
+        }
+    }    // namespace detail
+
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        hierarchical_communicator const& comm, T&& local_result)
+    {
+        HPX_ASSERT(comm.is_root());
+        return detail::broadcast_down(comm, comm.num_levels(),
+            std::decay_t<T>(HPX_FORWARD(T, local_result)));
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(hierarchical_communicator const& comm)
+    {
+        // the last level connects this site with its parent
+        HPX_ASSERT(!comm.is_root() && comm.num_levels() != 0);
+        std::size_t const last = comm.num_levels() - 1;
+
+        auto const& l = comm.get_level(last);
+        return broadcast_from<T>(l.comm, this_site_arg(l.this_site))
+            .then(hpx::launch::sync, [comm, last](hpx::future<T>&& f) {
+                return detail::broadcast_down(comm, last, f.get());
+            });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
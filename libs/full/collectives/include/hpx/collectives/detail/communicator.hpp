@@ -58,6 +58,7 @@ namespace hpx { namespace collectives { namespace detail {
           , num_sites_(num_sites)
           , needs_initialization_(true)
           , data_available_(false)
+          , generations_(num_sites, 0)
         {
             HPX_ASSERT(num_sites != 0);
         }
@@ -134,6 +135,25 @@ namespace hpx { namespace collectives { namespace detail {
                 data_available_ = false;
                 data_.reset();
             }
+
+            // the operation has been completed, release the sites which have
+            // arrived early for the next one
+            gate_.next_generation();
+        }
+
+        // Every site takes part in all operations performed on a communicator,
+        // its n-th call belongs to the n-th operation. A site may arrive for
+        // the next operation while the data of the current one is still being
+        // consumed, delay it until the current operation has been completed.
+        template <typename Lock>
+        hpx::shared_future<void> get_shared_future(std::size_t which, Lock& l)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+            if (which < generations_.size() && ++generations_[which] > 1)
+            {
+                gate_.synchronize(generations_[which], l);
+            }
+            return gate_.get_shared_future(l);
         }
 
     private:
@@ -147,6 +167,7 @@ namespace hpx { namespace collectives { namespace detail {
         std::size_t const num_sites_;
         bool needs_initialization_;
         bool data_available_;
+        std::vector<std::size_t> generations_;
     };
 }}}    // namespace hpx::collectives::detail
 
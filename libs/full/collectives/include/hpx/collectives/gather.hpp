@@ -113,6 +113,45 @@ namespace hpx { namespace collectives {
     hpx::future<std::vector<decay_t<T>>>
     gather_there(communicator comm, T&& result,
         this_site_arg this_site = this_site_arg());
+
+    /// Gather a set of values from different call sites along a tree
+    ///
+    /// This function receives the values of all call sites of the given
+    /// hierarchical communicator. Each group leader of the tree collects the
+    /// values of its groups before passing them on to its parent, which
+    /// limits the number of messages any site has to receive to the arity of
+    /// the tree.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator. This has to be
+    ///                     the root site of the communicator.
+    /// \param  result      The value to transmit to the central gather point
+    ///                     from this call site.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             gathered values, ordered by site. It will become ready once
+    ///             the gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<decay_t<T>>> gather_here(
+        hierarchical_communicator const& comm, T&& result);
+
+    /// Gather a given value at the given call site along a tree
+    ///
+    /// This function transmits the value given by \a result towards the root
+    /// site of the tree (where the corresponding \a gather_here is executed).
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator.
+    /// \param  result      The value to transmit to the central gather point
+    ///                     from this call site.
+    ///
+    /// \returns    This function returns a future<void>. It will become ready
+    ///             once the values of this site have been passed on.
+    ///
+    template <typename T>
+    hpx::future<void> gather_there(
+        hierarchical_communicator const& comm, T&& result);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -127,11 +166,14 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <type_traits>
@@ -181,11 +223,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<data_type> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             auto& data = communicator_.template access_data<arg_type>(l);
             data[which] = HPX_FORWARD(T, t);
 
@@ -215,10 +255,9 @@ namespace hpx { namespace traits {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            hpx::future<void> f = communicator_.gate_.get_shared_future(l).then(
-                hpx::launch::sync, HPX_MOVE(on_ready));
-
-            communicator_.gate_.synchronize(1, l);
+            hpx::future<void> f =
+                communicator_.get_shared_future(which, l).then(
+                    hpx::launch::sync, HPX_MOVE(on_ready));
 
             auto& data = communicator_.template access_data<arg_type>(l);
             data[which] = HPX_FORWARD(T, t);
@@ -332,6 +371,102 @@ namespace hpx { namespace collectives {
                                 this_site, generation, root_site),
             HPX_FORWARD(T, local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather plain values along the tree of a hierarchical communicator
+    namespace detail {
+
+        // Collect the values of the groups this site leads on the tree levels
+        // [level, last), one level after the other. Every group covers a
+        // consecutive range of sites (numbered relative to the root), the
+        // values are concatenated in that order.
+        template <typename T>
+        hpx::future<std::vector<T>> gather_up(
+            hierarchical_communicator const& comm, std::size_t level,
+            std::size_t last, std::vector<T> values)
+        {
+            if (level == last)
+            {
+                return hpx::make_ready_future(HPX_MOVE(values));
+            }
+
+            auto const& l = comm.get_level(level);
+            HPX_ASSERT(l.this_site == 0);
+
+            return gather_here(l.comm, HPX_MOVE(values), this_site_arg(0))
+                .then(hpx::launch::sync,
+                    [comm, level, last](
+                        hpx::future<std::vector<std::vector<T>>>&& f) {
+                        std::vector<std::vector<T>> parts = f.get();
+
+                        std::size_t size = 0;
+                        for (auto const& part : parts)
+                        {
+                            size += part.size();
+                        }
+
+                        std::vector<T> values;
+                        values.reserve(size);
+                        for (auto& part : parts)
+                        {
+                            std::move(part.begin(), part.end(),
+                                std::back_inserter(values));
+                        }
+
+                        return gather_up(
+                            comm, level + 1, last, HPX_MOVE(values));
+                    });
+        }
+    }    // namespace detail
+
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        hierarchical_communicator const& comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        HPX_ASSERT(comm.is_root());
+
+        std::vector<arg_type> values;
+        values.push_back(HPX_FORWARD(T, local_result));
+
+        return detail::gather_up(comm, 0, comm.num_levels(), HPX_MOVE(values))
+            .then(hpx::launch::sync,
+                [comm](hpx::future<std::vector<arg_type>>&& f) {
+                    // the values are ordered relative to the root site
+                    std::vector<arg_type> values = f.get();
+                    HPX_ASSERT(values.size() == comm.num_sites());
+
+                    std::size_t const shift =
+                        (comm.num_sites() - comm.root_site()) %
+                        comm.num_sites();
+                    std::rotate(
+                        values.begin(), values.begin() + shift, values.end());
+                    return values;
+                });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(
+        hierarchical_communicator const& comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        // the last level connects this site with its parent
+        HPX_ASSERT(!comm.is_root() && comm.num_levels() != 0);
+        std::size_t const last = comm.num_levels() - 1;
+
+        std::vector<arg_type> values;
+        values.push_back(HPX_FORWARD(T, local_result));
+
+        return detail::gather_up(comm, 0, last, HPX_MOVE(values))
+            .then(hpx::launch::sync,
+                [comm, last](hpx::future<std::vector<arg_type>>&& f) {
+                    auto const& l = comm.get_level(last);
+                    return gather_there(
+                        l.comm, f.get(), this_site_arg(l.this_site));
+                });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
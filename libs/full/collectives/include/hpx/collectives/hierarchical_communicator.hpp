@@ -0,0 +1,172 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hierarchical_communicator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// Create a new hierarchical communicator object usable with the tree
+    /// based collective operations
+    ///
+    /// This functions creates a new communicator object that arranges the
+    /// participating sites in a k-ary tree rooted at \a root_site. Each inner
+    /// node of the tree is connected to its children through a separate flat
+    /// communicator, which limits the number of messages any single site has
+    /// to handle to the arity of the tree. The hierarchical communicator can
+    /// be used with \a all_reduce, \a reduce_here, \a reduce_there,
+    /// \a broadcast_to, \a broadcast_from, \a gather_here, and
+    /// \a gather_there.
+    ///
+    /// \param  basename    The base name identifying the collective operation
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  arity       The maximal number of sites connected through a
+    ///                     flat communicator. This value is optional. If not
+    ///                     given, the configuration setting
+    ///                     hpx.lcos.collectives.hierarchical_arity is used. If
+    ///                     that is zero (the default), the arity is derived
+    ///                     from the number of sites: up to 16 sites are
+    ///                     connected through a single flat communicator, more
+    ///                     sites use an arity of about the square root of the
+    ///                     number of sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on the
+    ///                     given base name. This is optional and needs to be
+    ///                     supplied only if the collective operation on the
+    ///                     given base name has to be performed more than once.
+    /// \params root_site   The site that is the root of the tree. This value
+    ///                     is optional and defaults to '0' (zero).
+    ///
+    /// \note All participating sites have to supply the same values for
+    ///       \a num_sites, \a arity, and \a root_site.
+    ///
+    /// \returns    This function returns a new hierarchical communicator
+    ///             object usable with the tree based collective operations.
+    ///
+    hierarchical_communicator create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        arity_arg arity = arity_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg());
+}}
+// clang-format on
+
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sites are numbered relative to the root site and are split into
+    // groups of 'arity' consecutive sites. The lowest site of each group
+    // (its leader) represents the whole group on the next level of the tree.
+    class hierarchical_communicator
+    {
+    public:
+        // the flat communicator connecting the group of sites this site
+        // belongs to on one level of the tree
+        struct level
+        {
+            communicator comm;
+            std::size_t this_site;    // index of this site in the group
+        };
+
+        hierarchical_communicator() = default;
+
+        HPX_EXPORT hierarchical_communicator(char const* basename,
+            num_sites_arg num_sites, this_site_arg this_site, arity_arg arity,
+            generation_arg generation, root_site_arg root_site);
+
+        std::size_t num_sites() const noexcept
+        {
+            return num_sites_;
+        }
+        std::size_t this_site() const noexcept
+        {
+            return this_site_;
+        }
+        std::size_t root_site() const noexcept
+        {
+            return root_site_;
+        }
+        std::size_t arity() const noexcept
+        {
+            return arity_;
+        }
+
+        bool is_root() const noexcept
+        {
+            return this_site_ == root_site_;
+        }
+
+        // The levels this site takes part in, starting at the leaves. This
+        // site leads the groups on all of these levels except for the last
+        // one, which connects it to its parent (unless it is the root).
+        std::size_t num_levels() const noexcept
+        {
+            return levels_.size();
+        }
+        level const& get_level(std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < levels_.size());
+            return levels_[i];
+        }
+
+        // The communicators connecting this site with its partners for the
+        // rounds of a recursive doubling exchange. These are available only
+        // if the number of sites is a power of two.
+        std::size_t num_rounds() const noexcept
+        {
+            return partners_.size();
+        }
+        communicator const& get_partner(std::size_t round) const noexcept
+        {
+            HPX_ASSERT(round < partners_.size());
+            return partners_[round];
+        }
+
+    private:
+        std::size_t num_sites_ = 0;
+        std::size_t this_site_ = 0;
+        std::size_t root_site_ = 0;
+        std::size_t arity_ = 0;
+
+        std::vector<level> levels_;
+        std::vector<communicator> partners_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_EXPORT hierarchical_communicator create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        arity_arg arity = arity_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg());
+
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
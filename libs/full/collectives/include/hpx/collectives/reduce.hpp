@@ -113,6 +113,52 @@ namespace hpx { namespace collectives {
     template <typename T>
     hpx::future<void> reduce_there(communicator comm, T&& local_result,
         this_site_arg this_site = this_site_arg());
+
+    /// Reduce a set of values from different call sites along a tree
+    ///
+    /// This function receives the result of applying the given operator on
+    /// the values supplied from all call sites. Each group leader of the tree
+    /// reduces the values of its group before passing the partial result on
+    /// to its parent, which limits the number of values any site has to
+    /// receive to the arity of the tree.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator. This has to be
+    ///                     the root site of the communicator.
+    /// \param  local_result A value to reduce on the root site from this call
+    ///                     site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites
+    ///
+    /// \returns    This function returns a future holding a value calculated
+    ///             based on the values send by all participating sites. It will
+    ///             become ready once the reduction operation has been
+    ///             completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<decay_t<T>> reduce_here(
+        hierarchical_communicator const& comm, T&& local_result, F&& op);
+
+    /// Reduce a given value at the given call site along a tree
+    ///
+    /// This function transmits the value given by \a local_result towards
+    /// the root site of the tree (where the corresponding \a reduce_here is
+    /// executed).
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator.
+    /// \param  local_result A value to reduce on the root site from this call
+    ///                     site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites. This is applied on
+    ///                     all group leaders of the tree.
+    ///
+    /// \returns    This function returns a future<void>. It will become ready
+    ///             once the value of this site has been passed on.
+    ///
+    template <typename T, typename F>
+    hpx::future<void> reduce_there(
+        hierarchical_communicator const& comm, T&& local_result, F&& op);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -127,6 +173,7 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -188,11 +235,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<arg_type> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             auto& data = communicator_.template access_data<arg_type>(l);
             data[which] = HPX_FORWARD(T, t);
 
@@ -222,10 +267,9 @@ namespace hpx { namespace traits {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            hpx::future<void> f = communicator_.gate_.get_shared_future(l).then(
-                hpx::launch::sync, HPX_MOVE(on_ready));
-
-            communicator_.gate_.synchronize(1, l);
+            hpx::future<void> f =
+                communicator_.get_shared_future(which, l).then(
+                    hpx::launch::sync, HPX_MOVE(on_ready));
 
             auto& data = communicator_.template access_data<arg_type>(l);
             data[which] = HPX_FORWARD(T, t);
@@ -340,6 +384,61 @@ namespace hpx { namespace collectives {
                                 this_site, generation, root_site),
             HPX_FORWARD(T, local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // reduce plain values along the tree of a hierarchical communicator
+    namespace detail {
+
+        // Reduce the values of the groups this site leads on the tree levels
+        // [level, last), one level after the other.
+        template <typename T, typename F>
+        hpx::future<T> reduce_up(hierarchical_communicator const& comm,
+            std::size_t level, std::size_t last, T value, F const& op)
+        {
+            if (level == last)
+            {
+                return hpx::make_ready_future(HPX_MOVE(value));
+            }
+
+            auto const& l = comm.get_level(level);
+            HPX_ASSERT(l.this_site == 0);
+
+            return reduce_here(l.comm, HPX_MOVE(value), op, this_site_arg(0))
+                .then(hpx::launch::sync,
+                    [comm, level, last, op](hpx::future<T>&& f) {
+                        return reduce_up(comm, level + 1, last, f.get(), op);
+                    });
+        }
+    }    // namespace detail
+
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> reduce_here(
+        hierarchical_communicator const& comm, T&& local_result, F&& op)
+    {
+        HPX_ASSERT(comm.is_root());
+        return detail::reduce_up(comm, 0, comm.num_levels(),
+            std::decay_t<T>(HPX_FORWARD(T, local_result)), op);
+    }
+
+    template <typename T, typename F>
+    hpx::future<void> reduce_there(
+        hierarchical_communicator const& comm, T&& local_result, F&& op)
+    {
+        using arg_type = std::decay_t<T>;
+
+        // the last level connects this site with its parent
+        HPX_ASSERT(!comm.is_root() && comm.num_levels() != 0);
+        std::size_t const last = comm.num_levels() - 1;
+
+        return detail::reduce_up(comm, 0, last,
+            arg_type(HPX_FORWARD(T, local_result)), op)
+            .then(hpx::launch::sync,
+                [comm, last](hpx::future<arg_type>&& f) {
+                    auto const& l = comm.get_level(last);
+                    return reduce_there(
+                        l.comm, f.get(), this_site_arg(l.this_site));
+                });
+    }
 }}    // namespace hpx::collectives
 
 #endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -176,11 +176,9 @@ namespace hpx { namespace traits {
             HPX_UNUSED(il);
 
             hpx::future<arg_type> f =
-                communicator_.gate_.get_shared_future(l).then(
+                communicator_.get_shared_future(which, l).then(
                     hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             if (communicator_.gate_.set(which, HPX_MOVE(l)))
             {
                 l = lock_type(communicator_.mtx_);
@@ -214,11 +212,9 @@ namespace hpx { namespace traits {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            hpx::future<T> f = communicator_.gate_.get_shared_future(l).then(
+            hpx::future<T> f = communicator_.get_shared_future(which, l).then(
                 hpx::launch::sync, HPX_MOVE(on_ready));
 
-            communicator_.gate_.synchronize(1, l);
-
             auto& data = communicator_.template access_data<T>(l);
             data = HPX_MOVE(t);
 
@@ -0,0 +1,170 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace collectives {
+
+    namespace detail {
+
+        // Up to this number of sites a single flat communicator is used. The
+        // root site of a flat communicator handles one message per site,
+        // which is cheaper than the additional latency of a deeper tree for
+        // small site counts only.
+        constexpr std::size_t hierarchical_cut_off = 16;
+
+        std::size_t hierarchical_arity(std::size_t num_sites)
+        {
+            if (num_sites <= hierarchical_cut_off)
+            {
+                return num_sites < 2 ? 2 : num_sites;
+            }
+
+            // balance the number of messages handled by each group leader
+            // with the depth of the tree
+            auto arity = static_cast<std::size_t>(
+                std::ceil(std::sqrt(static_cast<double>(num_sites))));
+            return arity < 2 ? 2 : arity;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    hierarchical_communicator::hierarchical_communicator(char const* basename,
+        num_sites_arg num_sites, this_site_arg this_site, arity_arg arity,
+        generation_arg generation, root_site_arg root_site)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                agas::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+        if (arity == std::size_t(-1))
+        {
+            arity = std::stoull(get_config_entry(
+                "hpx.lcos.collectives.hierarchical_arity", "0"));
+        }
+        if (arity == 0)
+        {
+            arity = detail::hierarchical_arity(num_sites);
+        }
+
+        if (arity < 2)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::collectives::hierarchical_communicator",
+                hpx::util::format(
+                    "the arity of a hierarchical communicator has to be "
+                    "larger than one: {}",
+                    std::size_t(arity)));
+        }
+
+        HPX_ASSERT(this_site < num_sites);
+        HPX_ASSERT(root_site < num_sites);
+
+        num_sites_ = num_sites;
+        this_site_ = this_site;
+        root_site_ = root_site;
+        arity_ = arity;
+
+        std::string name(basename);
+        if (generation != std::size_t(-1))
+        {
+            name += std::to_string(generation) + "/";
+        }
+
+        // Walk up the tree starting at the leaves. On each level the sites
+        // are ranked by their distance from the root, the group leaders of
+        // one level are the only sites taking part in the next level.
+        std::size_t const site =
+            (this_site_ + num_sites_ - root_site_) % num_sites_;
+
+        std::size_t stride = 1;
+        std::size_t sites_on_level = num_sites_;
+        for (std::size_t depth = 0; sites_on_level > 1; ++depth)
+        {
+            std::size_t const rank = site / stride;
+            std::size_t const group = rank / arity_;
+            std::size_t const index = rank % arity_;
+            std::size_t const group_size =
+                (std::min)(arity_, sites_on_level - group * arity_);
+
+            // a group consisting of its leader only needs no communicator
+            if (group_size > 1)
+            {
+                std::string level_name = name + "tree/" +
+                    std::to_string(depth) + "/" + std::to_string(group) + "/";
+
+                levels_.push_back(level{
+                    create_communicator(level_name.c_str(),
+                        num_sites_arg(group_size), this_site_arg(index),
+                        generation_arg(), root_site_arg(0)),
+                    index});
+            }
+
+            // only the group leaders continue to the next level
+            if (index != 0)
+            {
+                break;
+            }
+
+            stride *= arity_;
+            sites_on_level = (sites_on_level + arity_ - 1) / arity_;
+        }
+
+        // Recursive doubling exchanges data between sites differing in one
+        // bit of their number during each round, which requires the number
+        // of sites to be a power of two.
+        if (num_sites_ > 1 && (num_sites_ & (num_sites_ - 1)) == 0)
+        {
+            for (std::size_t round = 0; (std::size_t(1) << round) < num_sites_;
+                 ++round)
+            {
+                std::size_t const partner =
+                    this_site_ ^ (std::size_t(1) << round);
+                std::size_t const lower = (std::min)(this_site_, partner);
+
+                std::string pair_name = name + "pairs/" +
+                    std::to_string(round) + "/" + std::to_string(lower) + "/";
+
+                partners_.push_back(create_communicator(pair_name.c_str(),
+                    num_sites_arg(2),
+                    this_site_arg(this_site_ == lower ? 0 : 1),
+                    generation_arg(), root_site_arg(0)));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hierarchical_communicator create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites, this_site_arg this_site,
+        arity_arg arity, generation_arg generation, root_site_arg root_site)
+    {
+        return hierarchical_communicator(
+            basename, num_sites, this_site, arity, generation, root_site);
+    }
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -0,0 +1,173 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the latency of the collective operations using a flat communicator
+// with the tree based implementation of the hierarchical communicator. Run
+// this with a growing number of localities, for instance on one host:
+//
+//     hierarchical_collectives_performance --hpx:localities=64
+//         --hpx:threads=1 --arity=8
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+std::size_t iterations = 100;
+
+template <typename F>
+double measure(F&& f)
+{
+    // warm up, this also connects all sites with their communicators
+    f();
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+    return t.elapsed() / iterations;
+}
+
+void print(char const* name, char const* kind, std::size_t num_sites,
+    std::size_t arity, double elapsed, bool csv)
+{
+    if (hpx::get_locality_id() != 0)
+        return;
+
+    if (csv)
+    {
+        std::cout << name << "," << kind << "," << num_sites << "," << arity
+                  << "," << elapsed << std::endl;
+    }
+    else
+    {
+        std::cout << name << " (" << kind << ", " << num_sites
+                  << " sites, arity " << arity << "): " << elapsed * 1e6
+                  << " [us]" << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    iterations = vm["iterations"].as<std::size_t>();
+    bool csv = vm.count("csv_output") != 0;
+
+    std::size_t num_sites = hpx::get_num_localities(hpx::launch::sync);
+    std::size_t this_site = hpx::get_locality_id();
+
+    auto flat = create_communicator("/benchmark/flat/",
+        num_sites_arg(num_sites), this_site_arg(this_site));
+    auto tree = create_hierarchical_communicator("/benchmark/tree/",
+        num_sites_arg(num_sites), this_site_arg(this_site),
+        arity_arg(vm["arity"].as<std::size_t>()));
+
+    std::uint64_t value = this_site;
+    std::plus<std::uint64_t> op;
+
+    // all_reduce
+    double elapsed = measure([&]() { all_reduce(flat, value, op).get(); });
+    print("all_reduce", "flat", num_sites, num_sites, elapsed, csv);
+
+    elapsed = measure([&]() { all_reduce(tree, value, op).get(); });
+    print("all_reduce",
+        tree.num_rounds() != 0 ? "recursive doubling" : "tree", num_sites,
+        tree.arity(), elapsed, csv);
+
+    // reduce
+    elapsed = measure([&]() {
+        if (this_site == 0)
+            reduce_here(flat, value, op).get();
+        else
+            reduce_there(flat, value).get();
+    });
+    print("reduce", "flat", num_sites, num_sites, elapsed, csv);
+
+    elapsed = measure([&]() {
+        if (tree.is_root())
+            reduce_here(tree, value, op).get();
+        else
+            reduce_there(tree, value, op).get();
+    });
+    print("reduce", "tree", num_sites, tree.arity(), elapsed, csv);
+
+    // broadcast
+    elapsed = measure([&]() {
+        if (this_site == 0)
+            broadcast_to(flat, value).get();
+        else
+            broadcast_from<std::uint64_t>(flat).get();
+    });
+    print("broadcast", "flat", num_sites, num_sites, elapsed, csv);
+
+    elapsed = measure([&]() {
+        if (tree.is_root())
+            broadcast_to(tree, value).get();
+        else
+            broadcast_from<std::uint64_t>(tree).get();
+    });
+    print("broadcast", "tree", num_sites, tree.arity(), elapsed, csv);
+
+    // gather
+    elapsed = measure([&]() {
+        if (this_site == 0)
+            gather_here(flat, value).get();
+        else
+            gather_there(flat, value).get();
+    });
+    print("gather", "flat", num_sites, num_sites, elapsed, csv);
+
+    elapsed = measure([&]() {
+        if (tree.is_root())
+            gather_here(tree, value).get();
+        else
+            gather_there(tree, value).get();
+    });
+    print("gather", "tree", num_sites, tree.arity(), elapsed, csv);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations",
+            value<std::size_t>()->default_value(100),
+            "number of operations to be averaged (default: 100)")
+        ("arity",
+            value<std::size_t>()->default_value(std::size_t(-1)),
+            "arity of the hierarchical communicator (default: derived from "
+            "the number of localities)")
+        ("csv_output", "print results in csv format")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
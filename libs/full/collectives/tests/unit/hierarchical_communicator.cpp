@@ -0,0 +1,205 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr char const* hierarchical_basename = "/test/hierarchical/";
+
+// every test uses its own generation, this is incremented in the same order
+// on all localities
+std::size_t generation = 0;
+
+// Run several sites on each locality to build trees with more than one level
+// even if only a few localities are available.
+template <typename F>
+void run_sites(std::size_t sites_per_locality, F&& f)
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    std::size_t num_sites = num_localities * sites_per_locality;
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(sites_per_locality);
+    for (std::size_t i = 0; i != sites_per_locality; ++i)
+    {
+        std::size_t this_site = here * sites_per_locality + i;
+        sites.push_back(hpx::async(f, num_sites, this_site));
+    }
+    hpx::wait_all(sites);
+
+    for (auto&& site : sites)
+    {
+        HPX_TEST(!site.has_exception());
+    }
+}
+
+hierarchical_communicator create(std::size_t num_sites, std::size_t this_site,
+    std::size_t arity, std::size_t root_site, std::size_t gen)
+{
+    return create_hierarchical_communicator(hierarchical_basename,
+        num_sites_arg(num_sites), this_site_arg(this_site), arity_arg(arity),
+        generation_arg(gen), root_site_arg(root_site));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_reduce(
+    std::size_t sites_per_locality, std::size_t arity, std::size_t root_site)
+{
+    std::size_t gen = ++generation;
+    run_sites(sites_per_locality, [=](std::size_t num_sites, std::size_t site) {
+        auto comm = create(num_sites, site, arity, root_site % num_sites, gen);
+
+        for (std::uint64_t i = 0; i != 5; ++i)
+        {
+            hpx::future<std::uint64_t> result =
+                all_reduce(comm, site + i, std::plus<std::uint64_t>{});
+
+            std::uint64_t sum = 0;
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                sum += j + i;
+            }
+            HPX_TEST_EQ(sum, result.get());
+        }
+    });
+}
+
+void test_reduce(
+    std::size_t sites_per_locality, std::size_t arity, std::size_t root_site)
+{
+    std::size_t gen = ++generation;
+    run_sites(sites_per_locality, [=](std::size_t num_sites, std::size_t site) {
+        auto comm = create(num_sites, site, arity, root_site % num_sites, gen);
+
+        for (std::uint64_t i = 0; i != 5; ++i)
+        {
+            std::uint64_t value = site + i;
+            if (comm.is_root())
+            {
+                hpx::future<std::uint64_t> result =
+                    reduce_here(comm, value, std::plus<std::uint64_t>{});
+
+                std::uint64_t sum = 0;
+                for (std::size_t j = 0; j != num_sites; ++j)
+                {
+                    sum += j + i;
+                }
+                HPX_TEST_EQ(sum, result.get());
+            }
+            else
+            {
+                reduce_there(comm, value, std::plus<std::uint64_t>{}).get();
+            }
+        }
+    });
+}
+
+void test_broadcast(
+    std::size_t sites_per_locality, std::size_t arity, std::size_t root_site)
+{
+    std::size_t gen = ++generation;
+    run_sites(sites_per_locality, [=](std::size_t num_sites, std::size_t site) {
+        auto comm = create(num_sites, site, arity, root_site % num_sites, gen);
+
+        for (std::uint64_t i = 0; i != 5; ++i)
+        {
+            if (comm.is_root())
+            {
+                hpx::future<std::uint64_t> result = broadcast_to(comm, 42 + i);
+                HPX_TEST_EQ(std::uint64_t(42 + i), result.get());
+            }
+            else
+            {
+                hpx::future<std::uint64_t> result =
+                    broadcast_from<std::uint64_t>(comm);
+                HPX_TEST_EQ(std::uint64_t(42 + i), result.get());
+            }
+        }
+    });
+}
+
+void test_gather(
+    std::size_t sites_per_locality, std::size_t arity, std::size_t root_site)
+{
+    std::size_t gen = ++generation;
+    run_sites(sites_per_locality, [=](std::size_t num_sites, std::size_t site) {
+        auto comm = create(num_sites, site, arity, root_site % num_sites, gen);
+
+        for (std::uint64_t i = 0; i != 5; ++i)
+        {
+            std::uint64_t value = site + i;
+            if (comm.is_root())
+            {
+                hpx::future<std::vector<std::uint64_t>> result =
+                    gather_here(comm, value);
+
+                std::vector<std::uint64_t> values = result.get();
+                HPX_TEST_EQ(values.size(), num_sites);
+                for (std::size_t j = 0; j != values.size(); ++j)
+                {
+                    HPX_TEST_EQ(values[j], j + i);
+                }
+            }
+            else
+            {
+                gather_there(comm, value).get();
+            }
+        }
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // 7 sites per locality create uneven groups and fall back to the tree
+    // for all_reduce, 8 sites per locality use recursive doubling (as long as
+    // the number of localities is a power of two)
+    // the default arity is derived from the number of sites
+    std::size_t const arities[] = {2, 3, std::size_t(-1)};
+
+    for (std::size_t sites_per_locality : {1, 7, 8})
+    {
+        for (std::size_t arity : arities)
+        {
+            for (std::size_t root_site : {0, 5})
+            {
+                test_all_reduce(sites_per_locality, arity, root_site);
+                test_reduce(sites_per_locality, arity, root_site);
+                test_broadcast(sites_per_locality, arity, root_site);
+                test_gather(sites_per_locality, arity, root_site);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,291 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file host/numa_distribution_policy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
+#include <hpx/assert.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/async_local/dataflow.hpp>
+#endif
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/compute/detail/target_distribution_policy.hpp>
+#include <hpx/compute/host/numa_domains.hpp>
+#include <hpx/compute/host/target.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/runtime_components/create_component_helpers.hpp>
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace compute { namespace host {
+    /// A numa_distribution_policy places each of the created objects onto
+    /// exactly one of the given targets. Contrary to the
+    /// \a target_distribution_policy (which hands all targets of a locality
+    /// to every object created there), each object receives only the target
+    /// it was placed on. If used with a partitioned_vector whose partitions
+    /// are allocated using a \a block_allocator, the memory of each partition
+    /// will be bound to a single NUMA domain and local algorithms will run on
+    /// the cores of that domain only.
+    struct numa_distribution_policy
+      : compute::detail::target_distribution_policy<host::target>
+    {
+    private:
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+    public:
+        typedef compute::detail::target_distribution_policy<host::target>
+            base_type;
+
+        /// Default-construct a new instance of a \a numa_distribution_policy.
+        /// This policy will represent all NUMA domains of the current
+        /// locality.
+        ///
+        numa_distribution_policy() {}
+
+        /// Create a new \a numa_distribution_policy representing the given
+        /// set of targets
+        ///
+        /// \param targets [in] The targets the new instances should represent
+        ///
+        numa_distribution_policy operator()(
+            std::vector<target_type> const& targets,
+            std::size_t num_partitions = std::size_t(-1)) const
+        {
+            if (num_partitions == std::size_t(-1))
+                num_partitions = targets.size();
+            return numa_distribution_policy(targets, num_partitions);
+        }
+
+        /// Create a new \a numa_distribution_policy representing the given
+        /// set of targets
+        ///
+        /// \param targets [in] The targets the new instances should represent
+        ///
+        numa_distribution_policy operator()(
+            std::vector<target_type>&& targets,
+            std::size_t num_partitions = std::size_t(-1)) const
+        {
+            if (num_partitions == std::size_t(-1))
+                num_partitions = targets.size();
+            return numa_distribution_policy(HPX_MOVE(targets), num_partitions);
+        }
+
+        /// Create a new \a numa_distribution_policy representing all NUMA
+        /// domains of the current locality, creating the given number of
+        /// partitions
+        ///
+        /// \param num_partitions [in] The number of partitions to create
+        ///
+        numa_distribution_policy operator()(std::size_t num_partitions) const
+        {
+            return numa_distribution_policy(
+                std::vector<target_type>(), num_partitions);
+        }
+
+        /// Returns the number of partitions to create
+        std::size_t get_num_partitions() const
+        {
+            init_targets();
+            return this->base_type::get_num_partitions();
+        }
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        /// Create one object on one of the NUMA domains associated by
+        /// this policy instance
+        ///
+        /// \param ts  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \note This function is part of the placement policy implemented by
+        ///       this class
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<hpx::id_type> create(Ts&&... ts) const
+        {
+            init_targets();
+
+            target_type t = this->get_next_target();
+            hpx::id_type target_locality = t.get_locality();
+            return components::create_async<Component>(target_locality,
+                HPX_FORWARD(Ts, ts)..., std::vector<target_type>{HPX_MOVE(t)});
+        }
+#endif
+
+        /// \cond NOINTERNAL
+        typedef std::pair<hpx::id_type, std::vector<hpx::id_type>>
+            bulk_locality_result;
+        /// \endcond
+
+        /// Create multiple objects on the NUMA domains associated by
+        /// this policy instance
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \note This function is part of the placement policy implemented by
+        ///       this class
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<std::vector<bulk_locality_result>> bulk_create(
+            std::size_t count,
+            Ts&&...
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            ts
+#endif
+        ) const
+        {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+            HPX_UNUSED(count);
+            HPX_ASSERT(false);
+            return hpx::future<std::vector<bulk_locality_result>>();
+#else
+            init_targets();
+
+            // collect all targets per locality
+            std::map<hpx::id_type, std::vector<target_type>> m;
+            for (target_type const& t : this->targets_)
+            {
+                m[t.get_locality()].push_back(t);
+            }
+
+            std::vector<hpx::id_type> localities;
+            localities.reserve(m.size());
+
+            // number of targets on each of the localities
+            std::vector<std::size_t> num_targets;
+            num_targets.reserve(m.size());
+
+            std::vector<hpx::future<std::vector<hpx::id_type>>> objs;
+            objs.reserve(this->targets_.size());
+
+            auto end = m.end();
+            for (auto it = m.begin(); it != end; ++it)
+            {
+                localities.push_back(HPX_MOVE(it->first));
+                num_targets.push_back(it->second.size());
+
+                // each target receives its own set of objects which are bound
+                // to this target only
+                for (target_type& t : it->second)
+                {
+                    std::size_t num_partitions = this->get_num_items(count, t);
+                    objs.push_back(components::bulk_create_async<Component>(
+                        localities.back(), num_partitions, ts...,
+                        std::vector<target_type>{HPX_MOVE(t)}));
+                }
+            }
+
+            return hpx::dataflow(
+                [=](std::vector<hpx::future<std::vector<hpx::id_type>>>&&
+                        v) mutable -> std::vector<bulk_locality_result> {
+                    HPX_ASSERT(localities.size() == num_targets.size());
+
+                    std::vector<bulk_locality_result> result;
+                    result.reserve(localities.size());
+
+                    std::size_t part = 0;
+                    for (std::size_t i = 0; i != localities.size(); ++i)
+                    {
+                        std::vector<hpx::id_type> ids;
+                        for (std::size_t j = 0; j != num_targets[i]; ++j)
+                        {
+                            HPX_ASSERT(part < v.size());
+                            std::vector<hpx::id_type> r = v[part++].get();
+                            ids.insert(ids.end(),
+                                std::make_move_iterator(r.begin()),
+                                std::make_move_iterator(r.end()));
+                        }
+                        result.emplace_back(
+                            HPX_MOVE(localities[i]), HPX_MOVE(ids));
+                    }
+                    HPX_ASSERT(part == v.size());
+
+                    return result;
+                },
+                HPX_MOVE(objs));
+#endif
+        }
+
+    protected:
+        /// \cond NOINTERNAL
+        numa_distribution_policy(
+            std::vector<target_type> const& targets, std::size_t num_partitions)
+          : base_type(targets, num_partitions)
+        {
+        }
+
+        numa_distribution_policy(
+            std::vector<target_type>&& targets, std::size_t num_partitions)
+          : base_type(HPX_MOVE(targets), num_partitions)
+        {
+        }
+
+        // This policy represents the NUMA domains of the current locality
+        // if no targets were given explicitly.
+        void init_targets() const
+        {
+            std::lock_guard<mutex_type> l(this->mtx_);
+            if (this->targets_.empty())
+                this->targets_ = host::numa_domains();
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            ar& serialization::base_object<base_type>(*this);
+        }
+        /// \endcond
+    };
+
+    /// A predefined instance of the \a numa_distribution_policy for
+    /// localities. It will represent all NUMA domains of the given locality
+    /// and will place one partition of the items to create onto each of them.
+    static numa_distribution_policy const numa_layout;
+}}}    // namespace hpx::compute::host
+
+/// \cond NOINTERNAL
+namespace hpx { namespace traits {
+    template <>
+    struct is_distribution_policy<compute::host::numa_distribution_policy>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct num_container_partitions<compute::host::numa_distribution_policy>
+    {
+        static std::size_t call(
+            compute::host::numa_distribution_policy const& policy)
+        {
+            return policy.get_num_partitions();
+        }
+    };
+}}    // namespace hpx::traits
+/// \endcond
+
+#endif
@@ -0,0 +1,138 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        parcelset::locality parcelport_address(
+            util::runtime_configuration const& ini);
+
+        // The shared memory parcelport is used for all destinations running
+        // on the same host, it can't be used for bootstrapping. Parcels to
+        // localities on other hosts are sent through the next parcelport in
+        // order of priority (usually TCP).
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connections.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const override;
+
+            // Only localities on the same host can be reached.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override;
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+        private:
+            void io_service_work();
+
+            std::shared_ptr<segment> get_segment(
+                std::string const& name, error_code& ec);
+
+            std::atomic<bool> stopped_;
+
+            std::size_t num_slots_;
+            std::size_t ring_size_;
+
+            // the segment this locality receives parcels through
+            std::shared_ptr<segment> segment_;
+
+            // segments of other localities on this host
+            lcos::local::spinlock segments_mtx_;
+            std::map<std::string, std::shared_ptr<segment>> segments_;
+
+            sender sender_;
+            receiver<connection_handler> receiver_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
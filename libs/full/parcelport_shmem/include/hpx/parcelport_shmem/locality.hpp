@@ -0,0 +1,75 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A shared memory locality is identified by the host it runs on and by
+    // the name of the shared memory segment it receives parcels through.
+    class locality
+    {
+    public:
+        locality() = default;
+
+        locality(std::string const& host, std::string const& segment)
+          : host_(host)
+          , segment_(segment)
+        {
+        }
+
+        std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        std::string const& segment() const noexcept
+        {
+            return segment_;
+        }
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !segment_.empty();
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.segment_ == rhs.segment_ && lhs.host_ == rhs.host_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_ < rhs.host_ ||
+                (lhs.host_ == rhs.host_ && lhs.segment_ < rhs.segment_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::string segment_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,328 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Reads the messages written by one sending connection into one slot of
+    // the segment owned by this locality.
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            rcv_header,
+            rcv_data,
+            rcv_chunks
+        };
+
+        using data_type = std::vector<char>;
+        using buffer_type = parcel_buffer<data_type, data_type>;
+        using read_buffer_type = std::pair<void*, std::size_t>;
+
+    public:
+        receiver_connection(std::size_t slot, ring r) noexcept
+          : slot_(slot)
+          , ring_(r)
+          , state_(rcv_header)
+          , discard_(false)
+          , current_(0)
+          , offset_(0)
+        {
+            start_header();
+        }
+
+        // Read whatever is available in the ring, decode at most one message.
+        // Returns true if any progress was made.
+        bool receive(Parcelport& pp, segment& seg, std::size_t num_thread)
+        {
+            std::unique_lock l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return false;
+            }
+
+            std::uint32_t const state =
+                ring_.header()->state_.load(std::memory_order_acquire);
+            if (state == static_cast<std::uint32_t>(slot_state::free))
+            {
+                return false;
+            }
+
+            bool has_work = false;
+            if (discard_)
+            {
+                // the sender violated the protocol, drop everything it sends
+                // until it releases the slot
+                char scratch[256];
+                while (ring_.read(scratch, sizeof(scratch)) != 0)
+                {
+                    has_work = true;
+                }
+            }
+            else
+            {
+                while (read_buffers(has_work))
+                {
+                    if (state_ == rcv_header)
+                    {
+                        if (!start_data(pp))
+                        {
+                            discard_ = true;
+                            start_header();
+                            return true;
+                        }
+                    }
+                    else if (state_ == rcv_data &&
+                        buffer_.num_chunks_.first != 0)
+                    {
+                        start_chunks();
+                    }
+                    else
+                    {
+                        // complete data point and pass it along
+                        buffer_.data_point_.time_ =
+                            timer_.elapsed_nanoseconds() -
+                            buffer_.data_point_.time_;
+
+                        decode_parcels(pp, HPX_MOVE(buffer_), num_thread);
+                        buffer_ = buffer_type();
+
+                        start_header();
+                        return true;
+                    }
+                }
+            }
+
+            // the sender has released the slot, make it available again once
+            // everything has been read
+            if (state == static_cast<std::uint32_t>(slot_state::closing) &&
+                state_ == rcv_header && current_ == 0 && offset_ == 0 &&
+                ring_.empty())
+            {
+                discard_ = false;
+                seg.reset_slot(slot_);
+                has_work = true;
+            }
+            return has_work;
+        }
+
+    private:
+        void add_buffer(void* data, std::size_t size)
+        {
+            buffers_.emplace_back(data, size);
+        }
+
+        // Drain bytes into the buffers of the current stage, returns true
+        // once all of them have been filled.
+        bool read_buffers(bool& has_work)
+        {
+            while (current_ != buffers_.size())
+            {
+                read_buffer_type const& b = buffers_[current_];
+
+                std::size_t const count = ring_.read(
+                    static_cast<char*>(b.first) + offset_, b.second - offset_);
+                has_work = has_work || count != 0;
+
+                offset_ += count;
+                if (offset_ != b.second)
+                {
+                    return false;
+                }
+
+                ++current_;
+                offset_ = 0;
+            }
+            return true;
+        }
+
+        void start_stage(connection_state state)
+        {
+            state_ = state;
+            buffers_.clear();
+            current_ = 0;
+            offset_ = 0;
+        }
+
+        void start_header()
+        {
+            start_stage(rcv_header);
+
+            add_buffer(&buffer_.size_, sizeof(buffer_.size_));
+            add_buffer(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        bool start_data(Parcelport& pp)
+        {
+            std::uint64_t const inbound_size = buffer_.size_;
+            if (inbound_size >
+                static_cast<std::uint64_t>(pp.get_max_inbound_message_size()))
+            {
+                LPT_(error).format("shmem::receiver_connection: inbound "
+                                   "message size {} exceeds maximum of {}",
+                    inbound_size, pp.get_max_inbound_message_size());
+                return false;
+            }
+
+            start_stage(rcv_data);
+
+            // Store the time of the begin of the read operation
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.bytes_ = static_cast<std::size_t>(inbound_size);
+            data.num_parcels_ = 0;
+
+            std::size_t const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            std::size_t const num_non_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            if (num_zero_copy_chunks != 0)
+            {
+                using transmission_chunk_type =
+                    typename buffer_type::transmission_chunk_type;
+
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+
+                chunks.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+                add_buffer(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type));
+            }
+
+            // add main buffer holding data which was serialized normally
+            buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+            add_buffer(buffer_.data_.data(), buffer_.data_.size());
+
+            return true;
+        }
+
+        void start_chunks()
+        {
+            start_stage(rcv_chunks);
+
+            // add appropriately sized chunk buffers for the zero-copy data
+            std::size_t const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                std::size_t const chunk_size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+                buffer_.chunks_[i].resize(chunk_size);
+                add_buffer(buffer_.chunks_[i].data(), chunk_size);
+            }
+        }
+
+        std::size_t slot_;
+        ring ring_;
+
+        buffer_type buffer_;
+        connection_state state_;
+        bool discard_;
+
+        // buffers of the current stage and the read position inside of them
+        std::vector<read_buffer_type> buffers_;
+        std::size_t current_;
+        std::size_t offset_;
+
+        hpx::chrono::high_resolution_timer timer_;
+        hpx::lcos::local::spinlock mtx_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parcelport>
+    struct receiver
+    {
+        using connection_type = receiver_connection<Parcelport>;
+
+        explicit receiver(Parcelport& pp) noexcept
+          : pp_(pp)
+          , running_(false)
+        {
+        }
+
+        void run(std::shared_ptr<segment> seg)
+        {
+            segment_ = HPX_MOVE(seg);
+
+            std::size_t const num_slots = segment_->num_slots();
+            connections_.reserve(num_slots);
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                connections_.push_back(std::make_unique<connection_type>(
+                    i, segment_->get_ring(i)));
+            }
+
+            running_.store(true, std::memory_order_release);
+        }
+
+        // The connections are kept alive until the receiver is destroyed as
+        // other threads may still be executing background work.
+        void stop() noexcept
+        {
+            running_.store(false, std::memory_order_release);
+        }
+
+        bool background_work(std::size_t num_thread)
+        {
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            std::size_t const num_slots = connections_.size();
+
+            // start scanning at a different slot for each worker thread to
+            // spread the contention on the per-slot locks
+            std::size_t const first =
+                num_thread == std::size_t(-1) ? 0 : num_thread % num_slots;
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                connection_type& c = *connections_[(first + i) % num_slots];
+                has_work = c.receive(pp_, *segment_, num_thread) || has_work;
+            }
+            return has_work;
+        }
+
+    private:
+        Parcelport& pp_;
+        std::shared_ptr<segment> segment_;
+        std::vector<std::unique_ptr<connection_type>> connections_;
+        std::atomic<bool> running_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
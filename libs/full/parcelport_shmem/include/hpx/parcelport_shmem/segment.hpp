@@ -0,0 +1,160 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+        "the shared memory parcelport requires lock-free 64 bit atomics");
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each slot of a segment is used by exactly one sending connection at a
+    // time. The sender claims a slot by switching it from 'free' to
+    // 'connected' and marks it as 'closing' once it is done. The receiver
+    // resets the slot to 'free' after it has drained all remaining data.
+    enum class slot_state : std::uint32_t
+    {
+        free = 0,
+        connected = 1,
+        closing = 2
+    };
+
+    struct alignas(threads::get_cache_line_size()) slot_header
+    {
+        std::atomic<std::uint32_t> state_;
+
+        // written by the producer only
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint64_t> head_;
+
+        // written by the consumer only
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint64_t> tail_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A single-producer/single-consumer byte stream living in shared memory.
+    // The positions stored in the slot header increase monotonically, the
+    // capacity is always a power of two.
+    class ring
+    {
+    public:
+        constexpr ring() noexcept
+          : header_(nullptr)
+          , data_(nullptr)
+          , capacity_(0)
+        {
+        }
+
+        ring(slot_header* header, char* data, std::size_t capacity) noexcept
+          : header_(header)
+          , data_(data)
+          , capacity_(capacity)
+        {
+        }
+
+        // Copy up to 'size' bytes into the ring, returns the number of bytes
+        // actually written.
+        HPX_EXPORT std::size_t write(
+            void const* src, std::size_t size) noexcept;
+
+        // Copy up to 'size' bytes out of the ring, returns the number of
+        // bytes actually read.
+        HPX_EXPORT std::size_t read(void* dst, std::size_t size) noexcept;
+
+        bool empty() const noexcept
+        {
+            return header_->head_.load(std::memory_order_acquire) ==
+                header_->tail_.load(std::memory_order_relaxed);
+        }
+
+        slot_header* header() const noexcept
+        {
+            return header_;
+        }
+
+    private:
+        slot_header* header_;
+        char* data_;
+        std::size_t capacity_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A POSIX shared memory object holding a fixed number of ring buffer
+    // slots. Every locality creates (and owns) exactly one segment through
+    // which it receives parcels; peers on the same host map it to send.
+    class HPX_EXPORT segment
+    {
+        segment(segment const&) = delete;
+        segment(segment&&) = delete;
+        segment& operator=(segment const&) = delete;
+        segment& operator=(segment&&) = delete;
+
+    public:
+        segment(std::string const& name, void* base, std::size_t size,
+            bool owner) noexcept;
+        ~segment();
+
+        // Create and initialize a new segment owned by this locality.
+        static std::shared_ptr<segment> create(std::string const& name,
+            std::size_t num_slots, std::size_t ring_size,
+            error_code& ec = throws);
+
+        // Map an existing segment owned by another locality.
+        static std::shared_ptr<segment> open(
+            std::string const& name, error_code& ec = throws);
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        // Remove the name of a segment owned by this locality, existing
+        // mappings stay valid.
+        void remove() noexcept;
+
+        std::size_t num_slots() const noexcept;
+
+        ring get_ring(std::size_t slot) const noexcept;
+
+        // Claim a free slot for a new sending connection, returns
+        // num_slots() if none is available.
+        std::size_t acquire_slot() noexcept;
+
+        // Sender side: no more data will be written to the slot.
+        void release_slot(std::size_t slot) noexcept;
+
+        // Receiver side: the slot has been drained and may be reused.
+        void reset_slot(std::size_t slot) noexcept;
+
+    private:
+        slot_header* get_slot(std::size_t slot) const noexcept;
+
+        std::string name_;
+        void* base_;
+        std::size_t size_;
+        bool owner_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,290 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    class sender_connection;
+
+    inline void add_connection(
+        sender*, std::shared_ptr<sender_connection> const&);
+
+    // An outgoing connection owns one slot in the segment of the destination
+    // locality. Messages are streamed into the slot's ring buffer using the
+    // same framing as the TCP parcelport. Zero-copy chunks are copied
+    // straight from the memory referenced by the serialization chunk into
+    // shared memory, no intermediate buffer or kernel copy is involved.
+    class sender_connection
+      : public parcelset::parcelport_connection<sender_connection,
+            std::vector<char>>
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+        using write_buffer_type = std::pair<void const*, std::size_t>;
+
+    public:
+        sender_connection(sender* s, std::shared_ptr<segment> seg,
+            std::size_t slot, parcelset::locality const& there,
+            parcelset::parcelport* pp)
+          : sender_(s)
+          , segment_(HPX_MOVE(seg))
+          , slot_(slot)
+          , ring_(segment_->get_ring(slot))
+          , current_(0)
+          , offset_(0)
+          , there_(there)
+          , pp_(pp)
+        {
+        }
+
+        ~sender_connection()
+        {
+            segment_->release_slot(slot_);
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) const noexcept
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+
+            // describe the message using the wire format of the TCP
+            // parcelport: header, chunk descriptions, main buffer, and the
+            // zero-copy chunks
+            buffers_.clear();
+            current_ = 0;
+            offset_ = 0;
+
+            add_buffer(&buffer_.size_, sizeof(buffer_.size_));
+            add_buffer(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_buffer(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+                add_buffer(buffer_.data_.data(), buffer_.data_.size());
+
+                for (serialization::serialization_chunk& c : buffer_.chunks_)
+                {
+                    if (c.type_ ==
+                        serialization::chunk_type::chunk_type_pointer)
+                    {
+                        add_buffer(c.data_.cpos_, c.size_);
+                    }
+                }
+            }
+            else
+            {
+                add_buffer(buffer_.data_.data(), buffer_.data_.size());
+            }
+
+            handler_ = HPX_FORWARD(Handler, handler);
+
+            if (!send())
+            {
+                // the ring is full, the remaining data will be written from
+                // the background work of the parcelport
+                postprocess_handler_ =
+                    HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                std::error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Write as much of the pending message as fits into the ring, returns
+        // true if the message was sent completely.
+        bool send()
+        {
+            while (current_ != buffers_.size())
+            {
+                write_buffer_type const& b = buffers_[current_];
+
+                offset_ += ring_.write(
+                    static_cast<char const*>(b.first) + offset_,
+                    b.second - offset_);
+
+                if (offset_ != b.second)
+                {
+                    return false;
+                }
+
+                ++current_;
+                offset_ = 0;
+            }
+            return done();
+        }
+
+    private:
+        friend struct sender;
+
+        void add_buffer(void const* data, std::size_t size)
+        {
+            buffers_.emplace_back(data, size);
+        }
+
+        bool done()
+        {
+            std::error_code ec;
+            handler_(ec);
+            handler_.reset();
+
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+            buffers_.clear();
+
+            return true;
+        }
+
+        sender* sender_;
+
+        std::shared_ptr<segment> segment_;
+        std::size_t slot_;
+        ring ring_;
+
+        // pending message and the current write position inside of it
+        std::vector<write_buffer_type> buffers_;
+        std::size_t current_;
+        std::size_t offset_;
+
+        postprocess_handler_type handler_;
+        hpx::move_only_function<void(std::error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender_connection>)>
+            postprocess_handler_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+
+        // Counters and their data containers.
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keeps track of all connections which could not write their message in
+    // one go because the destination ring was full.
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        connection_ptr create_connection(std::shared_ptr<segment> seg,
+            std::size_t slot, parcelset::locality const& there,
+            parcelset::parcelport* pp)
+        {
+            return std::make_shared<connection_type>(
+                this, HPX_MOVE(seg), slot, there, pp);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            if (connection->send())
+            {
+                std::error_code ec;
+                hpx::move_only_function<void(std::error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        hpx::lcos::local::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+
+    inline void add_connection(
+        sender* s, std::shared_ptr<sender_connection> const& ptr)
+    {
+        s->add(ptr);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
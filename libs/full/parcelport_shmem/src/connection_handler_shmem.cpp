@@ -0,0 +1,255 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        std::string get_host_name()
+        {
+            char name[256] = {0};
+            if (::gethostname(name, sizeof(name) - 1) != 0)
+            {
+                return "localhost";
+            }
+            return name;
+        }
+    }    // namespace
+
+    parcelset::locality parcelport_address(
+        util::runtime_configuration const& ini)
+    {
+        // every process owns exactly one segment, make its name unique on
+        // this host. The random suffix avoids clashes with segments left
+        // behind by a process which had the same id (or runs in another pid
+        // namespace), those are never removed by another process.
+        std::string name = ini.get_entry("hpx.parcel.shmem.prefix", "/hpx.");
+        name += std::to_string(::getpid());
+        name += '.';
+        name += std::to_string(std::random_device{}());
+
+        return parcelset::locality(locality(get_host_name(), name));
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(ini), notifier)
+      , stopped_(false)
+      , num_slots_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.slots", 64))
+      , ring_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.ring_size", 262144))
+      , receiver_(*this)
+    {
+        if (here_.type() != std::string("shmem"))
+        {
+            HPX_THROW_EXCEPTION(network_error,
+                "shmem::connection_handler::connection_handler",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+    }
+
+    connection_handler::~connection_handler() = default;
+
+    bool connection_handler::do_run()
+    {
+        segment_ = segment::create(
+            here_.get<locality>().segment(), num_slots_, ring_size_);
+        receiver_.run(segment_);
+
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+            io_service_pool_.get_io_service(int(i)).post(hpx::util::bind(
+                &connection_handler::io_service_work, this));
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        while (do_background_work(0, parcelport_background_mode_all))
+        {
+            if (threads::get_self_ptr())
+            {
+                hpx::this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "shmem::connection_handler::do_stop");
+            }
+        }
+        stopped_ = true;
+
+        receiver_.stop();
+        {
+            std::lock_guard<lcos::local::spinlock> l(segments_mtx_);
+            segments_.clear();
+        }
+
+        // no other locality can connect from now on, the memory itself stays
+        // mapped until this parcelport is destroyed
+        if (segment_)
+        {
+            segment_->remove();
+        }
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return here_.get<locality>().host();
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& l, bool /* use_alternative_parcelport */)
+    {
+        locality const& dest = l.get<locality>();
+        if (stopped_ || dest.host() != here_.get<locality>().host())
+        {
+            return false;
+        }
+
+        // the destination may run in a different container sharing the host
+        // name, fall back to another parcelport if its segment is invisible
+        error_code ec(lightweight);
+        return get_segment(dest.segment(), ec) != nullptr;
+    }
+
+    std::shared_ptr<sender_connection> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        std::shared_ptr<segment> seg =
+            get_segment(l.get<locality>().segment(), ec);
+        if (!seg)
+        {
+            // give back the slot reserved by the connection cache
+            connection_cache_.clear(l, std::shared_ptr<sender_connection>());
+            return std::shared_ptr<sender_connection>();
+        }
+
+        std::size_t const slot = seg->acquire_slot();
+        if (slot == seg->num_slots())
+        {
+            // All slots of the destination are in use. The pending parcels
+            // will be sent once another connection becomes available.
+            connection_cache_.clear(l, std::shared_ptr<sender_connection>());
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::shared_ptr<sender_connection>();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return sender_.create_connection(HPX_MOVE(seg), slot, l, this);
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport is never used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode mode)
+    {
+        if (stopped_)
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode_send)
+        {
+            has_work = sender_.background_work();
+        }
+        if (mode & parcelport_background_mode_receive)
+        {
+            has_work = receiver_.background_work(num_thread) || has_work;
+        }
+        return has_work;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            bool has_work = sender_.background_work();
+            has_work = receiver_.background_work(std::size_t(-1)) || has_work;
+            if (has_work)
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::shmem::connection_handler::"
+                    "io_service_work");
+            }
+        }
+    }
+
+    std::shared_ptr<segment> connection_handler::get_segment(
+        std::string const& name, error_code& ec)
+    {
+        std::lock_guard<lcos::local::spinlock> l(segments_mtx_);
+
+        auto it = segments_.find(name);
+        if (it != segments_.end())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return it->second;
+        }
+
+        // failures are not remembered as the destination may not have
+        // created its segment yet
+        std::shared_ptr<segment> seg = segment::open(name, ec);
+        if (seg)
+        {
+            segments_.emplace(name, seg);
+        }
+        return seg;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,55 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 50
+    //
+    // The priority is higher than the one of the TCP parcelport to make sure
+    // this parcelport is preferred for localities on the same host.
+    template <>
+    struct plugin_config_data<
+        hpx::parcelset::policies::shmem::connection_handler>
+    {
+        static constexpr char const* priority() noexcept
+        {
+            return "50";
+        }
+
+        static constexpr void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */) noexcept
+        {
+        }
+
+        static constexpr void destroy() noexcept {}
+
+        static constexpr char const* call() noexcept
+        {
+            return "slots = ${HPX_PARCEL_SHMEM_SLOTS:64}\n"
+                   "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:262144}\n"
+                   "prefix = ${HPX_PARCEL_SHMEM_PREFIX:/hpx.}\n";
+        }
+    };
+}    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler, shmem)
+
+#endif
@@ -0,0 +1,322 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // "hpx-shm1"
+        constexpr std::uint64_t segment_magic = 0x6870782d73686d31ull;
+
+        struct segment_header
+        {
+            std::atomic<std::uint64_t> magic_;
+            std::uint64_t num_slots_;
+            std::uint64_t ring_size_;
+        };
+
+        constexpr std::size_t first_slot_offset() noexcept
+        {
+            constexpr std::size_t alignment = alignof(slot_header);
+            return (sizeof(segment_header) + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr std::size_t slot_stride(std::size_t ring_size) noexcept
+        {
+            return sizeof(slot_header) + ring_size;
+        }
+
+        std::size_t round_up_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 4096;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        segment_header* get_header(void* base) noexcept
+        {
+            return static_cast<segment_header*>(base);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t ring::write(void const* src, std::size_t size) noexcept
+    {
+        std::uint64_t const head =
+            header_->head_.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            header_->tail_.load(std::memory_order_acquire);
+
+        std::size_t const available =
+            capacity_ - static_cast<std::size_t>(head - tail);
+        std::size_t const count = (std::min)(size, available);
+        if (count == 0)
+            return 0;
+
+        // copy in at most two pieces to account for wrapping around
+        std::size_t const pos =
+            static_cast<std::size_t>(head) & (capacity_ - 1);
+        std::size_t const first = (std::min)(count, capacity_ - pos);
+
+        std::memcpy(data_ + pos, src, first);
+        if (first != count)
+        {
+            std::memcpy(
+                data_, static_cast<char const*>(src) + first, count - first);
+        }
+
+        header_->head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    std::size_t ring::read(void* dst, std::size_t size) noexcept
+    {
+        std::uint64_t const tail =
+            header_->tail_.load(std::memory_order_relaxed);
+        std::uint64_t const head =
+            header_->head_.load(std::memory_order_acquire);
+
+        std::size_t const available = static_cast<std::size_t>(head - tail);
+        std::size_t const count = (std::min)(size, available);
+        if (count == 0)
+            return 0;
+
+        std::size_t const pos =
+            static_cast<std::size_t>(tail) & (capacity_ - 1);
+        std::size_t const first = (std::min)(count, capacity_ - pos);
+
+        std::memcpy(dst, data_ + pos, first);
+        if (first != count)
+        {
+            std::memcpy(static_cast<char*>(dst) + first, data_, count - first);
+        }
+
+        header_->tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    segment::segment(std::string const& name, void* base, std::size_t size,
+        bool owner) noexcept
+      : name_(name)
+      , base_(base)
+      , size_(size)
+      , owner_(owner)
+    {
+    }
+
+    segment::~segment()
+    {
+        remove();
+        ::munmap(base_, size_);
+    }
+
+    void segment::remove() noexcept
+    {
+        if (owner_)
+        {
+            ::shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+
+    std::shared_ptr<segment> segment::create(std::string const& name,
+        std::size_t num_slots, std::size_t ring_size, error_code& ec)
+    {
+        ring_size = round_up_power_of_two(ring_size);
+        std::size_t const size =
+            first_slot_offset() + num_slots * slot_stride(ring_size);
+
+        // never take over an existing segment, it may still be in use by
+        // another process
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                "shm_open failed for '{}': {}", name, std::strerror(errno));
+            return std::shared_ptr<segment>();
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            int const error = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                "ftruncate failed for '{}': {}", name, std::strerror(error));
+            return std::shared_ptr<segment>();
+        }
+
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const error = errno;
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                "mmap failed for '{}': {}", name, std::strerror(error));
+            return std::shared_ptr<segment>();
+        }
+
+        // the memory is zero-initialized, construct the atomics in place
+        segment_header* header = new (base) segment_header;
+        header->num_slots_ = num_slots;
+        header->ring_size_ = ring_size;
+
+        char* slots = static_cast<char*>(base) + first_slot_offset();
+        for (std::size_t i = 0; i != num_slots; ++i)
+        {
+            slot_header* slot =
+                new (slots + i * slot_stride(ring_size)) slot_header;
+            slot->state_.store(static_cast<std::uint32_t>(slot_state::free),
+                std::memory_order_relaxed);
+            slot->head_.store(0, std::memory_order_relaxed);
+            slot->tail_.store(0, std::memory_order_relaxed);
+        }
+
+        // publish the fully initialized segment
+        header->magic_.store(segment_magic, std::memory_order_release);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return std::make_shared<segment>(name, base, size, true);
+    }
+
+    std::shared_ptr<segment> segment::open(
+        std::string const& name, error_code& ec)
+    {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "shm_open failed for '{}': {}", name, std::strerror(errno));
+            return std::shared_ptr<segment>();
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1 ||
+            static_cast<std::size_t>(st.st_size) < first_slot_offset())
+        {
+            ::close(fd);
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "shared memory segment '{}' has unexpected size", name);
+            return std::shared_ptr<segment>();
+        }
+
+        std::size_t const size = static_cast<std::size_t>(st.st_size);
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const error = errno;
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "mmap failed for '{}': {}", name, std::strerror(error));
+            return std::shared_ptr<segment>();
+        }
+
+        segment_header* header = get_header(base);
+        if (header->magic_.load(std::memory_order_acquire) != segment_magic ||
+            first_slot_offset() +
+                    header->num_slots_ * slot_stride(header->ring_size_) >
+                size)
+        {
+            ::munmap(base, size);
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "shared memory segment '{}' is not (yet) initialized", name);
+            return std::shared_ptr<segment>();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return std::make_shared<segment>(name, base, size, false);
+    }
+
+    std::size_t segment::num_slots() const noexcept
+    {
+        return static_cast<std::size_t>(get_header(base_)->num_slots_);
+    }
+
+    slot_header* segment::get_slot(std::size_t slot) const noexcept
+    {
+        HPX_ASSERT(slot < num_slots());
+        std::size_t const ring_size =
+            static_cast<std::size_t>(get_header(base_)->ring_size_);
+        return reinterpret_cast<slot_header*>(static_cast<char*>(base_) +
+            first_slot_offset() + slot * slot_stride(ring_size));
+    }
+
+    ring segment::get_ring(std::size_t slot) const noexcept
+    {
+        slot_header* header = get_slot(slot);
+        return ring(header, reinterpret_cast<char*>(header + 1),
+            static_cast<std::size_t>(get_header(base_)->ring_size_));
+    }
+
+    std::size_t segment::acquire_slot() noexcept
+    {
+        std::size_t const count = num_slots();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            std::uint32_t expected =
+                static_cast<std::uint32_t>(slot_state::free);
+            if (get_slot(i)->state_.compare_exchange_strong(expected,
+                    static_cast<std::uint32_t>(slot_state::connected),
+                    std::memory_order_acq_rel))
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    void segment::release_slot(std::size_t slot) noexcept
+    {
+        get_slot(slot)->state_.store(
+            static_cast<std::uint32_t>(slot_state::closing),
+            std::memory_order_release);
+    }
+
+    void segment::reset_slot(std::size_t slot) noexcept
+    {
+        slot_header* header = get_slot(slot);
+        header->head_.store(0, std::memory_order_relaxed);
+        header->tail_.store(0, std::memory_order_relaxed);
+        header->state_.store(static_cast<std::uint32_t>(slot_state::free),
+            std::memory_order_release);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,193 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using hpx::parcelset::policies::shmem::ring;
+using hpx::parcelset::policies::shmem::segment;
+using hpx::parcelset::policies::shmem::slot_header;
+
+///////////////////////////////////////////////////////////////////////////////
+std::string segment_name(char const* test)
+{
+    return "/hpx.test." + std::to_string(::getpid()) + "." + test;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_full_empty()
+{
+    constexpr std::size_t capacity = 64;
+
+    slot_header header{};
+    std::vector<char> data(capacity);
+    ring r(&header, data.data(), capacity);
+
+    char buffer[2 * capacity];
+    std::iota(buffer, buffer + sizeof(buffer), char(0));
+
+    HPX_TEST(r.empty());
+    HPX_TEST_EQ(r.read(buffer, 1), std::size_t(0));
+
+    // only 'capacity' bytes are accepted, nothing more fits afterwards
+    HPX_TEST_EQ(r.write(buffer, sizeof(buffer)), capacity);
+    HPX_TEST(!r.empty());
+    HPX_TEST_EQ(r.write(buffer, 1), std::size_t(0));
+
+    // reading frees space again
+    char result[2 * capacity] = {};
+    HPX_TEST_EQ(r.read(result, 16), std::size_t(16));
+    HPX_TEST_EQ(r.write(buffer + capacity, sizeof(buffer)), std::size_t(16));
+    HPX_TEST_EQ(r.read(result + 16, sizeof(result)), capacity);
+    HPX_TEST(r.empty());
+
+    for (std::size_t i = 0; i != capacity + 16; ++i)
+    {
+        HPX_TEST_EQ(result[i], buffer[i]);
+    }
+}
+
+void test_wraparound()
+{
+    constexpr std::size_t capacity = 64;
+
+    slot_header header{};
+    std::vector<char> data(capacity);
+    ring r(&header, data.data(), capacity);
+
+    // messages of a size not dividing the capacity end up being split at
+    // the end of the buffer, the positions keep increasing beyond it
+    char message[27];
+    char result[27];
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        std::iota(message, message + sizeof(message), char(i));
+
+        HPX_TEST_EQ(r.write(message, sizeof(message)), sizeof(message));
+        HPX_TEST_EQ(r.read(result, sizeof(result)), sizeof(result));
+        HPX_TEST(r.empty());
+
+        for (std::size_t j = 0; j != sizeof(message); ++j)
+        {
+            HPX_TEST_EQ(result[j], message[j]);
+        }
+    }
+    HPX_TEST_EQ(header.head_.load(), std::uint64_t(100 * sizeof(message)));
+    HPX_TEST_EQ(header.tail_.load(), std::uint64_t(100 * sizeof(message)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_slots()
+{
+    std::shared_ptr<segment> owner =
+        segment::create(segment_name("slots"), 2, 4096);
+    HPX_TEST_EQ(owner->num_slots(), std::size_t(2));
+
+    std::shared_ptr<segment> peer = segment::open(owner->name());
+    HPX_TEST_EQ(peer->num_slots(), std::size_t(2));
+
+    // all slots can be claimed exactly once
+    std::size_t const slot0 = peer->acquire_slot();
+    std::size_t const slot1 = peer->acquire_slot();
+    HPX_TEST(slot0 != slot1);
+    HPX_TEST(slot0 < 2 && slot1 < 2);
+    HPX_TEST_EQ(peer->acquire_slot(), std::size_t(2));
+
+    // a released slot is reused only after the receiver has reset it
+    peer->release_slot(slot0);
+    HPX_TEST_EQ(peer->acquire_slot(), std::size_t(2));
+    owner->reset_slot(slot0);
+    HPX_TEST_EQ(peer->acquire_slot(), slot0);
+
+    // a segment in use is never replaced by a new one of the same name
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    HPX_TEST(!segment::create(owner->name(), 2, 4096, ec));
+    HPX_TEST(ec);
+    HPX_TEST(segment::open(owner->name()));
+
+    // opening a segment which does not exist fails
+    owner->remove();
+    ec = hpx::error_code(hpx::throwmode::lightweight);
+    HPX_TEST(!segment::open(owner->name(), ec));
+    HPX_TEST(ec);
+}
+
+// one thread streams data through a slot of a mapped segment while another
+// one reads it through the owner's mapping
+void test_send_receive()
+{
+    constexpr std::size_t size = 1024 * 1024;
+
+    std::shared_ptr<segment> owner =
+        segment::create(segment_name("send_receive"), 1, 4096);
+    std::shared_ptr<segment> peer = segment::open(owner->name());
+
+    std::size_t const slot = peer->acquire_slot();
+    HPX_TEST_EQ(slot, std::size_t(0));
+
+    std::vector<std::uint32_t> sent(size / sizeof(std::uint32_t));
+    std::iota(sent.begin(), sent.end(), std::uint32_t(0));
+
+    std::thread sender([&]() {
+        ring r = peer->get_ring(slot);
+        char const* data = reinterpret_cast<char const*>(sent.data());
+        std::size_t written = 0;
+        while (written != size)
+        {
+            // odd sizes make the writes straddle the end of the ring
+            written += r.write(
+                data + written, (std::min)(size - written, std::size_t(1001)));
+        }
+        peer->release_slot(slot);
+    });
+
+    std::vector<std::uint32_t> received(sent.size());
+    ring r = owner->get_ring(slot);
+    char* data = reinterpret_cast<char*>(received.data());
+    std::size_t read = 0;
+    while (read != size)
+    {
+        read += r.read(data + read, (std::min)(size - read, std::size_t(777)));
+    }
+
+    sender.join();
+
+    HPX_TEST(r.empty());
+    HPX_TEST(received == sent);
+
+    owner->reset_slot(slot);
+    HPX_TEST_EQ(peer->acquire_slot(), slot);
+}
+
+int main()
+{
+    test_full_empty();
+    test_wraparound();
+    test_slots();
+    test_send_receive();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,74 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Sends messages of increasing size to all other localities and back. The
+// larger messages exceed the size of the ring buffers (set to 4096 bytes
+// below) and carry zero-copy chunks. This exercises the partial writes
+// which are completed by the background work of the parcelport.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<double> echo(std::vector<double> const& data)
+{
+    return data;
+}
+HPX_PLAIN_ACTION(echo)
+
+void test_echo(hpx::id_type const& id)
+{
+    for (std::size_t size = 1; size <= 1024 * 1024; size *= 4)
+    {
+        std::vector<double> data(size);
+        std::iota(data.begin(), data.end(), 0.0);
+
+        // send several messages concurrently to have them queue up behind
+        // each other
+        std::vector<hpx::future<std::vector<double>>> results;
+        for (std::size_t i = 0; i != 4; ++i)
+        {
+            results.push_back(hpx::async<echo_action>(id, data));
+        }
+
+        for (auto& f : results)
+        {
+            HPX_TEST(f.get() == data);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_echo(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use small ring buffers to force messages to wrap around
+    hpx::init_params init_args;
+    init_args.cfg = {"hpx.parcel.shmem.ring_size=4096"};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -22,6 +22,7 @@
 #include <asio/ip/tcp.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -121,6 +122,11 @@ namespace hpx::parcelset {
                 std::set<std::shared_ptr<receiver>>;
             accepted_connections_set accepted_connections_;
 
+            // flow control settings for the connections (see sender and
+            // receiver)
+            std::uint32_t send_window_;
+            std::uint32_t credit_batch_;
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
             using write_connections_set = std::set<std::weak_ptr<sender>>;
             write_connections_set write_connections_;
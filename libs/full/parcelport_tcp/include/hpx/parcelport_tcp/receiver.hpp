@@ -50,16 +50,22 @@ namespace hpx::parcelset::policies::tcp {
 
     class connection_handler;
 
+    // The receiver returns credits to the sender for all messages it has
+    // decoded, either after 'credit_batch' messages or as soon as no further
+    // data is available on the socket. The latter guarantees progress for
+    // senders using a window smaller than the batch size.
     class receiver
       : public parcelport_connection<receiver, std::vector<char>,
             std::vector<char>>
     {
     public:
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, std::uint32_t credit_batch = 1)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
-          , ack_(0)
+          , credit_batch_(credit_batch != 0 ? credit_batch : 1)
+          , credits_(0)
+          , credits_sent_(0)
           , parcelport_(parcelport)
           , timer_()
           , mtx_()
@@ -328,15 +334,10 @@ namespace hpx::parcelset::policies::tcp {
                 buffer_.data_point_.time_ =
                     timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
 
-                // now send acknowledgment byte
-                void (receiver::*f)(std::error_code const&, Handler) =
-                    &receiver::handle_write_ack<Handler>;
-
                 // decode the received parcels.
                 decode_parcels(parcelport_, HPX_MOVE(buffer_), std::size_t(-1));
                 buffer_ = parcel_buffer_type();
 
-                ack_ = true;
                 {
                     std::unique_lock lk(mtx_);
                     if (!socket_.is_open())
@@ -349,8 +350,26 @@ namespace hpx::parcelset::policies::tcp {
                         return;
                     }
 
+                    // the sender is still streaming messages, hold back the
+                    // credits until enough of them have accumulated
+                    std::error_code ec;
+                    if (++credits_ < credit_batch_ &&
+                        socket_.available(ec) != 0 && !ec)
+                    {
+                        lk.unlock();
+                        handle_write_ack(ec, HPX_MOVE(handler));
+                        return;
+                    }
+
+                    // now send the credits back
+                    void (receiver::*f)(std::error_code const&, Handler) =
+                        &receiver::handle_write_ack<Handler>;
+
+                    credits_sent_ = credits_;
+                    credits_ = 0;
+
                     asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
+                        asio::buffer(&credits_sent_, sizeof(credits_sent_)),
                         util::bind(f, shared_from_this(),
                             util::placeholders::_1,    // error,
                             util::protect(handler)));
@@ -379,7 +398,11 @@ namespace hpx::parcelset::policies::tcp {
 
         std::uint64_t max_inbound_size_;
 
-        bool ack_;
+        // number of decoded messages after which credits are sent back, the
+        // number of credits not sent yet, and the buffer used for sending them
+        std::uint32_t credit_batch_;
+        std::uint32_t credits_;
+        std::uint32_t credits_sent_;
 
         // The handler used to process the incoming request.
         connection_handler& parcelport_;
@@ -41,6 +41,7 @@
 #undef VT2
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -48,6 +49,10 @@
 
 namespace hpx::parcelset::policies::tcp {
 
+    // A sender may have up to 'send_window' messages in flight before it has
+    // to wait for the receiver to return credits. Each credit allows for one
+    // more message to be sent. A window of one reproduces the behavior of
+    // waiting for an acknowledgement after each message.
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char>>
     {
@@ -57,9 +62,11 @@ namespace hpx::parcelset::policies::tcp {
     public:
         // Construct a sending parcelport_connection with the given io_context.
         sender(asio::io_context& io_service,
-            parcelset::locality const& locality_id, parcelset::parcelport* pp)
+            parcelset::locality const& locality_id, parcelset::parcelport* pp,
+            std::uint32_t send_window = 1)
           : socket_(io_service)
-          , ack_(0)
+          , credits_(send_window != 0 ? send_window : 1)
+          , credits_received_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
@@ -234,7 +241,17 @@ namespace hpx::parcelset::policies::tcp {
                 timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
 
-            // now handle the acknowledgment byte which is sent by the receiver
+            // the connection can be reused right away as long as there are
+            // credits left
+            HPX_ASSERT(credits_ != 0);
+            if (--credits_ != 0)
+            {
+                handle_read_ack(e);
+                return;
+            }
+
+            // otherwise wait for the receiver to return credits, all credits
+            // returned in the meantime are still waiting on the socket
 #if defined(__linux) || defined(linux) || defined(__linux__)
             asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
                 quickack(true);
@@ -242,12 +259,45 @@ namespace hpx::parcelset::policies::tcp {
 #endif
 
             void (sender::*f)(std::error_code const&) =
-                &sender::handle_read_ack;
+                &sender::handle_read_credits;
 
-            asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
+            asio::async_read(socket_,
+                asio::buffer(&credits_received_, sizeof(credits_received_)),
                 util::bind(f, shared_from_this(), util::placeholders::_1));
         }
 
+        void handle_read_credits(std::error_code const& e)
+        {
+            if (e)
+            {
+                handle_read_ack(e);
+                return;
+            }
+
+            HPX_ASSERT(credits_received_ != 0);
+            credits_ += credits_received_;
+
+            // the receiver may have returned credits several times since the
+            // last read, collect all grants which have arrived completely
+            // (reading them doesn't block)
+            std::error_code ec;
+            std::size_t pending =
+                socket_.available(ec) / sizeof(credits_received_);
+            while (!ec && pending-- != 0)
+            {
+                asio::read(socket_,
+                    asio::buffer(&credits_received_, sizeof(credits_received_)),
+                    ec);
+                if (!ec)
+                {
+                    HPX_ASSERT(credits_received_ != 0);
+                    credits_ += credits_received_;
+                }
+            }
+
+            handle_read_ack(ec);
+        }
+
         void handle_read_ack(std::error_code const& e)
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
@@ -268,7 +318,10 @@ namespace hpx::parcelset::policies::tcp {
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
-        bool ack_;
+        // number of messages which can be sent before waiting for the
+        // receiver, and the buffer receiving new credits
+        std::uint32_t credits_;
+        std::uint32_t credits_received_;
 
         // the other (receiving) end of this connection
         parcelset::locality there_;
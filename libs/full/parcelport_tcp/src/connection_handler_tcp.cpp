@@ -64,6 +64,10 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , send_window_(hpx::util::get_entry_as<std::uint32_t>(
+            ini, "hpx.parcel.tcp.send_window", 16))
+      , credit_batch_(hpx::util::get_entry_as<std::uint32_t>(
+            ini, "hpx.parcel.tcp.credit_batch", 8))
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -96,8 +100,9 @@ namespace hpx::parcelset::policies::tcp {
         {
             try
             {
-                std::shared_ptr<receiver> receiver_conn(new receiver(
-                    io_service, get_max_inbound_message_size(), *this));
+                std::shared_ptr<receiver> receiver_conn(
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, credit_batch_));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -157,7 +162,7 @@ namespace hpx::parcelset::policies::tcp {
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
         std::shared_ptr<sender> sender_connection(
-            new sender(io_service, l, this));
+            new sender(io_service, l, this, send_window_));
 
         // Connect to the target locality, retry if needed
         std::error_code error = asio::error::try_again;
@@ -286,8 +291,8 @@ namespace hpx::parcelset::policies::tcp {
             std::shared_ptr<receiver> c(receiver_conn);
 
             asio::io_context& io_service = io_service_pool_.get_io_service();
-            receiver_conn.reset(new receiver(
-                io_service, get_max_inbound_message_size(), *this));
+            receiver_conn.reset(new receiver(io_service,
+                get_max_inbound_message_size(), *this, credit_batch_));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept, this,
                     util::placeholders::_1, receiver_conn));
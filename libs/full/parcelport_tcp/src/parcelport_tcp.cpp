@@ -21,6 +21,8 @@ namespace hpx::traits {
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      send_window = 16
+    //      credit_batch = 8
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
@@ -39,7 +41,8 @@ namespace hpx::traits {
 
         static constexpr char const* call() noexcept
         {
-            return "";
+            return "send_window = ${HPX_PARCEL_TCP_SEND_WINDOW:16}\n"
+                   "credit_batch = ${HPX_PARCEL_TCP_CREDIT_BATCH:8}\n";
         }
     };
 }    // namespace hpx::traits
@@ -0,0 +1,66 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decides whether a binary filter should compress the data of a message.
+    //
+    // Messages smaller than hpx.parcel.compression.min_size are never
+    // compressed. Whenever compressing a message does not reduce its size to
+    // hpx.parcel.compression.max_ratio (or less), the following messages are
+    // sent uncompressed. The number of messages skipped this way doubles with
+    // each further poor result (up to hpx.parcel.compression.max_backoff),
+    // the first good result resets it.
+    //
+    // Binary filters are expected to use one instance of this class for all
+    // messages they handle.
+    class HPX_EXPORT adaptive_compression
+    {
+    public:
+        adaptive_compression();
+
+        // Return whether a message of the given size should be compressed.
+        bool should_compress(std::size_t size) noexcept;
+
+        // Record the result of compressing a message, return whether the
+        // compressed data should be sent.
+        bool accept(std::size_t size, std::size_t compressed_size) noexcept;
+
+    private:
+        std::size_t min_size_;
+        double max_ratio_;
+        std::size_t max_backoff_;
+
+        std::atomic<std::size_t> backoff_;
+        std::atomic<std::size_t> skip_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statistics collected for all messages handled by adaptive binary
+    // filters
+    HPX_EXPORT std::int64_t get_compressed_message_count(bool reset);
+    HPX_EXPORT std::int64_t get_uncompressed_message_count(bool reset);
+
+    // The overall size of the data sent relative to its size before
+    // compression (in 0.01%)
+    HPX_EXPORT std::int64_t get_compression_ratio(bool reset);
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -166,6 +166,15 @@ namespace hpx::parcelset {
                 {
                     archive_flags = archive_flags |
                         int(serialization::archive_flags::enable_compression);
+
+                    // some filters need to see all data, otherwise larger
+                    // arrays would be sent as (uncompressed) zero-copy chunks
+                    if (filter->disable_data_chunking())
+                    {
+                        archive_flags = archive_flags |
+                            int(serialization::archive_flags::
+                                    disable_data_chunking);
+                    }
                 }
 
                 // preallocate data
@@ -0,0 +1,147 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/parcelset/adaptive_compression.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::parcelset {
+
+    namespace {
+
+        struct compression_statistics
+        {
+            std::atomic<std::int64_t> compressed_{0};
+            std::atomic<std::int64_t> uncompressed_{0};
+            std::atomic<std::int64_t> bytes_in_{0};
+            std::atomic<std::int64_t> bytes_out_{0};
+
+            void add(std::size_t size, std::size_t sent_size,
+                bool compressed) noexcept
+            {
+                ++(compressed ? compressed_ : uncompressed_);
+                bytes_in_ += static_cast<std::int64_t>(size);
+                bytes_out_ += static_cast<std::int64_t>(sent_size);
+            }
+        };
+
+        compression_statistics& statistics() noexcept
+        {
+            static compression_statistics stats;
+            return stats;
+        }
+
+        template <typename T>
+        T get_entry(char const* key, T dflt)
+        {
+            return hpx::util::from_string<T>(
+                hpx::get_config_entry(key, std::to_string(dflt)), dflt);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_compression::adaptive_compression()
+      : min_size_(get_entry<std::size_t>(
+            "hpx.parcel.compression.min_size", 4096))
+      , max_ratio_(get_entry<double>("hpx.parcel.compression.max_ratio", 0.9))
+      , max_backoff_(get_entry<std::size_t>(
+            "hpx.parcel.compression.max_backoff", 256))
+      , backoff_(0)
+      , skip_(0)
+    {
+    }
+
+    bool adaptive_compression::should_compress(std::size_t size) noexcept
+    {
+        if (size >= min_size_)
+        {
+            // send the message uncompressed if we are backing off
+            std::size_t skip = skip_.load(std::memory_order_relaxed);
+            while (skip != 0)
+            {
+                if (skip_.compare_exchange_weak(
+                        skip, skip - 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+
+            if (skip == 0)
+            {
+                return true;
+            }
+        }
+
+        statistics().add(size, size, false);
+        return false;
+    }
+
+    bool adaptive_compression::accept(
+        std::size_t size, std::size_t compressed_size) noexcept
+    {
+        if (static_cast<double>(compressed_size) <=
+            max_ratio_ * static_cast<double>(size))
+        {
+            backoff_.store(0, std::memory_order_relaxed);
+        }
+        else
+        {
+            // skip twice as many messages as last time
+            std::size_t backoff = backoff_.load(std::memory_order_relaxed);
+            backoff = (std::min)(
+                backoff == 0 ? std::size_t(1) : 2 * backoff, max_backoff_);
+
+            backoff_.store(backoff, std::memory_order_relaxed);
+            skip_.store(backoff, std::memory_order_relaxed);
+        }
+
+        // never send more data than necessary
+        bool const use_compressed = compressed_size < size;
+        statistics().add(size, use_compressed ? compressed_size : size,
+            use_compressed);
+        return use_compressed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_compressed_message_count(bool reset)
+    {
+        return util::get_and_reset_value(statistics().compressed_, reset);
+    }
+
+    std::int64_t get_uncompressed_message_count(bool reset)
+    {
+        return util::get_and_reset_value(statistics().uncompressed_, reset);
+    }
+
+    std::int64_t get_compression_ratio(bool reset)
+    {
+        std::int64_t const bytes_in =
+            util::get_and_reset_value(statistics().bytes_in_, reset);
+        std::int64_t const bytes_out =
+            util::get_and_reset_value(statistics().bytes_out_, reset);
+
+        if (bytes_in == 0)
+        {
+            return 0;
+        }
+        return static_cast<std::int64_t>(
+            static_cast<double>(bytes_out) * 10000. /
+            static_cast<double>(bytes_in));
+    }
+}    // namespace hpx::parcelset
+
+#endif
@@ -1250,6 +1250,15 @@ namespace hpx::parcelset {
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:0}");
 #endif
 
+        // settings for binary filters compressing messages adaptively
+        ini_defs.emplace_back("[hpx.parcel.compression]");
+        ini_defs.emplace_back(
+            "min_size = ${HPX_PARCEL_COMPRESSION_MIN_SIZE:4096}");
+        ini_defs.emplace_back(
+            "max_ratio = ${HPX_PARCEL_COMPRESSION_MAX_RATIO:0.9}");
+        ini_defs.emplace_back(
+            "max_backoff = ${HPX_PARCEL_COMPRESSION_MAX_BACKOFF:256}");
+
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
         {
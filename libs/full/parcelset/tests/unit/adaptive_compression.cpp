@@ -0,0 +1,92 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/adaptive_compression.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::adaptive_compression;
+
+// make sure the next num_skipped messages are not compressed
+void test_skipped(adaptive_compression& policy, std::size_t num_skipped)
+{
+    for (std::size_t i = 0; i != num_skipped; ++i)
+    {
+        HPX_TEST(!policy.should_compress(200));
+    }
+    HPX_TEST(policy.should_compress(200));
+}
+
+int hpx_main()
+{
+    adaptive_compression policy;
+
+    // small messages are never compressed
+    HPX_TEST(!policy.should_compress(50));
+
+    // good results don't change anything
+    HPX_TEST(policy.should_compress(200));
+    HPX_TEST(policy.accept(200, 50));
+    test_skipped(policy, 0);
+
+    // poor results lead to skipping an increasing number of messages
+    HPX_TEST(policy.accept(200, 150));
+    test_skipped(policy, 1);
+
+    HPX_TEST(policy.accept(200, 150));
+    test_skipped(policy, 2);
+
+    // data which grows is sent uncompressed
+    HPX_TEST(!policy.accept(200, 250));
+    test_skipped(policy, 4);
+
+    HPX_TEST(policy.accept(200, 150));
+    test_skipped(policy, 4);    // max_backoff
+
+    // a good result resets the backoff
+    HPX_TEST(policy.accept(200, 50));
+    test_skipped(policy, 0);
+    HPX_TEST(policy.accept(200, 150));
+    test_skipped(policy, 1);
+
+    // 6 messages were compressed, 1 + 12 were skipped, 1 has grown
+    HPX_TEST_EQ(hpx::parcelset::get_compressed_message_count(false),
+        std::int64_t(6));
+    HPX_TEST_EQ(hpx::parcelset::get_uncompressed_message_count(true),
+        std::int64_t(14));
+    HPX_TEST_EQ(hpx::parcelset::get_uncompressed_message_count(false),
+        std::int64_t(0));
+
+    std::int64_t const bytes_in = 50 + 19 * 200;
+    std::int64_t const bytes_out = 50 + 2 * 50 + 4 * 150 + 13 * 200;
+    HPX_TEST_EQ(hpx::parcelset::get_compression_ratio(false),
+        bytes_out * 10000 / bytes_in);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.compression.min_size=100",
+        "hpx.parcel.compression.max_ratio=0.5",
+        "hpx.parcel.compression.max_backoff=4"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
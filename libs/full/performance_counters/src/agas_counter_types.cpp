@@ -67,6 +67,13 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> refcnt_aggregated_count(
+            util::bind_front(
+                &agas::addressing_service::get_refcnt_aggregated_count,
+                &client));
+        hpx::function<std::int64_t(bool)> refcnt_sent_count(util::bind_front(
+            &agas::addressing_service::get_refcnt_sent_count, &client));
+
         using util::placeholders::_1;
         using util::placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -185,6 +192,24 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/aggregated",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of credit decrement requests which "
+                    "were buffered for being sent in aggregated form",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_aggregated_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/sent",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of messages sent for the aggregated "
+                    "credit decrement requests",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_sent_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -9,6 +9,7 @@
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/parcelset/adaptive_compression.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
@@ -479,7 +480,37 @@ namespace hpx::performance_counters {
                     util::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_routed_count, _2),
-                    &performance_counters::locality_counter_discoverer, ""}};
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/serialize/count/compressed",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of messages which were sent compressed "
+                    "by the adaptive binary filters (lz4, zstd)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        &parcelset::get_compressed_message_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/serialize/count/uncompressed",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of messages which were sent "
+                    "uncompressed by the adaptive binary filters (lz4, zstd) "
+                    "as compressing them was not expected to pay off",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        &parcelset::get_uncompressed_message_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/serialize/compression-ratio",
+                    performance_counters::counter_raw,
+                    "returns the overall size of the data sent by the adaptive "
+                    "binary filters (lz4, zstd) relative to its size before "
+                    "compression",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        &parcelset::get_compression_ratio, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "0.01%"}};
 
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
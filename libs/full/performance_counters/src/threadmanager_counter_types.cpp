@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -20,6 +21,7 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/detail/thread_data_allocator.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -437,6 +439,9 @@ namespace hpx { namespace performance_counters {
     ///////////////////////////////////////////////////////////////////////////
     void register_threadmanager_counter_types(threads::threadmanager& tm)
     {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
         create_counter_func counts_creator(
             util::bind_front(&detail::thread_counts_counter_creator));
@@ -697,6 +702,82 @@ namespace hpx { namespace performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+            {"/threads/count/slab-hits", counter_monotonically_increasing,
+                "returns the number of HPX-thread objects allocated from the "
+                "per-worker-thread slab caches for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    &threads::detail::get_thread_data_allocator_hits, _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/slab-misses", counter_monotonically_increasing,
+                "returns the number of HPX-thread object allocations which "
+                "required a new slab for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    &threads::detail::get_thread_data_allocator_misses, _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/slab-remote-frees",
+                counter_monotonically_increasing,
+                "returns the number of HPX-thread objects freed by a "
+                "worker-thread other than the one which allocated them for "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    &threads::detail::get_thread_data_allocator_remote_frees,
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/timers/armed", counter_monotonically_increasing,
+                "returns the number of timers armed for timed suspensions of "
+                "HPX-threads by the referenced worker-thread on the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_armed_timers_count,
+                    &threads::thread_pool_base::get_armed_timers_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/timers/fired", counter_monotonically_increasing,
+                "returns the number of timers which have expired on the "
+                "referenced worker-thread on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_fired_timers_count,
+                    &threads::thread_pool_base::get_fired_timers_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/timers/cancelled",
+                counter_monotonically_increasing,
+                "returns the number of timers which have been cancelled before "
+                "they expired on the referenced worker-thread on the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_cancelled_timers_count,
+                    &threads::thread_pool_base::get_cancelled_timers_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/parks", counter_monotonically_increasing,
+                "returns the number of times the referenced worker-thread on "
+                "the referenced locality has parked while being idle",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_idle_park_count,
+                    &threads::thread_pool_base::get_idle_park_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/parked-wakeups", counter_monotonically_increasing,
+                "returns the number of times the referenced worker-thread on "
+                "the referenced locality has been woken up from being parked "
+                "because new work was made available",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_idle_wakeup_count,
+                    &threads::thread_pool_base::get_idle_wakeup_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/time/parked", counter_elapsed_time,
+                "returns the overall time the referenced worker-thread on the "
+                "referenced locality has spent parked while being idle",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_idle_parked_time,
+                    &threads::thread_pool_base::get_idle_parked_time),
+                &locality_pool_thread_counter_discoverer, "ns"},
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses", counter_monotonically_increasing,
                 "returns the number of times that the referenced worker-thread "
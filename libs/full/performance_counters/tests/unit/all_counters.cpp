@@ -83,7 +83,9 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
-    "/scheduler/utilization/instantaneous", nullptr};
+    "/threads/count/slab-hits", "/threads/count/slab-misses",
+    "/threads/count/slab-remote-frees", "/scheduler/utilization/instantaneous",
+    nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
 void test_all_locality_thread_counters(char const* const* counter_names,
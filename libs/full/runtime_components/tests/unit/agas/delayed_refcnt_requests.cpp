@@ -0,0 +1,108 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that buffered credit decrements are sent after
+// hpx.agas.max_pending_refcnt_delay milliseconds, even if the buffer is not
+// full and no garbage collection is triggered explicitly.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "components/managed_refcnt_checker.hpp"
+#include "components/simple_refcnt_checker.hpp"
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using std::chrono::milliseconds;
+
+using hpx::naming::id_type;
+
+using hpx::test::managed_refcnt_monitor;
+using hpx::test::simple_refcnt_monitor;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter_value(char const* name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Client>
+void hpx_test_main(variables_map& vm)
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+
+    std::int64_t const aggregated =
+        get_counter_value("/agas{locality#0/total}/count/refcnt/aggregated");
+    std::int64_t const sent =
+        get_counter_value("/agas{locality#0/total}/count/refcnt/sent");
+
+    {
+        Client monitor(hpx::find_here());
+
+        {
+            // Detach the reference.
+            id_type id = monitor.detach().get();
+            (void) id;
+        }
+
+        // The component should go out of scope without any explicit garbage
+        // collection.
+        HPX_TEST_EQ(true, monitor.is_ready(milliseconds(delay)));
+    }
+
+    HPX_TEST_LT(aggregated,
+        get_counter_value("/agas{locality#0/total}/count/refcnt/aggregated"));
+    HPX_TEST_LT(
+        sent, get_counter_value("/agas{locality#0/total}/count/refcnt/sent"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    hpx_test_main<simple_refcnt_monitor>(vm);
+    hpx_test_main<managed_refcnt_monitor>(vm);
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("delay", value<std::uint64_t>()->default_value(500),
+        "number of milliseconds to wait for object destruction");
+
+    // We need to explicitly enable the test components used by this test.
+    // Make sure the buffer of pending decrefs is never full.
+    std::vector<std::string> const cfg = {
+        "hpx.components.simple_refcnt_checker.enabled! = 1",
+        "hpx.components.managed_refcnt_checker.enabled! = 1",
+        "hpx.agas.max_pending_refcnt_requests! = 1000000",
+        "hpx.agas.max_pending_refcnt_delay! = 10"};
+
+    // Initialize and run HPX.
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
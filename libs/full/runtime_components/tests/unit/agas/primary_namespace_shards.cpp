@@ -0,0 +1,335 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The tables of the primary namespace are split into shards, each block of
+// 64 consecutive gids is assigned to one shard. A range of gids covering
+// several blocks is stored in every shard it overlaps. This test binds,
+// resolves, increments, and unbinds batches of such ranges, both directly on
+// a primary namespace server instance and through the addressing service.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/agas_base/server/primary_namespace.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::server::primary_namespace;
+using hpx::naming::address;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// number of gids per shard block, see primary_namespace::block_bits
+constexpr std::uint64_t block_size = 64;
+
+// every range spans three or four blocks, adjacent ranges share a block
+constexpr std::uint64_t range_count = 2 * block_size + 17;
+constexpr std::uint64_t range_stride = range_count + 7;
+
+constexpr std::int64_t initial_credit = HPX_GLOBALCREDIT_INITIAL;
+
+constexpr std::int32_t component_type =
+    hpx::components::component_base_lco_with_value;
+
+gid_type range_base(gid_type const& locality, std::uint64_t i)
+{
+    return gid_type(locality.get_msb(), 3 * block_size + i * range_stride);
+}
+
+void* range_lva(std::uint64_t i)
+{
+    return reinterpret_cast<void*>(std::uintptr_t(0x10000) * (i + 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Verify that all gids of the range starting at base resolve to the binding
+// of that range (from whatever shard they are stored in).
+void check_resolve(primary_namespace& server, gid_type const& locality,
+    gid_type const& base, void* lva)
+{
+    for (std::uint64_t k = 0; k != range_count; ++k)
+    {
+        primary_namespace::resolved_type r = server.resolve_gid(base + k);
+
+        HPX_TEST_EQ(hpx::get<0>(r), base);
+        HPX_TEST_EQ(hpx::get<1>(r).prefix, locality);
+        HPX_TEST_EQ(hpx::get<1>(r).count, range_count);
+        HPX_TEST_EQ(hpx::get<1>(r).lva(), lva);
+        HPX_TEST_EQ(hpx::get<2>(r), locality);
+    }
+}
+
+// Verify that none of the gids of the range starting at base is bound
+// anymore, in any shard.
+void check_unresolved(primary_namespace& server, gid_type const& base)
+{
+    for (std::uint64_t k = 0; k != range_count; ++k)
+    {
+        primary_namespace::resolved_type r = server.resolve_gid(base + k);
+        HPX_TEST_EQ(hpx::get<0>(r), hpx::naming::invalid_gid);
+    }
+}
+
+// Verify that each gid of the range starting at base holds more than the
+// initial credit. Decrementing a gid which is not in the reference count
+// table by more than the initial credit throws.
+void check_incremented(primary_namespace& server, gid_type const& base)
+{
+    std::vector<primary_namespace::credit_request_type> requests;
+    requests.reserve(range_count);
+
+    for (std::uint64_t k = 0; k != range_count; ++k)
+    {
+        requests.push_back(
+            hpx::make_tuple(-(initial_credit + 1), base + k, base + k));
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        server.decrement_credit(requests);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(!caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_batch(primary_namespace& server, gid_type const& locality)
+{
+    constexpr std::uint64_t num_ranges = 16;
+
+    std::vector<primary_namespace::bind_gid_request_type> bind_requests;
+    std::vector<primary_namespace::credit_request_type> credit_requests;
+    std::vector<primary_namespace::unbind_gid_request_type> unbind_requests;
+
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        gid_type const base = range_base(locality, i);
+
+        bind_requests.push_back(hpx::make_tuple(
+            gva(locality, component_type, range_count, range_lva(i)), base,
+            locality));
+        credit_requests.push_back(
+            hpx::make_tuple(initial_credit, base, base + range_count));
+        unbind_requests.push_back(hpx::make_tuple(range_count, base));
+    }
+
+    // bind all ranges at once
+    std::vector<bool> bound = server.bind_gids(bind_requests);
+    HPX_TEST_EQ(bound.size(), num_ranges);
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        HPX_TEST(bound[i]);
+        check_resolve(server, locality, range_base(locality, i), range_lva(i));
+    }
+
+    // the gids in between two ranges are not bound
+    HPX_TEST_EQ(hpx::get<0>(server.resolve_gid(
+                    range_base(locality, 0) + range_count)),
+        hpx::naming::invalid_gid);
+
+    // a range starting inside an existing one can't be bound, even though
+    // its first gid maps to a different shard than the existing entry
+    HPX_TEST_THROW(server.bind_gid(gva(locality, component_type, range_count,
+                                       range_lva(num_ranges)),
+                       range_base(locality, 1) + 2 * block_size, locality),
+        hpx::exception);
+
+    // increment the credits of all ranges at once
+    std::vector<std::int64_t> credits =
+        server.increment_credits(credit_requests);
+    HPX_TEST_EQ(credits.size(), num_ranges);
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        HPX_TEST_EQ(credits[i], std::int64_t(0));
+        check_incremented(server, range_base(locality, i));
+    }
+
+    // the gids in between two ranges were not incremented
+    HPX_TEST_THROW(
+        server.decrement_credit({hpx::make_tuple(-(initial_credit + 1),
+            range_base(locality, 0) + range_count,
+            range_base(locality, 0) + range_count)}),
+        hpx::exception);
+
+    // unbind all ranges at once
+    std::vector<address> addrs = server.unbind_gids(unbind_requests);
+    HPX_TEST_EQ(addrs.size(), num_ranges);
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        HPX_TEST_EQ(addrs[i].locality_, locality);
+        HPX_TEST_EQ(addrs[i].type_, component_type);
+        HPX_TEST_EQ(addrs[i].address_, range_lva(i));
+
+        check_unresolved(server, range_base(locality, i));
+    }
+
+    // the copies of the entries in all shards are gone, a range covering
+    // the same blocks can be bound again
+    gid_type const base = range_base(locality, 0) + block_size / 2;
+    HPX_TEST(server.bind_gid(
+        gva(locality, component_type, range_count, range_lva(0)), base,
+        locality));
+    HPX_TEST_EQ(server.unbind_gid(range_count, base).address_, range_lva(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Concurrently bind, resolve, increment, and unbind adjacent ranges sharing
+// their boundary blocks (and therefore shards).
+void test_concurrent(primary_namespace& server, gid_type const& locality)
+{
+    constexpr std::uint64_t num_tasks = 32;
+    constexpr std::uint64_t num_iterations = 10;
+
+    // ranges are assigned round robin, neighboring ranges are used by
+    // different tasks
+    std::uint64_t const first = 1000;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::uint64_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&server, locality, first, t]() {
+            for (std::uint64_t j = 0; j != num_iterations; ++j)
+            {
+                std::uint64_t const i = first + j * num_tasks + t;
+                gid_type const base = range_base(locality, i);
+
+                std::vector<bool> bound = server.bind_gids({hpx::make_tuple(
+                    gva(locality, component_type, range_count, range_lva(i)),
+                    base, locality)});
+                HPX_TEST_EQ(bound.size(), std::size_t(1));
+                HPX_TEST(bound[0]);
+
+                check_resolve(server, locality, base, range_lva(i));
+
+                std::vector<std::int64_t> credits =
+                    server.increment_credits({hpx::make_tuple(
+                        initial_credit, base, base + range_count)});
+                HPX_TEST_EQ(credits.size(), std::size_t(1));
+                check_incremented(server, base);
+
+                // the entry is still intact in all shards
+                check_resolve(server, locality, base, range_lva(i));
+
+                std::vector<address> addrs =
+                    server.unbind_gids({hpx::make_tuple(range_count, base)});
+                HPX_TEST_EQ(addrs.size(), std::size_t(1));
+                HPX_TEST_EQ(addrs[0].address_, range_lva(i));
+
+                check_unresolved(server, base);
+            }
+        }));
+    }
+
+    hpx::wait_all(tasks);
+    for (hpx::future<void>& f : tasks)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Bind and unbind batches of ranges through the addressing service.
+void test_addressing_service()
+{
+    constexpr std::uint64_t num_ranges = 8;
+
+    hpx::agas::addressing_service& agas_client =
+        hpx::naming::get_agas_client();
+
+    gid_type const here = hpx::naming::get_locality_from_gid(
+        hpx::find_here().get_gid());
+
+    std::vector<gid_type> bases;
+    std::vector<hpx::agas::addressing_service::bind_range_request_type>
+        bind_requests;
+    std::vector<hpx::agas::addressing_service::unbind_range_request_type>
+        unbind_requests;
+
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        gid_type lower, upper;
+        HPX_TEST(agas_client.get_id_range(range_count, lower, upper));
+
+        gid_type const base = hpx::naming::detail::get_stripped_gid(lower);
+        bases.push_back(base);
+
+        // each gid of the range refers to its own 8 byte slot
+        bind_requests.push_back(hpx::make_tuple(base, range_count,
+            address(here, component_type, range_lva(i)), std::uint64_t(8)));
+        unbind_requests.push_back(hpx::make_tuple(base, range_count));
+    }
+
+    std::vector<bool> bound =
+        agas_client.bind_ranges_async(bind_requests).get();
+    HPX_TEST_EQ(bound.size(), num_ranges);
+
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        HPX_TEST(bound[i]);
+
+        for (std::uint64_t k = 0; k != range_count; ++k)
+        {
+            address addr;
+            HPX_TEST(agas_client.resolve_full_local(bases[i] + k, addr));
+            HPX_TEST_EQ(addr.locality_, here);
+            HPX_TEST_EQ(addr.address_,
+                static_cast<void*>(static_cast<char*>(range_lva(i)) + k * 8));
+        }
+    }
+
+    std::vector<address> addrs =
+        agas_client.unbind_ranges_async(unbind_requests).get();
+    HPX_TEST_EQ(addrs.size(), num_ranges);
+
+    for (std::uint64_t i = 0; i != num_ranges; ++i)
+    {
+        HPX_TEST_EQ(addrs[i].locality_, here);
+        HPX_TEST_EQ(addrs[i].address_, range_lva(i));
+
+        address addr;
+        HPX_TEST(!agas_client.resolve_full_local(bases[i], addr));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    {
+        // use a primary namespace instance separate from the one used by
+        // the runtime, the ranges bound below are not backed by any object
+        primary_namespace server;
+        gid_type const locality = hpx::naming::get_gid_from_locality_id(0);
+
+        test_batch(server, locality);
+        test_concurrent(server, locality);
+    }
+
+    test_addressing_service();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -21,6 +21,8 @@
 #include <hpx/format.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/itt_notify/thread_name.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
@@ -934,6 +936,9 @@ namespace hpx {
     ///        instance
     void runtime_distributed::register_counter_types()
     {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
         performance_counters::generic_counter_type_data
             statistic_counter_types[] =
         {    // averaging counter
@@ -1073,6 +1078,34 @@ namespace hpx {
                     local_action_invocation_counter_discoverer,
                 ""},
 
+            // future shared state pool counters
+            {"/runtime/count/future-pool-hits",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of shared states of futures allocated "
+                "from the per-thread caches of the future_data pool on this "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &lcos::detail::get_future_data_pool_hits, _2),
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/runtime/count/future-pool-misses",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of shared states of futures which could "
+                "not be allocated from the per-thread caches of the "
+                "future_data pool on this locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &lcos::detail::get_future_data_pool_misses, _2),
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/runtime/count/inlined-tasks",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of tasks which have been run inline by a "
+                "thread waiting for their result on this locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &lcos::detail::get_inlined_child_tasks_count, _2),
+                &performance_counters::locality_counter_discoverer, ""},
+
 #if defined(HPX_HAVE_NETWORKING)
             {"/runtime/count/remote-action-invocation",
                 performance_counters::counter_raw,
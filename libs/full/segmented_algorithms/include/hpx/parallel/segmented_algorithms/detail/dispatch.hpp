@@ -12,15 +12,18 @@
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/distribution_policies/colocating_distribution_policy.hpp>
 #include <hpx/naming_base/id_type.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/executors/parallel_executor.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 #include <hpx/parallel/util/result_types.hpp>
+#include <hpx/type_support/detected.hpp>
 
 #include <exception>
 #include <list>
@@ -221,6 +224,52 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Local raw iterators may expose the executor the memory of their segment
+    // is bound to (e.g. partitioned_vector partitions allocated on a NUMA
+    // domain). Parallel local algorithms are run on that executor, unless the
+    // user has explicitly specified an executor.
+    template <typename ExPolicy, typename Iter>
+    using segment_policy_t = decltype(std::declval<ExPolicy const&>().on(
+        std::declval<Iter const&>().get_executor()));
+
+    template <typename ExPolicy, typename... Iters>
+    struct is_segment_bindable : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename Iter, typename... Ts>
+    struct is_segment_bindable<ExPolicy, Iter, Ts...>
+      : std::integral_constant<bool,
+            hpx::util::is_detected<segment_policy_t, ExPolicy, Iter>::value &&
+                std::is_same_v<typename ExPolicy::executor_type,
+                    hpx::execution::parallel_executor>>
+    {
+    };
+
+    // Only a default constructed parallel_executor is replaced, an executor
+    // configured by the user (e.g. for a specific thread pool, priority, or
+    // stack size) is used as given.
+    inline bool is_default_executor(
+        hpx::execution::parallel_executor const& exec)
+    {
+        namespace ex = hpx::execution::experimental;
+
+        hpx::execution::parallel_executor const default_exec;
+        return exec == default_exec &&
+            ex::get_priority(exec) == ex::get_priority(default_exec) &&
+            ex::get_stacksize(exec) == ex::get_stacksize(default_exec) &&
+            ex::get_hint(exec) == ex::get_hint(default_exec) &&
+            ex::get_annotation(exec) == ex::get_annotation(default_exec);
+    }
+
+    template <typename ExPolicy, typename Iter, typename... Ts>
+    decltype(auto) bind_to_segment(
+        ExPolicy const& policy, Iter const& it, Ts const&...)
+    {
+        return policy.on(it.get_executor());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Algo, typename ExPolicy, typename... Args>
     struct dispatcher
@@ -253,20 +302,44 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             Algo const& algo, ExPolicy policy, Args... args)
         {
             using hpx::traits::segmented_local_iterator_traits;
+            return parallel_local(algo, HPX_FORWARD(ExPolicy, policy),
+                segmented_local_iterator_traits<std::decay_t<Args>>::local(
+                    HPX_FORWARD(Args, args))...);
+        }
+
+    private:
+        template <typename... LocalArgs>
+        HPX_FORCEINLINE static result_type parallel_local(
+            Algo const& algo, ExPolicy&& policy, LocalArgs&&... args)
+        {
+            if constexpr (detail::is_segment_bindable<std::decay_t<ExPolicy>,
+                              std::decay_t<LocalArgs>...>::value)
+            {
+                if (detail::is_default_executor(policy.executor()))
+                {
+                    return call_local(algo,
+                        detail::bind_to_segment(policy, args...),
+                        HPX_FORWARD(LocalArgs, args)...);
+                }
+            }
+            return call_local(algo, HPX_FORWARD(ExPolicy, policy),
+                HPX_FORWARD(LocalArgs, args)...);
+        }
+
+        template <typename LocalPolicy, typename... LocalArgs>
+        HPX_FORCEINLINE static result_type call_local(
+            Algo const& algo, LocalPolicy&& policy, LocalArgs&&... args)
+        {
             if constexpr (std::is_void_v<result_type>)
             {
-                return algo.call2(HPX_FORWARD(ExPolicy, policy),
-                    std::false_type(),
-                    segmented_local_iterator_traits<std::decay_t<Args>>::local(
-                        HPX_FORWARD(Args, args))...);
+                return algo.call2(HPX_FORWARD(LocalPolicy, policy),
+                    std::false_type(), HPX_FORWARD(LocalArgs, args)...);
             }
             else
             {
-                return detail::algorithm_result_helper<
-                    result_type>::call(algo.call2(HPX_FORWARD(ExPolicy, policy),
-                    std::false_type(),
-                    segmented_local_iterator_traits<std::decay_t<Args>>::local(
-                        HPX_FORWARD(Args, args))...));
+                return detail::algorithm_result_helper<result_type>::call(
+                    algo.call2(HPX_FORWARD(LocalPolicy, policy),
+                        std::false_type(), HPX_FORWARD(LocalArgs, args)...));
             }
         }
     };
@@ -0,0 +1,426 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The segmented sort is a sample sort. Every (non-empty) segment of
+        // the input sequence is handled by one site which runs where the
+        // segment is located. The sites of one invocation share a
+        // communicator:
+        //
+        //  - each site sorts its segment locally,
+        //  - all sites exchange regular samples of their sorted segments and
+        //    select the same splitters from them,
+        //  - the elements are exchanged such that site j receives all
+        //    elements of bucket j, which it merges,
+        //  - the merged buckets are exchanged a second time such that every
+        //    site receives exactly the elements which end up in its segment.
+        //
+        // Only the second exchange is needed to keep the (fixed) sizes of the
+        // segments intact, the splitters may create buckets of any size.
+        inline std::string segmented_sort_basename()
+        {
+            static std::atomic<std::size_t> generation(0);
+            return "/hpx/segmented_sort/" +
+                std::to_string(agas::get_locality_id()) + "/" +
+                std::to_string(++generation);
+        }
+
+        // merge the adjacent sorted runs [bounds[i], bounds[i + 1]) of data
+        template <typename T, typename Compare>
+        void segmented_sort_merge(std::vector<T>& data,
+            std::vector<std::size_t> bounds, Compare const& comp)
+        {
+            while (bounds.size() > 2)
+            {
+                std::vector<std::size_t> next;
+                next.reserve(bounds.size() / 2 + 1);
+                next.push_back(0);
+
+                std::size_t i = 2;
+                for (/**/; i < bounds.size(); i += 2)
+                {
+                    std::inplace_merge(data.begin() + bounds[i - 2],
+                        data.begin() + bounds[i - 1], data.begin() + bounds[i],
+                        comp);
+                    next.push_back(bounds[i]);
+                }
+
+                // an odd number of runs leaves the last one alone
+                if (i == bounds.size())
+                {
+                    next.push_back(bounds.back());
+                }
+                bounds = HPX_MOVE(next);
+            }
+        }
+
+        template <typename ExPolicy, typename Iter, typename Compare,
+            typename Proj>
+        Iter segmented_sort_site(ExPolicy&& policy, Iter first, Iter last,
+            Compare&& comp, Proj&& proj, std::string const& basename,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            hpx::sort(policy, first, last, comp, proj);
+            if (num_sites == 1)
+            {
+                return last;
+            }
+
+            auto less = [&](value_type const& lhs, value_type const& rhs) {
+                return HPX_INVOKE(
+                    comp, HPX_INVOKE(proj, lhs), HPX_INVOKE(proj, rhs));
+            };
+
+            hpx::collectives::communicator comm =
+                hpx::collectives::create_communicator(basename.c_str(),
+                    hpx::collectives::num_sites_arg(num_sites),
+                    hpx::collectives::this_site_arg(this_site));
+
+            std::size_t const count = std::distance(first, last);
+
+            // regular samples of the sorted segment, all sites select the
+            // same splitters from the combined samples
+            std::vector<value_type> samples;
+            samples.reserve(num_sites - 1);
+            for (std::size_t i = 1; i != num_sites; ++i)
+            {
+                samples.push_back(*std::next(first, i * count / num_sites));
+            }
+
+            std::vector<std::vector<value_type>> all_samples =
+                hpx::collectives::all_gather(comm, HPX_MOVE(samples),
+                    hpx::collectives::this_site_arg(this_site))
+                    .get();
+
+            samples.clear();
+            for (auto& s : all_samples)
+            {
+                samples.insert(samples.end(),
+                    std::make_move_iterator(s.begin()),
+                    std::make_move_iterator(s.end()));
+            }
+            std::sort(samples.begin(), samples.end(), less);
+
+            // the local bucket boundaries, the segment size is appended as
+            // the sites need it for the final layout
+            std::vector<std::size_t> counts(num_sites + 1);
+            {
+                Iter it = first;
+                for (std::size_t j = 1; j != num_sites; ++j)
+                {
+                    Iter next = std::upper_bound(it, last,
+                        samples[j * samples.size() / num_sites], less);
+                    counts[j - 1] = std::distance(it, next);
+                    it = next;
+                }
+                counts[num_sites - 1] = std::distance(it, last);
+                counts[num_sites] = count;
+            }
+
+            std::vector<std::vector<std::size_t>> all_counts =
+                hpx::collectives::all_gather(comm, counts,
+                    hpx::collectives::this_site_arg(this_site))
+                    .get();
+
+            // send bucket j to site j
+            std::vector<std::vector<value_type>> buckets(num_sites);
+            {
+                Iter it = first;
+                for (std::size_t j = 0; j != num_sites; ++j)
+                {
+                    Iter next = std::next(it, counts[j]);
+                    buckets[j].assign(std::make_move_iterator(it),
+                        std::make_move_iterator(next));
+                    it = next;
+                }
+            }
+
+            buckets = hpx::collectives::all_to_all(comm, HPX_MOVE(buckets),
+                hpx::collectives::this_site_arg(this_site))
+                          .get();
+
+            std::vector<value_type> bucket;
+            std::vector<std::size_t> bounds;
+            bounds.reserve(num_sites + 1);
+            bounds.push_back(0);
+            for (auto& b : buckets)
+            {
+                bucket.insert(bucket.end(), std::make_move_iterator(b.begin()),
+                    std::make_move_iterator(b.end()));
+                bounds.push_back(bucket.size());
+            }
+            buckets.clear();
+
+            segmented_sort_merge(bucket, HPX_MOVE(bounds), less);
+
+            // the global position of the merged bucket
+            std::size_t bucket_first = 0;
+            for (std::size_t j = 0; j != this_site; ++j)
+            {
+                for (std::size_t s = 0; s != num_sites; ++s)
+                {
+                    bucket_first += all_counts[s][j];
+                }
+            }
+            std::size_t const bucket_last = bucket_first + bucket.size();
+
+            // send the parts of the merged bucket to the sites owning the
+            // corresponding part of the sequence
+            std::vector<std::vector<value_type>> parts(num_sites);
+            std::size_t segment_first = 0;
+            for (std::size_t d = 0; d != num_sites; ++d)
+            {
+                std::size_t const segment_last =
+                    segment_first + all_counts[d][num_sites];
+
+                std::size_t const part_first =
+                    (std::max)(bucket_first, segment_first);
+                std::size_t const part_last =
+                    (std::min)(bucket_last, segment_last);
+
+                if (part_first < part_last)
+                {
+                    parts[d].assign(std::make_move_iterator(bucket.begin() +
+                                        (part_first - bucket_first)),
+                        std::make_move_iterator(
+                            bucket.begin() + (part_last - bucket_first)));
+                }
+                segment_first = segment_last;
+            }
+            bucket.clear();
+
+            parts = hpx::collectives::all_to_all(comm, HPX_MOVE(parts),
+                hpx::collectives::this_site_arg(this_site))
+                        .get();
+
+            // the parts arrive ordered by bucket
+            Iter dest = first;
+            for (auto& p : parts)
+            {
+                dest = std::move(p.begin(), p.end(), dest);
+            }
+            HPX_ASSERT(dest == last);
+
+            return dest;
+        }
+
+        template <typename Iter>
+        struct sample_sort_site
+          : public detail::algorithm<sample_sort_site<Iter>, Iter>
+        {
+            sample_sort_site()
+              : sample_sort_site::algorithm("sample_sort_site")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static FwdIter sequential(ExPolicy&& policy, FwdIter first,
+                FwdIter last, Compare&& comp, Proj&& proj,
+                std::string const& basename, std::size_t num_sites,
+                std::size_t this_site)
+            {
+                return segmented_sort_site(
+                    policy(hpx::execution::non_task), first, last,
+                    HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj),
+                    basename, num_sites, this_site);
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                FwdIter>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                Compare&& comp, Proj&& proj, std::string const& basename,
+                std::size_t num_sites, std::size_t this_site)
+            {
+                using result =
+                    util::detail::algorithm_result<ExPolicy, FwdIter>;
+
+                // the local sort uses the executor and parameters of the
+                // given policy but does not need to be asynchronous, the site
+                // itself runs asynchronously to its caller
+                return result::get(segmented_sort_site(
+                    policy(hpx::execution::non_task), first, last,
+                    HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj),
+                    basename, num_sites, this_site));
+            }
+        };
+
+        // all sites have to run concurrently, regardless of the execution
+        // policy, as they synchronize with each other
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        static util::detail::algorithm_result_t<ExPolicy>
+        segmented_sort(ExPolicy&& policy, SegIter first, SegIter last,
+            Compare&& comp, Proj&& proj)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using segment_iterator = typename traits::segment_iterator;
+            using local_iterator_type = typename traits::local_iterator;
+            using result = util::detail::algorithm_result<ExPolicy>;
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<hpx::id_type> ids;
+            std::vector<std::pair<local_iterator_type, local_iterator_type>>
+                ranges;
+
+            auto add_range = [&](segment_iterator const& it,
+                                 local_iterator_type beg,
+                                 local_iterator_type end) {
+                if (beg != end)
+                {
+                    ids.push_back(traits::get_id(it));
+                    ranges.emplace_back(beg, end);
+                }
+            };
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                add_range(sit, traits::local(first), traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_range(sit, traits::local(first), traits::end(sit));
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    add_range(sit, traits::begin(sit), traits::end(sit));
+                }
+
+                // handle the beginning of the last partition
+                add_range(sit, traits::begin(sit), traits::local(last));
+            }
+
+            std::size_t const num_sites = ranges.size();
+            std::string const basename = segmented_sort_basename();
+
+            std::vector<future<local_iterator_type>> sites;
+            sites.reserve(num_sites);
+
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                sites.push_back(dispatch_async(ids[i],
+                    sample_sort_site<local_iterator_type>(), policy, is_seq(),
+                    ranges[i].first, ranges[i].second, comp, proj, basename,
+                    num_sites, i));
+            }
+
+            return result::get(hpx::dataflow(
+                [](std::vector<hpx::future<local_iterator_type>>&& r) -> void {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+                },
+                HPX_MOVE(sites)));
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Compare = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(hpx::sort_t, SegIter first, SegIter last,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return;
+        }
+
+        hpx::parallel::v1::detail::segmented_sort(hpx::execution::seq, first,
+            last, HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Compare = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<
+                ExPolicy>::get();
+        }
+
+        return hpx::parallel::v1::detail::segmented_sort(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
+    }
+}}    // namespace hpx::segmented
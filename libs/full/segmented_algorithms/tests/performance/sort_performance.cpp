@@ -0,0 +1,140 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+unsigned int seed = (unsigned int) std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+struct random_fill
+{
+    random_fill()
+      : gen(seed)
+      , dist(0, RAND_MAX)
+    {
+    }
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the data is regenerated before each run, the generation is not timed
+double run_sort_benchmark(int test_count, hpx::partitioned_vector<int>& v)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill());
+
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        hpx::sort(hpx::execution::par, v.begin(), v.end());
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        // pull values from cmd
+        std::size_t size = vm["vector_size"].as<std::size_t>();
+        bool csvoutput = vm.count("csv_output") != 0;
+        int test_count = vm["test_count"].as<int>();
+
+        if (vm.count("seed"))
+            seed = vm["seed"].as<unsigned int>();
+
+        // create as many partitions as we have localities
+        std::vector<hpx::id_type> localities = hpx::find_all_localities();
+        hpx::partitioned_vector<int> v(size, hpx::container_layout(localities));
+
+        // run benchmark
+        double time_sort = run_sort_benchmark(test_count, v);
+        double throughput = size / time_sort;
+
+        if (csvoutput)
+        {
+            std::cout << "sort," << localities.size() << "," << size << ","
+                      << time_sort << "," << throughput << std::endl;
+        }
+        else
+        {
+            std::cout << "localities:            " << localities.size()
+                      << "\n"
+                      << "elements:              " << size << "\n"
+                      << "time [s]:              " << time_sort << "\n"
+                      << "elements/s:            " << throughput << "\n"
+                      << "elements/s / locality: "
+                      << throughput / localities.size() << std::endl;
+        }
+
+        return hpx::finalize();
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.run_hpx_main!=1"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("vector_size",
+        hpx::program_options::value<std::size_t>()->default_value(1000000),
+        "size of vector (default: 1000000)")("test_count",
+        hpx::program_options::value<int>()->default_value(10),
+        "number of tests to be averaged (default: 10)")(
+        "csv_output", "print results in csv format")("seed,s",
+        hpx::program_options::value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,146 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v, int max_value)
+{
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(),
+                                                  end = v.end();
+    for (/**/; it != end; ++it)
+    {
+        T val = T(dist(gen));
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+                                                        end = v.end();
+    for (/**/; it != end; ++it)
+    {
+        values.push_back(*it);
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& dist_policy, ExPolicy const& policy, int max_value)
+{
+    hpx::partitioned_vector<T> c(size, dist_policy);
+
+    // sort all elements
+    std::vector<T> expected = fill_vector(c, max_value);
+    std::sort(expected.begin(), expected.end());
+
+    hpx::sort(policy, c.begin(), c.end());
+    HPX_TEST(get_values(c) == expected);
+
+    // sort in descending order
+    expected = fill_vector(c, max_value);
+    std::sort(expected.begin(), expected.end(), std::greater<T>());
+
+    hpx::sort(policy, c.begin(), c.end(), std::greater<T>());
+    HPX_TEST(get_values(c) == expected);
+
+    // sort a range starting and ending in the middle of a partition
+    expected = fill_vector(c, max_value);
+    std::sort(expected.begin() + 1, expected.end() - 1);
+
+    hpx::sort(policy, c.begin() + 1, c.end() - 1);
+    HPX_TEST(get_values(c) == expected);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& dist_policy, ExPolicy const& policy, int max_value)
+{
+    hpx::partitioned_vector<T> c(size, dist_policy);
+
+    std::vector<T> expected = fill_vector(c, max_value);
+    std::sort(expected.begin(), expected.end());
+
+    hpx::future<void> f = hpx::sort(policy, c.begin(), c.end());
+    f.wait();
+
+    HPX_TEST(!f.has_exception());
+    HPX_TEST(get_values(c) == expected);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& dist_policy)
+{
+    using namespace hpx::execution;
+
+    // many duplicates make the buckets of the sample sort uneven
+    for (int max_value : {10, 100000})
+    {
+        sort_algo_tests_with_policy<T>(size, dist_policy, seq, max_value);
+        sort_algo_tests_with_policy<T>(size, dist_policy, par, max_value);
+
+        sort_algo_tests_with_policy_async<T>(
+            size, dist_policy, seq(task), max_value);
+        sort_algo_tests_with_policy_async<T>(
+            size, dist_policy, par(task), max_value);
+    }
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(12, hpx::container_layout);
+    sort_tests_with_policy<T>(12, hpx::container_layout(localities));
+    sort_tests_with_policy<T>(1007, hpx::container_layout(3));
+    sort_tests_with_policy<T>(1007, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(
+        10007, hpx::container_layout(3 * localities.size(), localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -8,11 +8,13 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/compute.hpp>
+#include <hpx/include/parallel_for_each.hpp>
 #include <hpx/include/partitioned_vector.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/modules/testing.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -28,6 +30,16 @@ typedef hpx::compute::vector<double, target_allocator_double>
 HPX_REGISTER_PARTITIONED_VECTOR_DECLARATION(double, target_vector_double)
 HPX_REGISTER_PARTITIONED_VECTOR(double, target_vector_double)
 
+///////////////////////////////////////////////////////////////////////////////
+struct pfo
+{
+    template <typename T>
+    void operator()(T& val) const
+    {
+        ++val;
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 void allocation_tests()
@@ -48,6 +60,37 @@ void allocation_tests()
         }
     }
 
+    // place one partition onto each of the NUMA domains of this locality
+    std::size_t const num_domains = hpx::compute::host::numa_domains().size();
+    {
+        hpx::partitioned_vector<T, target_vector> v(
+            length, T(42), hpx::compute::host::numa_layout);
+        HPX_TEST_EQ(std::size_t(std::distance(
+                        v.segment_begin(), v.segment_end())),
+            num_domains);
+
+        // local algorithms are run on the NUMA domain of each partition
+        hpx::for_each(hpx::execution::par, v.begin(), v.end(), pfo());
+
+        std::size_t count = 0;
+        auto end = v.end();
+        for (auto it = v.begin(); it != end; ++it, ++count)
+        {
+            HPX_TEST_EQ(*it, T(43));
+        }
+        HPX_TEST_EQ(count, length);
+    }
+
+    {
+        std::size_t const size = 2 * num_domains * length;
+        hpx::partitioned_vector<T, target_vector> v(
+            size, hpx::compute::host::numa_layout(2 * num_domains));
+        HPX_TEST_EQ(std::size_t(std::distance(
+                        v.segment_begin(), v.segment_end())),
+            2 * num_domains);
+        HPX_TEST_EQ(v.size(), size);
+    }
+
     //{
     //    hpx::partitioned_vector<T> v;
     //    copy_tests(v);
@@ -76,6 +119,6 @@ int main()
     allocation_tests<double>();
     allocation_tests<int>();
 
-    return 0;
+    return hpx::util::report_errors();
 }
 #endif
@@ -16,6 +16,8 @@
 
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/statistics/histogram.hpp>
@@ -27,9 +29,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -125,6 +129,35 @@ typedef hpx::util::cache::local_cache<
     hpx::util::cache::statistics::local_full_statistics
 > gva_cache_type;
 
+// The sharded cache as used by AGAS today
+struct gva_cache_sharder
+{
+    std::pair<std::size_t, std::size_t> operator()(
+        gva_cache_key const& key, std::size_t num_shards) const
+    {
+        hpx::naming::gid_type const& first = key.get_gid();
+        std::uint64_t const first_block = first.get_lsb() >> 6;
+        std::uint64_t const last_block =
+            (first.get_lsb() + key.get_count()) >> 6;
+
+        std::size_t const shard = static_cast<std::size_t>(
+            (std::hash<std::uint64_t>()(first.get_msb()) + first_block) %
+            num_shards);
+        if (last_block < first_block)
+            return std::make_pair(shard, num_shards);
+
+        std::uint64_t const num_blocks = last_block - first_block + 1;
+        return std::make_pair(shard,
+            num_blocks < num_shards ? std::size_t(num_blocks) : num_shards);
+    }
+};
+
+typedef hpx::util::cache::sharded_cache<
+    hpx::util::cache::lru_cache<gva_cache_key, hpx::agas::gva,
+        hpx::util::cache::statistics::local_full_statistics>,
+    hpx::lcos::local::spinlock, gva_cache_sharder
+> sharded_gva_cache_type;
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(std::string const& prefix,
     std::vector<std::uint64_t> const& timings)
@@ -231,6 +264,91 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Run the given lookup function concurrently on num_workers HPX threads,
+// returns the overall number of lookups per second
+template <typename F>
+double measure_lookups(
+    std::size_t num_workers, std::size_t num_lookups, F const& lookup)
+{
+    std::vector<hpx::future<void>> workers;
+    workers.reserve(num_workers);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t w = 0; w != num_workers; ++w)
+    {
+        workers.push_back(hpx::async([&lookup, w, num_lookups]() {
+            for (std::size_t i = 0; i != num_lookups; ++i)
+            {
+                lookup(w, i);
+            }
+        }));
+    }
+    hpx::wait_all(workers);
+
+    return double(num_workers * num_lookups) / t.elapsed();
+}
+
+void test_contention(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = hpx::components::component_invalid;
+
+    // the original cache protected by a single lock, and the sharded cache
+    hpx::lcos::local::spinlock mtx;
+    gva_cache_type cache;
+    cache.reserve(cache_size);
+
+    sharded_gva_cache_type sharded_cache(32, cache_size);
+
+    std::vector<hpx::naming::gid_type> keys;
+    keys.reserve(num_entries);
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.push_back(hpx::detail::get_next_id());
+
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+        cache.insert(gva_cache_key(keys.back(), 1), value);
+        sharded_cache.insert(gva_cache_key(keys.back(), 1), value);
+    }
+
+    auto get_key = [&keys](std::size_t w, std::size_t i) {
+        return gva_cache_key(keys[(w * 7919 + i) % keys.size()], 1);
+    };
+
+    std::cout << "workers, single lock [lookups/s], sharded [lookups/s]\n";
+
+    std::size_t const max_workers = hpx::get_os_thread_count();
+    for (std::size_t n = 1;; n = (std::min)(2 * n, max_workers))
+    {
+        double const single_lock = measure_lookups(n, num_lookups,
+            [&](std::size_t w, std::size_t i) {
+                gva_cache_key const key = get_key(w, i);
+                gva_cache_key idbase;
+                gva_cache_type::entry_type e;
+
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+                cache.get_entry(key, idbase, e);
+            });
+
+        double const sharded = measure_lookups(n, num_lookups,
+            [&](std::size_t w, std::size_t i) {
+                gva_cache_key const key = get_key(w, i);
+                gva_cache_key idbase;
+                hpx::agas::gva e;
+
+                sharded_cache.get_entry(key, idbase, e);
+            });
+
+        std::cout << n << ", " << single_lock << ", " << sharded << "\n";
+
+        if (n >= max_workers)
+            break;
+    }
+    std::cout << std::flush;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -242,6 +360,19 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    if (vm.count("contention"))
+    {
+        std::size_t num_lookups = 100000;
+        if (vm.count("num_lookups"))
+            num_lookups = vm["num_lookups"].as<std::size_t>();
+
+        hpx::chrono::high_resolution_timer t;
+        test_contention(cache_size, num_entries, num_lookups);
+        hpx::util::print_cdash_timing("AGASCacheContention", t.elapsed());
+
+        return hpx::finalize();
+    }
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -271,6 +402,11 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("contention",
+         "measure the lookups per second of concurrent workers for an "
+         "increasing number of workers")
+        ("num_lookups", value<std::size_t>(),
+         "number of lookups per worker in contention mode (default: 100000)")
         ;
 
     // Initialize and run HPX
@@ -0,0 +1,113 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures how many components can be created and destroyed
+// per second when many threads do so concurrently. Each creation binds the
+// new component in AGAS and each destruction unbinds it again, which makes
+// this a test for the scalability of the primary namespace.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Plain components get purely local ids, which are never bound in AGAS. This
+// component binds its id in the primary namespace instead, as migratable
+// components do.
+struct simple_component
+  : hpx::components::component_base<simple_component>
+{
+    hpx::naming::gid_type get_base_gid(
+        hpx::naming::gid_type const& assign_gid = hpx::naming::invalid_gid)
+        const
+    {
+        return this->get_base_gid_dynamic(
+            assign_gid, this->get_current_address());
+    }
+};
+
+HPX_REGISTER_COMPONENT(
+    hpx::components::component<simple_component>, simple_component)
+
+///////////////////////////////////////////////////////////////////////////////
+void create_and_release(std::uint64_t count)
+{
+    hpx::id_type const here = hpx::find_here();
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        // the component is destroyed as soon as the last reference to it
+        // goes out of scope
+        hpx::id_type id = hpx::new_<simple_component>(here).get();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const count = vm["components"].as<std::uint64_t>();
+    std::uint64_t const num_tasks = vm["tasks"].as<std::uint64_t>();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::uint64_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(&create_and_release, count));
+    }
+    hpx::wait_all(tasks);
+
+    double const elapsed = t.elapsed();
+    double const total = double(count * num_tasks);
+
+    if (vm.count("csv") != 0)
+    {
+        std::cout << hpx::get_os_thread_count() << "," << total << ","
+                  << elapsed << "," << total / elapsed << "\n";
+    }
+    else
+    {
+        std::cout << "created and destroyed " << total << " components in "
+                  << elapsed << " s (" << total / elapsed
+                  << " ops/s) using " << hpx::get_os_thread_count()
+                  << " threads\n";
+    }
+    hpx::util::print_cdash_timing("AGASComponentThroughput", elapsed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("components", value<std::uint64_t>()->default_value(10000),
+         "number of components each task creates and destroys")
+        ("tasks", value<std::uint64_t>()->default_value(64),
+         "number of concurrent tasks")
+        ("csv", "output results as csv (format: threads,count,duration,ops)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,242 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of the tree based and the hash based storages of the
+// caches in hpx::util::cache for an increasing number of entries.
+
+#include <hpx/config.hpp>
+#include <hpx/cache/concurrent_lru_cache.hpp>
+#include <hpx/cache/entries/fifo_entry.hpp>
+#include <hpx/cache/hashed_lru_cache.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/policies/always.hpp>
+#include <hpx/cache/storage/open_hash_map.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::program_options::command_line_parser;
+using hpx::program_options::notify;
+using hpx::program_options::options_description;
+using hpx::program_options::store;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using key_type = std::uint64_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// generate a reproducible sequence of (pseudo) random keys in [0, n)
+std::vector<key_type> make_keys(std::size_t count, std::size_t n)
+{
+    std::vector<key_type> keys;
+    keys.reserve(count);
+
+    std::uint64_t x = 0x2545f4914f6cdd1dull;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        keys.push_back(x % n);
+    }
+    return keys;
+}
+
+void print_result(char const* name, std::size_t entries, double insert_time,
+    double get_time, std::size_t num_lookups)
+{
+    std::cout << name << ", " << entries << ", "
+              << (entries / insert_time) / 1e6 << ", "
+              << (num_lookups / get_time) / 1e6 << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+void measure(char const* name, std::size_t entries,
+    std::vector<key_type> const& lookups)
+{
+    Cache cache(entries);
+
+    hpx::chrono::high_resolution_timer t;
+    for (key_type k = 0; k != entries; ++k)
+    {
+        cache.insert(k, k);
+    }
+    double const insert_time = t.elapsed();
+
+    std::size_t hits = 0;
+    key_type value = 0;
+
+    t.restart();
+    for (key_type k : lookups)
+    {
+        hits += cache.get_entry(k, value) ? 1 : 0;
+    }
+    double const get_time = t.elapsed();
+
+    if (hits != lookups.size())
+    {
+        std::cerr << name << ": unexpected number of hits: " << hits << "\n";
+    }
+    print_result(name, entries, insert_time, get_time, lookups.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// concurrent lookups, a single lock protecting an lru_cache compared to the
+// segmented hash based cache
+template <typename F>
+double run_concurrent(std::size_t num_threads, F const& f)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.emplace_back(f);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return t.elapsed();
+}
+
+void measure_concurrent(std::size_t entries, std::size_t num_threads,
+    std::vector<key_type> const& lookups)
+{
+    std::size_t const total = num_threads * lookups.size();
+
+    {
+        using cache_type = hpx::util::cache::lru_cache<key_type, key_type>;
+
+        std::mutex mtx;
+        cache_type cache(entries);
+        for (key_type k = 0; k != entries; ++k)
+        {
+            cache.insert(k, k);
+        }
+
+        double const elapsed = run_concurrent(num_threads, [&]() {
+            key_type value = 0;
+            for (key_type k : lookups)
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                cache.get_entry(k, value);
+            }
+        });
+
+        std::cout << "locked_lru_cache/" << num_threads << ", " << entries
+                  << ", -, " << (total / elapsed) / 1e6 << "\n";
+    }
+
+    {
+        using cache_type =
+            hpx::util::cache::concurrent_lru_cache<key_type, key_type>;
+
+        cache_type cache(4 * num_threads, entries);
+        for (key_type k = 0; k != entries; ++k)
+        {
+            cache.insert(k, k);
+        }
+
+        double const elapsed = run_concurrent(num_threads, [&]() {
+            key_type value = 0;
+            for (key_type k : lookups)
+            {
+                cache.get_entry(k, value);
+            }
+        });
+
+        std::cout << "concurrent_lru_cache/" << num_threads << ", " << entries
+                  << ", -, " << (total / elapsed) / 1e6 << "\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int app_main(variables_map& vm)
+{
+    using namespace hpx::util::cache;
+
+    // touching an lru_entry rebuilds the heap of the local_cache, use a
+    // fifo_entry to measure the overhead of the storage only
+    using entry_type = entries::fifo_entry<key_type>;
+    using map_cache_type = local_cache<key_type, entry_type>;
+    using hash_cache_type = local_cache<key_type, entry_type,
+        std::less<entry_type>, policies::always<entry_type>,
+        storage::open_hash_map<key_type, entry_type>>;
+
+    std::size_t const max_entries = vm["max_entries"].as<std::size_t>();
+    std::size_t const num_lookups = vm["num_lookups"].as<std::size_t>();
+    std::size_t const num_threads = vm["threads"].as<std::size_t>();
+
+    std::cout << "cache, entries, insert [Mops/s], get [Mops/s]\n";
+    for (std::size_t entries = 1000; entries <= max_entries; entries *= 10)
+    {
+        std::vector<key_type> const lookups = make_keys(num_lookups, entries);
+
+        measure<lru_cache<key_type, key_type>>("lru_cache", entries, lookups);
+        measure<hashed_lru_cache<key_type, key_type>>(
+            "hashed_lru_cache", entries, lookups);
+
+        measure<map_cache_type>("local_cache<std::map>", entries, lookups);
+        measure<hash_cache_type>(
+            "local_cache<open_hash_map>", entries, lookups);
+
+        if (num_threads > 1)
+        {
+            measure_concurrent(entries, num_threads, lookups);
+        }
+    }
+    std::cout << std::flush;
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Parse command line.
+    variables_map vm;
+
+    options_description cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("max_entries", value<std::size_t>()->default_value(1000000),
+         "largest number of cache entries to measure, starting at 1000 and "
+         "increasing by a factor of ten (use 10000000 for the full range)")
+        ("num_lookups", value<std::size_t>()->default_value(1000000),
+         "number of lookups performed for each cache size")
+        ("threads", value<std::size_t>()->default_value(
+            std::thread::hardware_concurrency()),
+         "number of threads used for the concurrent lookups");
+    // clang-format on
+
+    store(command_line_parser(argc, argv).options(cmdline).run(), vm);
+
+    notify(vm);
+
+    // Print help screen.
+    if (vm.count("help"))
+    {
+        std::cout << cmdline;
+        return 0;
+    }
+
+    return app_main(vm);
+}
@@ -0,0 +1,103 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of timed suspensions. A large number of
+// HPX threads is spawned which all sleep concurrently for the same amount of
+// time. Every timed suspension arms a timer on the timer wheel of the worker
+// thread it runs on, the scheduling loop resumes the thread once the timer
+// has expired.
+
+#include <hpx/config.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> total_delay(0);
+
+void sleep_once(std::chrono::microseconds duration)
+{
+    auto const start = std::chrono::steady_clock::now();
+    hpx::this_thread::sleep_for(duration);
+
+    // accumulate how much later than requested the thread was resumed
+    auto const delay = std::chrono::steady_clock::now() - start - duration;
+    total_delay.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count(),
+        std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const num_sleeps = vm["sleeps"].as<std::uint64_t>();
+    std::chrono::microseconds const duration(
+        vm["duration"].as<std::uint64_t>());
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> sleeps;
+    sleeps.reserve(num_sleeps);
+    for (std::uint64_t i = 0; i != num_sleeps; ++i)
+    {
+        sleeps.push_back(hpx::async(&sleep_once, duration));
+    }
+    hpx::wait_all(sleeps);
+
+    double const elapsed = t.elapsed();
+    double const total = double(num_sleeps);
+    double const delay = double(total_delay.load()) / total * 1e-3;
+
+    if (vm.count("csv") != 0)
+    {
+        std::cout << hpx::get_os_thread_count() << "," << total << ","
+                  << elapsed << "," << total / elapsed << "," << delay << "\n";
+    }
+    else
+    {
+        std::cout << "finished " << total << " concurrent sleeps of "
+                  << duration.count() << " us in " << elapsed << " s ("
+                  << total / elapsed << " ops/s, average delay " << delay
+                  << " us) using " << hpx::get_os_thread_count()
+                  << " threads\n";
+    }
+    hpx::util::print_cdash_timing("ConcurrentSleeps", elapsed);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("sleeps", value<std::uint64_t>()->default_value(1000000),
+         "number of concurrently sleeping HPX threads")
+        ("duration", value<std::uint64_t>()->default_value(100000),
+         "time each of the threads sleeps for (in microseconds)")
+        ("csv", "output results as csv "
+         "(format: threads,count,duration,ops,delay)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,176 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the cost of keeping a large number of tasks
+// suspended while they wait for the same future. Stackful tasks are started
+// with hpx::async and block in shared_future::get(), each of them holds on to
+// its stack until it is resumed. Stackless tasks are C++20 coroutines started
+// on stackless HPX threads which co_await the future, while suspended they
+// hold nothing but their coroutine frame. The benchmark reports the time
+// needed to create and suspend all tasks, the increase of the resident
+// memory of the process, and the time needed to resume all tasks.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This benchmark requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::uint64_t> started(0);
+
+void stackful_task(hpx::shared_future<void> f)
+{
+    ++started;
+    f.get();
+}
+
+hpx::future<void> stackless_task(hpx::shared_future<void> f)
+{
+    ++started;
+    co_await f;
+}
+
+// resident memory of this process in bytes, zero if not available
+std::int64_t resident_memory()
+{
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    std::int64_t pages = 0;
+    std::int64_t resident = 0;
+    statm >> pages >> resident;
+    return resident * static_cast<std::int64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Launch>
+void measure(std::string const& name, std::uint64_t num_tasks, Launch&& launch,
+    bool csv)
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> sf = p.get_future();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    started = 0;
+    std::int64_t const memory_before = resident_memory();
+
+    // create all tasks and wait for them to suspend
+    hpx::chrono::high_resolution_timer t;
+    for (std::uint64_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(launch(sf));
+    }
+    while (started.load() != num_tasks)
+    {
+        hpx::this_thread::yield();
+    }
+    double const suspend_time = t.elapsed();
+
+    std::int64_t const memory = resident_memory() - memory_before;
+
+    // resume all tasks
+    t.restart();
+    p.set_value();
+    hpx::wait_all(tasks);
+    double const resume_time = t.elapsed();
+
+    double const per_task = double(memory) / double(num_tasks);
+
+    if (csv)
+    {
+        std::cout << name << "," << num_tasks << "," << suspend_time << ","
+                  << resume_time << "," << memory << "\n";
+    }
+    else
+    {
+        std::cout << name << ": suspended " << num_tasks << " tasks in "
+                  << suspend_time << " s, resumed them in " << resume_time
+                  << " s, resident memory grew by " << memory << " bytes ("
+                  << per_task << " bytes per task)\n";
+    }
+    hpx::util::print_cdash_timing(name.c_str(), resume_time);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const num_tasks = vm["tasks"].as<std::uint64_t>();
+    bool const csv = vm.count("csv") != 0;
+
+    // the stackless variant runs first, stacks which have been allocated by
+    // the stackful variant are kept around by the scheduler and would hide
+    // the memory used by the coroutine frames
+    if (vm.count("no-stackless") == 0)
+    {
+        auto const policy = hpx::execution::experimental::with_stacksize(
+            hpx::launch::async, hpx::threads::thread_stacksize::nostack);
+
+        measure(
+            "CoroutineSuspensionStackless", num_tasks,
+            [&](hpx::shared_future<void> const& f) -> hpx::future<void> {
+                return hpx::async(policy, &stackless_task, f);
+            },
+            csv);
+    }
+
+    if (vm.count("no-stackful") == 0)
+    {
+        measure(
+            "CoroutineSuspensionStackful", num_tasks,
+            [](hpx::shared_future<void> const& f) {
+                return hpx::async(&stackful_task, f);
+            },
+            csv);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks", value<std::uint64_t>()->default_value(1000000),
+         "number of tasks which are suspended at the same time")
+        ("no-stackless", "do not run the stackless coroutine variant")
+        ("no-stackful", "do not run the stackful hpx::async variant")
+        ("csv", "output results as csv "
+         "(format: variant,tasks,suspend time,resume time,memory)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
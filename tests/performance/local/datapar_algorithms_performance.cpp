@@ -0,0 +1,205 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the sequential and the vectorized (datapar)
+// implementations of transform, reduce, and find for arrays of different
+// element types.
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+bool csvoutput = false;
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1&& t1, T2&& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+struct multiply_add
+{
+    template <typename T>
+    auto operator()(T const& t) const -> decltype(t * t + t)
+    {
+        return t * t + t;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+std::int64_t measure_transform(
+    ExPolicy&& policy, std::vector<T> const& data, std::vector<T>& result)
+{
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::transform(policy, std::begin(data), std::end(data),
+            std::begin(result), multiply_add());
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename ExPolicy, typename T>
+std::int64_t measure_reduce(ExPolicy&& policy, std::vector<T> const& data)
+{
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    T sum = T(0);
+    for (int i = 0; i != test_count; ++i)
+    {
+        sum += hpx::reduce(
+            policy, std::begin(data), std::end(data), T(0), ::plus());
+    }
+    HPX_UNUSED(sum);
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename ExPolicy, typename T>
+std::int64_t measure_find(ExPolicy&& policy, std::vector<T> const& data)
+{
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    // the searched value is stored in the last element only
+    for (int i = 0; i != test_count; ++i)
+    {
+        auto it = hpx::find(policy, std::begin(data), std::end(data), T(-1));
+        HPX_UNUSED(it);
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(std::string const& name, std::string const& type,
+    std::int64_t seq_time, std::int64_t simd_time)
+{
+    if (csvoutput)
+    {
+        std::cout << name << "," << type << "," << seq_time / 1e9 << ","
+                  << simd_time / 1e9 << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << name << "<" << type << ">(execution::seq): " << std::right
+                  << std::setw(15) << seq_time / 1e9 << "\n"
+                  << name << "<" << type << ">(execution::simd): "
+                  << std::right << std::setw(15) << simd_time / 1e9
+                  << "\n"
+                  << std::flush;
+    }
+}
+
+template <typename T>
+void run_benchmarks(
+    std::string const& type, std::size_t size, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> dist(0, 1000);
+
+    std::vector<T> data(size);
+    std::vector<T> result(size);
+    for (T& t : data)
+    {
+        t = T(dist(gen));
+    }
+    data.back() = T(-1);
+
+    // warm up caches
+    measure_transform(hpx::execution::seq, data, result);
+
+    print_result("transform", type,
+        measure_transform(hpx::execution::seq, data, result),
+        measure_transform(hpx::execution::simd, data, result));
+
+    print_result("reduce", type, measure_reduce(hpx::execution::seq, data),
+        measure_reduce(hpx::execution::simd, data));
+
+    print_result("find", type, measure_find(hpx::execution::seq, data),
+        measure_find(hpx::execution::simd, data));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+
+    std::size_t size = vm["vector_size"].as<std::size_t>();
+    csvoutput = vm["csv_output"].as<int>() ? true : false;
+    test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0 || size == 0)
+    {
+        std::cout << "test_count and vector_size must be larger than zero...\n"
+                  << std::flush;
+    }
+    else
+    {
+        run_benchmarks<float>("float", size, gen);
+        run_benchmarks<double>("double", size, gen);
+        run_benchmarks<int>("int", size, gen);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of vector")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -7,6 +7,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/futures/detail/future_data_pool.hpp>
 #include <hpx/local/chrono.hpp>
 #include <hpx/local/future.hpp>
 #include <hpx/local/init.hpp>
@@ -18,6 +19,7 @@
 #include <cstdint>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 using hpx::program_options::options_description;
 using hpx::program_options::value;
@@ -135,7 +137,35 @@ void measure_function_futures_create_thread_hierarchical_placement(
             }
             l.wait();
         });
-    hpx::util::perftests_print_times();
+}
+
+// compare the shared states of futures being allocated from the heap and from
+// the future_data pool, dividing the reported times by the number of futures
+// gives the overhead per future
+void measure_function_futures_pool(std::uint64_t count, const int repetitions)
+{
+    bool const pool_enabled = hpx::lcos::detail::get_future_data_pool_enabled();
+
+    for (bool const use_pool : {false, true})
+    {
+        hpx::lcos::detail::set_future_data_pool_enabled(use_pool);
+
+        hpx::util::perftests_report(
+            "future overhead - async/then - future_data pool",
+            use_pool ? "pool" : "heap", repetitions, [&]() -> void {
+                std::vector<future<double>> futures;
+                futures.reserve(count);
+
+                for (std::uint64_t i = 0; i < count; ++i)
+                {
+                    futures.push_back(async(&null_function).then(
+                        [](future<double>&& f) { return f.get(); }));
+                }
+                hpx::wait_all(futures);
+            });
+    }
+
+    hpx::lcos::detail::set_future_data_pool_enabled(pool_enabled);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -168,6 +198,8 @@ int hpx_main(variables_map& vm)
         {
             measure_function_futures_create_thread_hierarchical_placement(
                 count, repetitions);
+            measure_function_futures_pool(count, repetitions);
+            hpx::util::perftests_print_times();
         }
     }
 
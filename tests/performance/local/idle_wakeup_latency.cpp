@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures how quickly idle worker threads pick up new work
+// and how much CPU time they consume while there is no work. The main thread
+// blocks its worker thread for a while, leaving all other worker threads
+// idle, and then schedules a single HPX thread on one of them. Run it with
+// and without --hpx:ini=hpx.idle_parking=1 to compare spinning idle workers
+// with parked ones.
+
+#include <hpx/config.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const rounds = vm["rounds"].as<std::uint64_t>();
+    std::chrono::microseconds const idle(vm["idle"].as<std::uint64_t>());
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::int64_t total_latency = 0;
+
+    hpx::chrono::high_resolution_timer t;
+    std::clock_t const cpu_start = std::clock();
+
+    for (std::uint64_t i = 0; i != rounds; ++i)
+    {
+        // keep this worker thread busy without running any HPX threads, all
+        // other worker threads become idle
+        std::this_thread::sleep_for(idle);
+
+        // wake up a worker thread other than this one
+        std::size_t const self = hpx::get_worker_thread_num();
+        std::size_t const target = num_threads > 1 ?
+            (self + 1 + i % (num_threads - 1)) % num_threads :
+            self;
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(target)));
+
+        auto const start = std::chrono::steady_clock::now();
+        auto const started =
+            hpx::async(exec, []() { return std::chrono::steady_clock::now(); })
+                .get();
+
+        total_latency +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                started - start)
+                .count();
+    }
+
+    std::clock_t const cpu_end = std::clock();
+    double const elapsed = t.elapsed();
+
+    double const latency = double(total_latency) / double(rounds) * 1e-3;
+    double const cpu_time = double(cpu_end - cpu_start) / CLOCKS_PER_SEC;
+
+    // the CPU time consumed in relation to the available CPU time
+    double const utilization = cpu_time / (elapsed * double(num_threads));
+
+    if (vm.count("csv") != 0)
+    {
+        std::cout << num_threads << "," << rounds << "," << elapsed << ","
+                  << latency << "," << utilization << "\n";
+    }
+    else
+    {
+        std::cout << "finished " << rounds << " wake-ups in " << elapsed
+                  << " s (average latency " << latency
+                  << " us, CPU utilization " << utilization * 100.0
+                  << " %) using " << num_threads << " threads\n";
+    }
+    hpx::util::print_cdash_timing("IdleWakeupLatency", latency * 1e-6);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("rounds", value<std::uint64_t>()->default_value(1000),
+         "number of times an idle worker thread is woken up")
+        ("idle", value<std::uint64_t>()->default_value(10000),
+         "time the worker threads are left idle before each wake-up "
+         "(in microseconds)")
+        ("csv", "output results as csv "
+         "(format: threads,rounds,duration,latency,utilization)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
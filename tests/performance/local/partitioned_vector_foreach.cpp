@@ -10,6 +10,8 @@
 #include <hpx/chrono.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/compute.hpp>
+#include <hpx/include/partitioned_vector.hpp>
 #include <hpx/include/partitioned_vector_predef.hpp>
 #include <hpx/iostream.hpp>
 
@@ -27,6 +29,13 @@
 // The vector types to be used are defined in partitioned_vector module.
 // HPX_REGISTER_PARTITIONED_VECTOR(int)
 
+// Partitions of this vector type are bound to the NUMA domain (target) they
+// have been placed on.
+typedef hpx::compute::host::block_allocator<int> numa_allocator_int;
+typedef hpx::compute::vector<int, numa_allocator_int> numa_vector_int;
+HPX_REGISTER_PARTITIONED_VECTOR_DECLARATION(int, numa_vector_int)
+HPX_REGISTER_PARTITIONED_VECTOR(int, numa_vector_int)
+
 ///////////////////////////////////////////////////////////////////////////////
 int delay = 1000;
 int test_count = 100;
@@ -138,6 +147,24 @@ int hpx_main(hpx::program_options::variables_map& vm)
                     double(par_ref)    //-V106
                       << "\n";
         }
+
+        // one partition per NUMA domain, each executed on its own domain
+        {
+            hpx::partitioned_vector<int, numa_vector_int> v(
+                vector_size, hpx::compute::host::numa_layout);
+
+            hpx::cout << "hpx::partitioned_vector<int>(execution::seq, "
+                         "numa_layout): "
+                      << foreach_vector(hpx::execution::seq, v) /
+                    double(seq_ref)
+                      << "\n";
+            hpx::cout << "hpx::partitioned_vector<int>(execution::par, "
+                         "numa_layout): "
+                      << foreach_vector(
+                             hpx::execution::par.with(cs), v) /
+                    double(par_ref)    //-V106
+                      << "\n";
+        }
     }
 
     return hpx::finalize();
@@ -106,7 +106,7 @@ int hpx_main()
         std::cout << "Result 2: " << result.get() << " in " << (t / 1e6)
                   << " ms.\n";
     }
-    return 0;
+    return hpx::local::finalize();
 }
 
 int main(int argc, char* argv[])
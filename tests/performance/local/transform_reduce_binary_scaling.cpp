@@ -93,18 +93,27 @@ int hpx_main(hpx::program_options::variables_map& vm)
         std::uint64_t tr_time_par = measure_inner_product(
             test_count, hpx::execution::par, data1, data2);
 
+        // both input sequences are read once per iteration, the
+        // measured times are in nanoseconds
+        double const bytes = 2.0 * double(size) * sizeof(float);
+        double const bw_par = bytes / double(tr_time_par);
+        double const bw_datapar = bytes / double(tr_time_datapar);
+
         if (csvoutput)
         {
             std::cout << "," << tr_time_par / 1e9 << ","
-                      << tr_time_datapar / 1e9 << "\n"
+                      << tr_time_datapar / 1e9 << "," << bw_par << ","
+                      << bw_datapar << "\n"
                       << std::flush;
         }
         else
         {
             std::cout << "transform_reduce(execution::par): " << std::right
-                      << std::setw(15) << tr_time_par / 1e9 << "\n"
+                      << std::setw(15) << tr_time_par / 1e9 << " ("
+                      << bw_par << " GB/s)\n"
                       << "transform_reduce(datapar): " << std::right
-                      << std::setw(15) << tr_time_datapar / 1e9 << "\n"
+                      << std::setw(15) << tr_time_datapar / 1e9 << " ("
+                      << bw_datapar << " GB/s)\n"
                       << std::flush;
         }
     }
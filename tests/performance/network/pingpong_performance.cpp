@@ -11,6 +11,7 @@
 #include <hpx/iostream.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/modules/timing.hpp>
 
 #include <cstddef>
 #include <complex>
@@ -31,6 +32,35 @@ namespace pingpong
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action)
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action)
 
+// Send n parcels while keeping at most 'outstanding' of them in flight,
+// returns the number of messages per second
+double measure_throughput(hpx::naming::id_type const& other_locality,
+    std::size_t n, std::size_t outstanding)
+{
+    pingpong_get_element_action act;
+    std::vector<hpx::future<std::complex<double>>> window;
+    window.reserve(outstanding);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        if (window.size() < outstanding)
+        {
+            window.push_back(hpx::async(act, other_locality));
+        }
+        else
+        {
+            // wait for the oldest parcel before sending the next one
+            hpx::future<std::complex<double>>& f = window[i % outstanding];
+            f.get();
+            f = hpx::async(act, other_locality);
+        }
+    }
+    hpx::wait_all(window);
+
+    return double(n) / t.elapsed();
+}
+
 
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -52,6 +82,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::naming::id_type> dummy = hpx::find_remote_localities();
     hpx::naming::id_type other_locality = dummy[0];
 
+    if (vm.count("throughput"))
+    {
+        // only locality 0 sends, its peer just answers the requests
+        if (0 == hpx::get_locality_id())
+        {
+            for (std::size_t outstanding : {1, 8, 64})
+            {
+                double const rate =
+                    measure_throughput(other_locality, n, outstanding);
+                hpx::cout << "outstanding parcels: " << outstanding
+                          << ", messages/s: " << rate << "\n"
+                          << hpx::flush;
+            }
+        }
+        return hpx::finalize();
+    }
+
 
     for(std::size_t i=0; i<n; ++i)
     {
@@ -84,6 +131,9 @@ int main(int argc, char* argv[])
         ("nparcels,n",
          hpx::program_options::value<std::size_t>()->default_value(100),
          "the number of parcels to create")
+        ("throughput",
+         "measure the messages per second with 1, 8, and 64 outstanding "
+         "parcels")
         ;
     // Initialize and run HPX
     std::vector<std::string> cfg;